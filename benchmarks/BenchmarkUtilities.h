@@ -0,0 +1,261 @@
+// Filename: BenchmarkUtilities.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_BenchmarkUtilities
+#define included_BenchmarkUtilities
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+/*!
+ * \brief Class BenchmarkRecorder times repeated applications of a fixed
+ * operation and writes the timings to a machine-readable (JSON) file.
+ *
+ * Each benchmark case is timed via
+ *
+ * \code
+ * recorder.beginCase("spread/IB_4", local_bytes_per_op, local_items_per_op);
+ * while (recorder.nextRep())
+ * {
+ *     // operation to be timed
+ * }
+ * \endcode
+ *
+ * All processes synchronize before each repetition, and the time recorded for
+ * a repetition is the maximum over all processes.  The first few repetitions
+ * are treated as warm-up repetitions and are not recorded.  The number of
+ * bytes moved and the number of "items" processed (e.g. Lagrangian points or
+ * grid cells) by a single application of the operation are estimated by the
+ * caller for the local process and are summed over all processes.
+ *
+ * Results are written to the file
+ * <output_dirname>/<suite_name>_np<nprocs>.json by writeResults().
+ *
+ * <b>Input Database Keys (in database "Benchmark")</b>
+ * - num_warmup_reps (default 2)
+ * - num_reps (default 10)
+ * - output_dirname (default ".")
+ */
+class BenchmarkRecorder
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    BenchmarkRecorder(const std::string& suite_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db)
+        : d_suite_name(suite_name),
+          d_num_warmup_reps(2),
+          d_num_reps(10),
+          d_output_dirname("."),
+          d_parameters(),
+          d_case_name(),
+          d_case_bytes(0.0),
+          d_case_items(0.0),
+          d_rep(0),
+          d_rep_start_time(0.0),
+          d_rep_times(),
+          d_cases()
+    {
+        if (input_db)
+        {
+            if (input_db->keyExists("num_warmup_reps")) d_num_warmup_reps = input_db->getInteger("num_warmup_reps");
+            if (input_db->keyExists("num_reps")) d_num_reps = input_db->getInteger("num_reps");
+            if (input_db->keyExists("output_dirname")) d_output_dirname = input_db->getString("output_dirname");
+        }
+        if (d_num_warmup_reps < 0 || d_num_reps <= 0)
+        {
+            TBOX_ERROR("BenchmarkRecorder::BenchmarkRecorder():\n"
+                       << "  num_warmup_reps must be nonnegative and num_reps must be positive"
+                       << std::endl);
+        }
+        return;
+    } // BenchmarkRecorder
+
+    /*!
+     * \brief Record a problem parameter (e.g. a grid size or a number of
+     * Lagrangian points) in the results file.
+     *
+     * Results are only compared between runs with identical parameters.
+     */
+    void setParameter(const std::string& name, const double value)
+    {
+        d_parameters[name] = value;
+        return;
+    } // setParameter
+
+    /*!
+     * \brief Begin timing a new case.
+     */
+    void beginCase(const std::string& case_name, const double local_bytes_per_op, const double local_items_per_op = 0.0)
+    {
+        d_case_name = case_name;
+        d_case_bytes = SAMRAI::tbox::SAMRAI_MPI::sumReduction(local_bytes_per_op);
+        d_case_items = SAMRAI::tbox::SAMRAI_MPI::sumReduction(local_items_per_op);
+        d_rep = 0;
+        d_rep_times.clear();
+        return;
+    } // beginCase
+
+    /*!
+     * \brief Stop the timer for the previous repetition (if any) and start the
+     * next one.  Returns false once all repetitions have been performed.
+     */
+    bool nextRep()
+    {
+        const double t_stop = MPI_Wtime();
+        if (d_rep > d_num_warmup_reps) d_rep_times.push_back(t_stop - d_rep_start_time);
+        if (d_rep == d_num_warmup_reps + d_num_reps)
+        {
+            finishCase();
+            return false;
+        }
+        SAMRAI::tbox::SAMRAI_MPI::barrier();
+        ++d_rep;
+        d_rep_start_time = MPI_Wtime();
+        return true;
+    } // nextRep
+
+    /*!
+     * \brief Write all recorded results.
+     */
+    void writeResults() const
+    {
+        const int nprocs = SAMRAI::tbox::SAMRAI_MPI::getNodes();
+        if (SAMRAI::tbox::SAMRAI_MPI::getRank() != 0) return;
+        SAMRAI::tbox::Utilities::recursiveMkdir(d_output_dirname);
+        std::ostringstream file_name;
+        file_name << d_output_dirname << "/" << d_suite_name << "_np" << nprocs << ".json";
+        std::ofstream os(file_name.str().c_str());
+        os << std::setprecision(8) << std::scientific;
+        os << "{\n";
+        os << "  \"suite\": \"" << d_suite_name << "\",\n";
+        os << "  \"ndim\": " << NDIM << ",\n";
+        os << "  \"nprocs\": " << nprocs << ",\n";
+        os << "  \"parameters\": {";
+        for (std::map<std::string, double>::const_iterator it = d_parameters.begin(); it != d_parameters.end(); ++it)
+        {
+            os << (it == d_parameters.begin() ? "\n" : ",\n") << "    \"" << it->first << "\": " << it->second;
+        }
+        os << (d_parameters.empty() ? "},\n" : "\n  },\n");
+        os << "  \"cases\": [";
+        for (unsigned int k = 0; k < d_cases.size(); ++k)
+        {
+            const CaseResult& c = d_cases[k];
+            os << (k == 0 ? "\n" : ",\n");
+            os << "    {\n";
+            os << "      \"name\": \"" << c.name << "\",\n";
+            os << "      \"reps\": " << c.reps << ",\n";
+            os << "      \"time_min\": " << c.time_min << ",\n";
+            os << "      \"time_median\": " << c.time_median << ",\n";
+            os << "      \"time_mean\": " << c.time_mean << ",\n";
+            os << "      \"time_max\": " << c.time_max << ",\n";
+            os << "      \"bytes_per_op\": " << c.bytes << ",\n";
+            os << "      \"bandwidth\": " << (c.time_median > 0.0 ? c.bytes / c.time_median : 0.0) << ",\n";
+            os << "      \"items_per_op\": " << c.items << ",\n";
+            os << "      \"items_per_second\": " << (c.time_median > 0.0 ? c.items / c.time_median : 0.0) << "\n";
+            os << "    }";
+        }
+        os << (d_cases.empty() ? "]\n" : "\n  ]\n");
+        os << "}\n";
+        SAMRAI::tbox::pout << "benchmark results written to " << file_name.str() << "\n";
+        return;
+    } // writeResults
+
+private:
+    struct CaseResult
+    {
+        std::string name;
+        int reps;
+        double time_min, time_median, time_mean, time_max;
+        double bytes, items;
+    };
+
+    void finishCase()
+    {
+        const int n = static_cast<int>(d_rep_times.size());
+        SAMRAI::tbox::SAMRAI_MPI::maxReduction(&d_rep_times[0], n);
+        std::vector<double> sorted_times(d_rep_times);
+        std::sort(sorted_times.begin(), sorted_times.end());
+        CaseResult c;
+        c.name = d_case_name;
+        c.reps = n;
+        c.time_min = sorted_times.front();
+        c.time_max = sorted_times.back();
+        c.time_median = (n % 2 == 1 ? sorted_times[n / 2] : 0.5 * (sorted_times[n / 2 - 1] + sorted_times[n / 2]));
+        c.time_mean = 0.0;
+        for (int k = 0; k < n; ++k) c.time_mean += sorted_times[k];
+        c.time_mean /= static_cast<double>(n);
+        c.bytes = d_case_bytes;
+        c.items = d_case_items;
+        d_cases.push_back(c);
+        std::ostringstream summary;
+        summary << std::setw(40) << std::left << d_case_name << std::right << " median = " << std::scientific
+                << std::setprecision(4) << c.time_median << " s"
+                << "  min = " << c.time_min << " s";
+        if (c.bytes > 0.0) summary << "  bandwidth = " << c.bytes / c.time_median / 1.0e9 << " GB/s";
+        SAMRAI::tbox::pout << summary.str() << std::endl;
+        return;
+    } // finishCase
+
+    std::string d_suite_name;
+    int d_num_warmup_reps, d_num_reps;
+    std::string d_output_dirname;
+    std::map<std::string, double> d_parameters;
+
+    std::string d_case_name;
+    double d_case_bytes, d_case_items;
+    int d_rep;
+    double d_rep_start_time;
+    std::vector<double> d_rep_times;
+
+    std::vector<CaseResult> d_cases;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_BenchmarkUtilities
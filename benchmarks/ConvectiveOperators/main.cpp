@@ -0,0 +1,302 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffConvectiveOperatorManager.h>
+#include <ibamr/ConvectiveOperator.h>
+#include <ibamr/INSCollocatedConvectiveOperatorManager.h>
+#include <ibamr/INSStaggeredConvectiveOperatorManager.h>
+#include <ibamr/app_namespaces.h>
+#include <ibamr/ibamr_enums.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Benchmark utilities
+#include "BenchmarkUtilities.h"
+
+namespace
+{
+typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+
+// Time the application of a convective operator.  Each application reads the
+// advected quantity and the advection velocity and writes the result once.
+void
+time_convective_operator(BenchmarkRecorder& recorder,
+                         const std::string& case_name,
+                         Pointer<ConvectiveOperator> convective_op,
+                         SAMRAIVectorReal<NDIM, double>& Q_vec,
+                         SAMRAIVectorReal<NDIM, double>& N_vec,
+                         const int u_idx,
+                         const double num_local_values)
+{
+    convective_op->setAdvectionVelocity(u_idx);
+    convective_op->setSolutionTime(0.0);
+    convective_op->setTimeInterval(0.0, 0.0);
+    convective_op->initializeOperatorState(Q_vec, N_vec);
+    const int Q_idx = Q_vec.getComponentDescriptorIndex(0);
+    const int N_idx = N_vec.getComponentDescriptorIndex(0);
+    recorder.beginCase(case_name, 3.0 * num_local_values * sizeof(double), num_local_values);
+    while (recorder.nextRep())
+    {
+        convective_op->applyConvectiveOperator(Q_idx, N_idx);
+    }
+    convective_op->deallocateOperatorState();
+    return;
+} // time_convective_operator
+}
+
+/*******************************************************************************
+ * Benchmark for the convective operators.                                     *
+ *                                                                             *
+ * The staggered-grid and collocated Navier-Stokes convective operators and    *
+ * the advection-diffusion convective operators of each type listed in the     *
+ * input file are applied to fixed, smooth data on a locally refined grid.     *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ConvectiveOperators.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("ConvectiveOperators", app_initializer->getComponentDatabase("Benchmark"));
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, double> > U_sc_var = new SideVariable<NDIM, double>("U_sc");
+        Pointer<SideVariable<NDIM, double> > N_sc_var = new SideVariable<NDIM, double>("N_sc");
+        Pointer<CellVariable<NDIM, double> > U_cc_var = new CellVariable<NDIM, double>("U_cc", NDIM);
+        Pointer<CellVariable<NDIM, double> > N_cc_var = new CellVariable<NDIM, double>("N_cc", NDIM);
+        Pointer<FaceVariable<NDIM, double> > u_fc_var = new FaceVariable<NDIM, double>("u_fc");
+        Pointer<CellVariable<NDIM, double> > Q_cc_var = new CellVariable<NDIM, double>("Q_cc");
+        Pointer<CellVariable<NDIM, double> > F_cc_var = new CellVariable<NDIM, double>("F_cc");
+
+        const int U_sc_idx = var_db->registerVariableAndContext(U_sc_var, ctx, IntVector<NDIM>(1));
+        const int N_sc_idx = var_db->registerVariableAndContext(N_sc_var, ctx, IntVector<NDIM>(0));
+        const int U_cc_idx = var_db->registerVariableAndContext(U_cc_var, ctx, IntVector<NDIM>(1));
+        const int N_cc_idx = var_db->registerVariableAndContext(N_cc_var, ctx, IntVector<NDIM>(0));
+        const int u_fc_idx = var_db->registerVariableAndContext(u_fc_var, ctx, IntVector<NDIM>(1));
+        const int Q_cc_idx = var_db->registerVariableAndContext(Q_cc_var, ctx, IntVector<NDIM>(1));
+        const int F_cc_idx = var_db->registerVariableAndContext(F_cc_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Allocate data on each level of the patch hierarchy and count the
+        // local degrees of freedom.
+        double num_local_cells = 0.0, num_local_sides = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(U_sc_idx, 0.0);
+            level->allocatePatchData(N_sc_idx, 0.0);
+            level->allocatePatchData(U_cc_idx, 0.0);
+            level->allocatePatchData(N_cc_idx, 0.0);
+            level->allocatePatchData(u_fc_idx, 0.0);
+            level->allocatePatchData(Q_cc_idx, 0.0);
+            level->allocatePatchData(F_cc_idx, 0.0);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+                num_local_cells += patch_box.size();
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    Box<NDIM> side_box = patch_box;
+                    side_box.upper()(axis) += 1;
+                    num_local_sides += side_box.size();
+                }
+            }
+        }
+        recorder.setParameter("num_levels", finest_ln + 1);
+        recorder.setParameter("num_cells", SAMRAI_MPI::sumReduction(num_local_cells));
+
+        // Setup deterministic velocity fields and advected quantities, and
+        // fill the ghost cells of the advection velocities.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction Q_fcn("Q", app_initializer->getComponentDatabase("Q"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(U_sc_idx, U_sc_var, patch_hierarchy, 0.0);
+        u_fcn.setDataOnPatchHierarchy(U_cc_idx, U_cc_var, patch_hierarchy, 0.0);
+        u_fcn.setDataOnPatchHierarchy(u_fc_idx, u_fc_var, patch_hierarchy, 0.0);
+        Q_fcn.setDataOnPatchHierarchy(Q_cc_idx, Q_cc_var, patch_hierarchy, 0.0);
+        std::vector<InterpolationTransactionComponent> u_components;
+        u_components.push_back(InterpolationTransactionComponent(
+            U_sc_idx, "CONSERVATIVE_LINEAR_REFINE", false, "CONSERVATIVE_COARSEN", "LINEAR", false, NULL));
+        u_components.push_back(InterpolationTransactionComponent(
+            U_cc_idx, "CONSERVATIVE_LINEAR_REFINE", false, "CONSERVATIVE_COARSEN", "LINEAR", false, NULL));
+        HierarchyGhostCellInterpolation u_fill_op;
+        u_fill_op.initializeOperatorState(u_components, patch_hierarchy);
+        u_fill_op.fillData(0.0);
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> U_sc_vec("U_sc", patch_hierarchy, coarsest_ln, finest_ln);
+        SAMRAIVectorReal<NDIM, double> N_sc_vec("N_sc", patch_hierarchy, coarsest_ln, finest_ln);
+        U_sc_vec.addComponent(U_sc_var, U_sc_idx, h_sc_idx);
+        N_sc_vec.addComponent(N_sc_var, N_sc_idx, h_sc_idx);
+
+        SAMRAIVectorReal<NDIM, double> U_cc_vec("U_cc", patch_hierarchy, coarsest_ln, finest_ln);
+        SAMRAIVectorReal<NDIM, double> N_cc_vec("N_cc", patch_hierarchy, coarsest_ln, finest_ln);
+        U_cc_vec.addComponent(U_cc_var, U_cc_idx, h_cc_idx);
+        N_cc_vec.addComponent(N_cc_var, N_cc_idx, h_cc_idx);
+
+        SAMRAIVectorReal<NDIM, double> Q_cc_vec("Q_cc", patch_hierarchy, coarsest_ln, finest_ln);
+        SAMRAIVectorReal<NDIM, double> F_cc_vec("F_cc", patch_hierarchy, coarsest_ln, finest_ln);
+        Q_cc_vec.addComponent(Q_cc_var, Q_cc_idx, h_cc_idx);
+        F_cc_vec.addComponent(F_cc_var, F_cc_idx, h_cc_idx);
+
+        // Time each of the convective operators.  The domain is periodic, so
+        // no physical boundary condition objects are required.
+        const ConvectiveDifferencingType difference_form =
+            string_to_enum<ConvectiveDifferencingType>(input_db->getString("convective_difference_form"));
+        Pointer<Database> convective_op_db =
+            input_db->isDatabase("convective_op_db") ? input_db->getDatabase("convective_op_db") : Pointer<Database>();
+        const std::vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM, static_cast<RobinBcCoefStrategy<NDIM>*>(NULL));
+        const std::vector<RobinBcCoefStrategy<NDIM>*> Q_bc_coefs(1, static_cast<RobinBcCoefStrategy<NDIM>*>(NULL));
+        const std::string form_name = enum_to_string<ConvectiveDifferencingType>(difference_form);
+
+        const Array<std::string> staggered_op_types = input_db->getStringArray("staggered_convective_op_types");
+        for (int k = 0; k < staggered_op_types.getSize(); ++k)
+        {
+            Pointer<ConvectiveOperator> convective_op =
+                INSStaggeredConvectiveOperatorManager::getManager()->allocateOperator(
+                    staggered_op_types[k], "staggered_convective_op", convective_op_db, difference_form, u_bc_coefs);
+            time_convective_operator(recorder,
+                                     "ins_staggered/" + staggered_op_types[k] + "/" + form_name,
+                                     convective_op,
+                                     U_sc_vec,
+                                     N_sc_vec,
+                                     U_sc_idx,
+                                     num_local_sides);
+        }
+
+        const Array<std::string> collocated_op_types = input_db->getStringArray("collocated_convective_op_types");
+        for (int k = 0; k < collocated_op_types.getSize(); ++k)
+        {
+            Pointer<ConvectiveOperator> convective_op =
+                INSCollocatedConvectiveOperatorManager::getManager()->allocateOperator(
+                    collocated_op_types[k], "collocated_convective_op", convective_op_db, difference_form, u_bc_coefs);
+            time_convective_operator(recorder,
+                                     "ins_collocated/" + collocated_op_types[k] + "/" + form_name,
+                                     convective_op,
+                                     U_cc_vec,
+                                     N_cc_vec,
+                                     u_fc_idx,
+                                     NDIM * num_local_cells);
+        }
+
+        const Array<std::string> adv_diff_op_types = input_db->getStringArray("adv_diff_convective_op_types");
+        for (int k = 0; k < adv_diff_op_types.getSize(); ++k)
+        {
+            Pointer<ConvectiveOperator> convective_op =
+                AdvDiffConvectiveOperatorManager::getManager()->allocateOperator(adv_diff_op_types[k],
+                                                                                 "adv_diff_convective_op",
+                                                                                 Q_cc_var,
+                                                                                 convective_op_db,
+                                                                                 difference_form,
+                                                                                 Q_bc_coefs);
+            time_convective_operator(recorder,
+                                     "adv_diff/" + adv_diff_op_types[k] + "/" + form_name,
+                                     convective_op,
+                                     Q_cc_vec,
+                                     F_cc_vec,
+                                     u_fc_idx,
+                                     num_local_cells);
+        }
+
+        recorder.writeResults();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
@@ -0,0 +1,290 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibamr/StaggeredStokesSolver.h>
+#include <ibamr/StaggeredStokesSolverManager.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/SCPoissonSolverManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Benchmark utilities
+#include "BenchmarkUtilities.h"
+
+namespace
+{
+// Estimate of the data moved by one V-cycle: each smoothing sweep and each of
+// the residual, restriction, and prolongation passes reads and writes the
+// solution and right-hand side vectors once on every level.
+inline double
+v_cycle_bytes(const double num_local_dofs, Pointer<Database> precond_db)
+{
+    const int num_pre_sweeps = precond_db->getIntegerWithDefault("num_pre_sweeps", 0);
+    const int num_post_sweeps = precond_db->getIntegerWithDefault("num_post_sweeps", 2);
+    return 2.0 * num_local_dofs * sizeof(double) * static_cast<double>(num_pre_sweeps + num_post_sweeps + 3);
+} // v_cycle_bytes
+}
+
+/*******************************************************************************
+ * Benchmark for FAC multigrid preconditioners.                                *
+ *                                                                             *
+ * A single V-cycle of the cell-centered Poisson, side-centered Poisson, and   *
+ * staggered-grid Stokes FAC preconditioners is timed on a fixed, locally      *
+ * refined grid.                                                               *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "FAC.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("FAC", app_initializer->getComponentDatabase("Benchmark"));
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<CellVariable<NDIM, double> > p_cc_var = new CellVariable<NDIM, double>("p_cc");
+        Pointer<CellVariable<NDIM, double> > g_cc_var = new CellVariable<NDIM, double>("g_cc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, IntVector<NDIM>(1));
+        const int p_cc_idx = var_db->registerVariableAndContext(p_cc_var, ctx, IntVector<NDIM>(1));
+        const int g_cc_idx = var_db->registerVariableAndContext(g_cc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Allocate data on each level of the patch hierarchy and count the
+        // local degrees of freedom.
+        double num_local_cells = 0.0, num_local_sides = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(u_sc_idx, 0.0);
+            level->allocatePatchData(f_sc_idx, 0.0);
+            level->allocatePatchData(p_cc_idx, 0.0);
+            level->allocatePatchData(g_cc_idx, 0.0);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+                num_local_cells += patch_box.size();
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    Box<NDIM> side_box = patch_box;
+                    side_box.upper()(axis) += 1;
+                    num_local_sides += side_box.size();
+                }
+            }
+        }
+        recorder.setParameter("num_levels", finest_ln + 1);
+        recorder.setParameter("num_cells", SAMRAI_MPI::sumReduction(num_local_cells));
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_cc_vec("u_cc", patch_hierarchy, coarsest_ln, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_cc_vec("f_cc", patch_hierarchy, coarsest_ln, finest_ln);
+        u_cc_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_cc_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+
+        SAMRAIVectorReal<NDIM, double> u_sc_vec("u_sc", patch_hierarchy, coarsest_ln, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_sc_vec("f_sc", patch_hierarchy, coarsest_ln, finest_ln);
+        u_sc_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        f_sc_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+
+        SAMRAIVectorReal<NDIM, double> x_vec("x", patch_hierarchy, coarsest_ln, finest_ln);
+        SAMRAIVectorReal<NDIM, double> b_vec("b", patch_hierarchy, coarsest_ln, finest_ln);
+        x_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        x_vec.addComponent(p_cc_var, p_cc_idx, h_cc_idx);
+        b_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+        b_vec.addComponent(g_cc_var, g_cc_idx, h_cc_idx);
+
+        // Setup deterministic right-hand sides.
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(f_sc_idx, f_sc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(g_cc_idx, g_cc_var, patch_hierarchy, 0.0);
+
+        // Setup the problem specifications.  The domain is periodic, so no
+        // physical boundary condition objects are required.
+        const double C = input_db->getDouble("C");
+        const double D = input_db->getDouble("D");
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(C);
+        poisson_spec.setDConstant(D);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(NDIM, bc_coef);
+
+        // Time a single V-cycle of the cell-centered Poisson preconditioner.
+        {
+            const std::string precond_type = input_db->getString("cc_precond_type");
+            Pointer<Database> precond_db = input_db->getDatabase("cc_precond_db");
+            Pointer<PoissonSolver> cc_precond =
+                CCPoissonSolverManager::getManager()->allocateSolver(precond_type, "cc_precond", precond_db, "cc_");
+            cc_precond->setPoissonSpecifications(poisson_spec);
+            cc_precond->setPhysicalBcCoef(bc_coef);
+            cc_precond->setMaxIterations(1);
+            cc_precond->initializeSolverState(u_cc_vec, f_cc_vec);
+            recorder.beginCase("cc_poisson_v_cycle/" + precond_type,
+                               v_cycle_bytes(num_local_cells, precond_db),
+                               num_local_cells);
+            while (recorder.nextRep())
+            {
+                u_cc_vec.setToScalar(0.0);
+                cc_precond->solveSystem(u_cc_vec, f_cc_vec);
+            }
+            cc_precond->deallocateSolverState();
+        }
+
+        // Time a single V-cycle of the side-centered Poisson preconditioner.
+        {
+            const std::string precond_type = input_db->getString("sc_precond_type");
+            Pointer<Database> precond_db = input_db->getDatabase("sc_precond_db");
+            Pointer<PoissonSolver> sc_precond =
+                SCPoissonSolverManager::getManager()->allocateSolver(precond_type, "sc_precond", precond_db, "sc_");
+            sc_precond->setPoissonSpecifications(poisson_spec);
+            sc_precond->setPhysicalBcCoefs(bc_coefs);
+            sc_precond->setMaxIterations(1);
+            sc_precond->initializeSolverState(u_sc_vec, f_sc_vec);
+            recorder.beginCase("sc_poisson_v_cycle/" + precond_type,
+                               v_cycle_bytes(num_local_sides, precond_db),
+                               num_local_sides);
+            while (recorder.nextRep())
+            {
+                u_sc_vec.setToScalar(0.0);
+                sc_precond->solveSystem(u_sc_vec, f_sc_vec);
+            }
+            sc_precond->deallocateSolverState();
+        }
+
+        // Time a single V-cycle of the staggered-grid Stokes preconditioner.
+        {
+            const std::string precond_type = input_db->getString("stokes_precond_type");
+            Pointer<Database> precond_db = input_db->getDatabase("stokes_precond_db");
+            Pointer<StaggeredStokesSolver> stokes_precond = StaggeredStokesSolverManager::getManager()->allocateSolver(
+                precond_type, "stokes_precond", precond_db, "stokes_");
+            stokes_precond->setVelocityPoissonSpecifications(poisson_spec);
+            stokes_precond->setPhysicalBcCoefs(bc_coefs, bc_coef);
+            stokes_precond->setPhysicalBoundaryHelper(new StaggeredStokesPhysicalBoundaryHelper());
+            stokes_precond->setSolutionTime(0.0);
+            stokes_precond->setTimeInterval(0.0, 0.0);
+            stokes_precond->setComponentsHaveNullspace(false, true);
+            stokes_precond->setMaxIterations(1);
+            stokes_precond->initializeSolverState(x_vec, b_vec);
+            recorder.beginCase("stokes_v_cycle/" + precond_type,
+                               v_cycle_bytes(num_local_sides + num_local_cells, precond_db),
+                               num_local_sides + num_local_cells);
+            while (recorder.nextRep())
+            {
+                x_vec.setToScalar(0.0);
+                stokes_precond->solveSystem(x_vec, b_vec);
+            }
+            stokes_precond->deallocateSolverState();
+        }
+
+        recorder.writeResults();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
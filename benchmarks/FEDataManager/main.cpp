@@ -0,0 +1,210 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEDataManager.h>
+#include <ibtk/libmesh_utilities.h>
+
+// Benchmark utilities
+#include "BenchmarkUtilities.h"
+
+/*******************************************************************************
+ * Benchmark for the finite element spreading and interpolation operations.    *
+ *                                                                             *
+ * FEDataManager::spread() and FEDataManager::interp() are timed for a fixed   *
+ * structured mesh of a square immersed in a periodic domain.                  *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "FEDataManager.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("FEDataManager", app_initializer->getComponentDatabase("Benchmark"));
+
+        // Create a structured mesh of the square [0.25,0.75]^NDIM.
+        Mesh mesh(init.comm(), NDIM);
+        const int num_elems = input_db->getInteger("num_elems");
+        const std::string elem_type = input_db->getString("elem_type");
+#if (NDIM == 2)
+        MeshTools::Generation::build_square(
+            mesh, num_elems, num_elems, 0.25, 0.75, 0.25, 0.75, Utility::string_to_enum<ElemType>(elem_type));
+#endif
+#if (NDIM == 3)
+        MeshTools::Generation::build_cube(mesh,
+                                          num_elems,
+                                          num_elems,
+                                          num_elems,
+                                          0.25,
+                                          0.75,
+                                          0.25,
+                                          0.75,
+                                          0.25,
+                                          0.75,
+                                          Utility::string_to_enum<ElemType>(elem_type));
+#endif
+        recorder.setParameter("num_elems", mesh.n_elem());
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver and initialize hierarchy configuration and
+        // data on all patches.
+        ib_method_ops->initializeFEEquationSystems();
+        FEDataManager* fe_data_manager = ib_method_ops->getFEDataManager();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        app_initializer.setNull();
+
+        // Create the Eulerian variables used by the benchmark.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("benchmark");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u_benchmark");
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f_benchmark");
+        const IntVector<NDIM>& ghost_width = fe_data_manager->getGhostCellWidth();
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, ghost_width);
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, ghost_width);
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(finest_ln);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+        double num_local_sides = 0.0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            u_data->fillAll(1.0);
+            num_local_sides += u_data->getGhostBox().size() * NDIM;
+        }
+
+        // Setup the Lagrangian data.
+        const double time = time_integrator->getIntegratorTime();
+        EquationSystems* equation_systems = fe_data_manager->getEquationSystems();
+        NumericVector<double>* X_ghost_vec =
+            fe_data_manager->buildGhostedSolutionVector(IBFEMethod::COORDS_SYSTEM_NAME);
+        NumericVector<double>* F_ghost_vec =
+            fe_data_manager->buildGhostedSolutionVector(IBFEMethod::FORCE_SYSTEM_NAME);
+        *F_ghost_vec = 1.0;
+        NumericVector<double>* U_vec = equation_systems->get_system(IBFEMethod::VELOCITY_SYSTEM_NAME).solution.get();
+        const double num_local_elems = mesh.n_active_local_elem();
+
+        // Each operation reads the positions and reads or writes the nodal
+        // values of the structure, and (at most) reads or writes every
+        // Eulerian value on the finest level.
+        const double fe_bytes = 2.0 * U_vec->local_size() * sizeof(double);
+        const double grid_bytes = num_local_sides * sizeof(double);
+
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, finest_ln, finest_ln);
+        recorder.beginCase("spread", fe_bytes + 2.0 * grid_bytes, num_local_elems);
+        while (recorder.nextRep())
+        {
+            hier_sc_data_ops.setToScalar(f_idx, 0.0);
+            fe_data_manager->spread(f_idx, *F_ghost_vec, *X_ghost_vec, IBFEMethod::FORCE_SYSTEM_NAME, NULL, time);
+        }
+
+        recorder.beginCase("interp", fe_bytes + grid_bytes, num_local_elems);
+        while (recorder.nextRep())
+        {
+            fe_data_manager->interp(u_idx, *U_vec, *X_ghost_vec, IBFEMethod::VELOCITY_SYSTEM_NAME);
+        }
+
+        recorder.writeResults();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    return 0;
+} // main
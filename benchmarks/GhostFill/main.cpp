@@ -0,0 +1,221 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Benchmark utilities
+#include "BenchmarkUtilities.h"
+
+namespace
+{
+typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+
+// Number of ghost values on the local patches of the hierarchy for data with
+// the specified centering and ghost cell width.
+double
+count_local_ghost_values(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const bool side_centered, const int gcw)
+{
+    double num_ghost_values = 0.0;
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            for (unsigned int axis = 0; axis < (side_centered ? NDIM : 1); ++axis)
+            {
+                Box<NDIM> data_box = patch_box;
+                if (side_centered) data_box.upper()(axis) += 1;
+                num_ghost_values += Box<NDIM>::grow(data_box, IntVector<NDIM>(gcw)).size() - data_box.size();
+            }
+        }
+    }
+    return num_ghost_values;
+} // count_local_ghost_values
+}
+
+/*******************************************************************************
+ * Benchmark for ghost cell filling on a locally refined grid.                 *
+ *                                                                             *
+ * Both the construction of the communication schedules and the ghost cell    *
+ * fill itself are timed for cell- and side-centered data for each ghost cell  *
+ * width listed in the input file.                                             *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "GhostFill.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("GhostFill", app_initializer->getComponentDatabase("Benchmark"));
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const Array<int> ghost_widths = input_db->getIntegerArray("ghost_widths");
+        const std::string refine_type = input_db->getStringWithDefault("refine_type", "CONSERVATIVE_LINEAR_REFINE");
+        const std::string coarsen_type = input_db->getStringWithDefault("coarsen_type", "CONSERVATIVE_COARSEN");
+        const bool use_cf_interpolation = input_db->getBoolWithDefault("use_cf_interpolation", true);
+        std::vector<int> q_cc_idxs(ghost_widths.getSize()), q_sc_idxs(ghost_widths.getSize());
+        Pointer<CellVariable<NDIM, double> > q_cc_var = new CellVariable<NDIM, double>("q_cc");
+        Pointer<SideVariable<NDIM, double> > q_sc_var = new SideVariable<NDIM, double>("q_sc");
+        for (int k = 0; k < ghost_widths.getSize(); ++k)
+        {
+            std::ostringstream ctx_name;
+            ctx_name << "gcw_" << ghost_widths[k];
+            Pointer<VariableContext> ctx = var_db->getContext(ctx_name.str());
+            q_cc_idxs[k] = var_db->registerVariableAndContext(q_cc_var, ctx, IntVector<NDIM>(ghost_widths[k]));
+            q_sc_idxs[k] = var_db->registerVariableAndContext(q_sc_var, ctx, IntVector<NDIM>(ghost_widths[k]));
+        }
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        double num_local_cells = 0.0;
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (int k = 0; k < ghost_widths.getSize(); ++k)
+            {
+                level->allocatePatchData(q_cc_idxs[k], 0.0);
+                level->allocatePatchData(q_sc_idxs[k], 0.0);
+            }
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++) num_local_cells += level->getPatch(p())->getBox().size();
+        }
+        recorder.setParameter("num_levels", patch_hierarchy->getFinestLevelNumber() + 1);
+        recorder.setParameter("num_cells", SAMRAI_MPI::sumReduction(num_local_cells));
+
+        // Setup deterministic interior data.
+        muParserCartGridFunction q_fcn("q", app_initializer->getComponentDatabase("q"), grid_geometry);
+        for (int k = 0; k < ghost_widths.getSize(); ++k)
+        {
+            q_fcn.setDataOnPatchHierarchy(q_cc_idxs[k], q_cc_var, patch_hierarchy, 0.0);
+            q_fcn.setDataOnPatchHierarchy(q_sc_idxs[k], q_sc_var, patch_hierarchy, 0.0);
+        }
+
+        // Time schedule construction and ghost cell filling.  Each ghost value
+        // is written once and (at least) one source value is read for it.
+        for (int k = 0; k < ghost_widths.getSize(); ++k)
+        {
+            for (int s = 0; s < 2; ++s)
+            {
+                const bool side_centered = (s == 1);
+                const int q_idx = side_centered ? q_sc_idxs[k] : q_cc_idxs[k];
+                std::ostringstream case_suffix;
+                case_suffix << (side_centered ? "sc" : "cc") << "/gcw_" << ghost_widths[k];
+                const double num_local_ghost_values =
+                    count_local_ghost_values(patch_hierarchy, side_centered, ghost_widths[k]);
+
+                InterpolationTransactionComponent q_component(
+                    q_idx, refine_type, use_cf_interpolation, coarsen_type, "LINEAR", false, NULL);
+                Pointer<HierarchyGhostCellInterpolation> fill_op = new HierarchyGhostCellInterpolation();
+
+                recorder.beginCase("initialize_schedules/" + case_suffix.str(), 0.0);
+                while (recorder.nextRep())
+                {
+                    fill_op->deallocateOperatorState();
+                    fill_op->initializeOperatorState(q_component, patch_hierarchy);
+                }
+
+                recorder.beginCase("fill_data/" + case_suffix.str(),
+                                   2.0 * num_local_ghost_values * sizeof(double),
+                                   num_local_ghost_values);
+                while (recorder.nextRep())
+                {
+                    fill_op->fillData(0.0);
+                }
+                fill_op->deallocateOperatorState();
+            }
+        }
+
+        recorder.writeResults();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
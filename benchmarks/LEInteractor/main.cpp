@@ -0,0 +1,241 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LEInteractor.h>
+
+// Benchmark utilities
+#include "BenchmarkUtilities.h"
+
+namespace
+{
+// Deterministic uniform sample in [0,1) associated with a cell, a point in
+// that cell, and a coordinate direction.  The sample does not depend on the
+// parallel decomposition.
+inline double
+cell_sample(const Index<NDIM>& i, const int k, const int d)
+{
+    unsigned int h = 2166136261u;
+    for (unsigned int e = 0; e < NDIM; ++e) h = (h ^ static_cast<unsigned int>(i(e))) * 16777619u;
+    h = (h ^ static_cast<unsigned int>(k)) * 16777619u;
+    h = (h ^ static_cast<unsigned int>(d)) * 16777619u;
+    h ^= h >> 13;
+    h *= 0x5bd1e995u;
+    h ^= h >> 15;
+    return static_cast<double>(h) / 4294967296.0;
+} // cell_sample
+}
+
+/*******************************************************************************
+ * Benchmark for the Lagrangian-Eulerian interaction kernels.                  *
+ *                                                                             *
+ * Velocity interpolation and force spreading are timed for each kernel        *
+ * function listed in the input file.  The Lagrangian points are placed at     *
+ * deterministic pseudo-random locations, with a fixed number of points per    *
+ * Cartesian grid cell.                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "LEInteractor.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("LEInteractor", app_initializer->getComponentDatabase("Benchmark"));
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        const Array<std::string> kernel_fcns = input_db->getStringArray("kernel_fcns");
+        const int points_per_cell = input_db->getIntegerWithDefault("points_per_cell", 1);
+        int ghost_width = 0;
+        for (int k = 0; k < kernel_fcns.getSize(); ++k)
+        {
+            ghost_width = std::max(ghost_width, LEInteractor::getMinimumGhostWidth(kernel_fcns[k]));
+        }
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(ghost_width));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(ghost_width));
+
+        // Initialize the patch hierarchy.  Only a single level is used.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+
+        // Setup the Lagrangian point locations and data on each patch.
+        std::vector<std::vector<double> > X_data, Q_data;
+        unsigned int num_local_points = 0;
+        unsigned int num_local_cells = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Index<NDIM>& patch_lower = patch_box.lower();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            u_data->fillAll(1.0);
+            std::vector<double> X;
+            X.reserve(NDIM * points_per_cell * patch_box.size());
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const Index<NDIM>& i = b();
+                for (int k = 0; k < points_per_cell; ++k)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        const double offset = static_cast<double>(i(d) - patch_lower(d)) + cell_sample(i, k, d);
+                        X.push_back(x_lower[d] + dx[d] * offset);
+                    }
+                }
+            }
+            num_local_points += X.size() / NDIM;
+            num_local_cells += patch_box.size();
+            X_data.push_back(X);
+            Q_data.push_back(std::vector<double>(X.size(), 1.0));
+        }
+        recorder.setParameter("num_cells", SAMRAI_MPI::sumReduction(static_cast<double>(num_local_cells)));
+        recorder.setParameter("points_per_cell", points_per_cell);
+
+        // Time interpolation and spreading for each kernel function.
+        for (int k = 0; k < kernel_fcns.getSize(); ++k)
+        {
+            const std::string& kernel_fcn = kernel_fcns[k];
+            int stencil_points = 1;
+            for (unsigned int d = 0; d < NDIM; ++d) stencil_points *= LEInteractor::getStencilSize(kernel_fcn);
+
+            // Each point reads its position and reads or writes one value per
+            // component, and each component touches a full stencil of grid
+            // values.
+            const double point_bytes = 2.0 * NDIM * sizeof(double);
+            const double grid_bytes = NDIM * stencil_points * sizeof(double);
+
+            recorder.beginCase("interpolate/" + kernel_fcn,
+                               num_local_points * (point_bytes + grid_bytes),
+                               static_cast<double>(num_local_points));
+            while (recorder.nextRep())
+            {
+                int local_patch_num = 0;
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+                    LEInteractor::interpolate(Q_data[local_patch_num],
+                                              NDIM,
+                                              X_data[local_patch_num],
+                                              NDIM,
+                                              u_data,
+                                              patch,
+                                              patch->getBox(),
+                                              kernel_fcn);
+                }
+            }
+
+            recorder.beginCase("spread/" + kernel_fcn,
+                               num_local_points * (point_bytes + 2.0 * grid_bytes),
+                               static_cast<double>(num_local_points));
+            while (recorder.nextRep())
+            {
+                int local_patch_num = 0;
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+                    f_data->fillAll(0.0);
+                    LEInteractor::spread(f_data,
+                                         Q_data[local_patch_num],
+                                         NDIM,
+                                         X_data[local_patch_num],
+                                         NDIM,
+                                         patch,
+                                         patch->getBox(),
+                                         kernel_fcn);
+                }
+            }
+        }
+
+        recorder.writeResults();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
@@ -0,0 +1,249 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+// Benchmark utilities
+#include "BenchmarkUtilities.h"
+
+namespace
+{
+// Write the vertex, spring, beam, and target point files describing a set of
+// concentric rings centered in the unit square.
+void
+write_structure_files(const std::string& base_filename, Pointer<Database> db)
+{
+    const int num_rings = db->getInteger("num_rings");
+    const int points_per_ring = db->getInteger("points_per_ring");
+    const double r_min = db->getDouble("r_min");
+    const double r_max = db->getDouble("r_max");
+    const double spring_stiffness = db->getDouble("spring_stiffness");
+    const double beam_stiffness = db->getDouble("beam_stiffness");
+    const double target_stiffness = db->getDouble("target_stiffness");
+    const int target_stride = db->getInteger("target_stride");
+    const int num_points = num_rings * points_per_ring;
+
+    std::ofstream vertex_stream((base_filename + ".vertex").c_str());
+    std::ofstream spring_stream((base_filename + ".spring").c_str());
+    std::ofstream beam_stream((base_filename + ".beam").c_str());
+    std::ofstream target_stream((base_filename + ".target").c_str());
+    vertex_stream << std::setprecision(16) << std::scientific << num_points << "\n";
+    spring_stream << std::setprecision(16) << std::scientific << num_points << "\n";
+    beam_stream << std::setprecision(16) << std::scientific << num_points << "\n";
+    target_stream << std::setprecision(16) << std::scientific << (num_points + target_stride - 1) / target_stride
+                  << "\n";
+    for (int r = 0; r < num_rings; ++r)
+    {
+        const double radius = (num_rings == 1 ? r_min : r_min + (r_max - r_min) * r / (num_rings - 1));
+        const double ds = 2.0 * M_PI * radius / points_per_ring;
+        for (int k = 0; k < points_per_ring; ++k)
+        {
+            const double theta = 2.0 * M_PI * k / points_per_ring;
+            vertex_stream << 0.5 + radius * cos(theta) << " " << 0.5 + radius * sin(theta);
+            for (unsigned int d = 2; d < NDIM; ++d) vertex_stream << " " << 0.5;
+            vertex_stream << "\n";
+            const int curr_idx = r * points_per_ring + k;
+            const int next_idx = r * points_per_ring + (k + 1) % points_per_ring;
+            const int prev_idx = r * points_per_ring + (k + points_per_ring - 1) % points_per_ring;
+            spring_stream << curr_idx << " " << next_idx << " " << spring_stiffness / ds << " " << ds << "\n";
+            beam_stream << prev_idx << " " << curr_idx << " " << next_idx << " " << beam_stiffness / pow(ds, 3)
+                        << "\n";
+        }
+    }
+    for (int k = 0; k < num_points; k += target_stride)
+    {
+        target_stream << k << " " << target_stiffness << "\n";
+    }
+    return;
+} // write_structure_files
+}
+
+/*******************************************************************************
+ * Benchmark for the Lagrangian data management and force generation.         *
+ *                                                                             *
+ * LDataManager data redistribution and IBStandardForceGen level setup and     *
+ * force evaluation are timed for a fixed set of elastic rings.  The           *
+ * structure files are generated by the driver.                                *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "Lagrangian.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("Lagrangian", app_initializer->getComponentDatabase("Benchmark"));
+
+        // Generate the structure files.
+        Pointer<Database> structure_db = app_initializer->getComponentDatabase("Structure");
+        if (SAMRAI_MPI::getRank() == 0) write_structure_files("benchmark_rings", structure_db);
+        SAMRAI_MPI::barrier();
+        recorder.setParameter("num_rings", structure_db->getInteger("num_rings"));
+        recorder.setParameter("points_per_ring", structure_db->getInteger("points_per_ring"));
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        const double time = time_integrator->getIntegratorTime();
+        const double shift = input_db->getDouble("redistribution_shift");
+        const double num_local_nodes = l_data_manager->getNumberOfLocalNodes(finest_ln);
+
+        // Each ring point is the master point of one spring and one beam.
+        const double num_local_springs = num_local_nodes;
+        const double num_local_beams = num_local_nodes;
+
+        // Time data redistribution.  Between redistributions, all of the
+        // points are displaced back and forth by a fixed amount so that nodes
+        // change ownership.  The position and velocity data are moved along
+        // with the Lagrangian indices.
+        const double index_bytes = 2.0 * sizeof(int);
+        const double node_bytes = index_bytes + 2.0 * NDIM * sizeof(double);
+        int shift_sign = 1;
+        recorder.beginCase("ldata_manager/redistribute", 2.0 * num_local_nodes * node_bytes, num_local_nodes);
+        while (recorder.nextRep())
+        {
+            Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+            boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+            for (unsigned int k = 0; k < X_array.shape()[0]; ++k)
+            {
+                X_array[k][0] += shift_sign * shift;
+            }
+            X_data->restoreArrays();
+            shift_sign = -shift_sign;
+            l_data_manager->beginDataRedistribution();
+            l_data_manager->endDataRedistribution();
+        }
+
+        // Time the setup of the force generator data (which must be
+        // recomputed after every redistribution).
+        recorder.beginCase("ib_standard_force_gen/initialize_level_data", 0.0, num_local_nodes);
+        while (recorder.nextRep())
+        {
+            ib_force_fcn->initializeLevelData(patch_hierarchy, finest_ln, time, false, l_data_manager);
+        }
+
+        // Time force evaluation.  Each spring and beam reads the positions of
+        // its end points and accumulates forces on them.
+        Pointer<LData> F_data = l_data_manager->createLData("F_benchmark", finest_ln, NDIM);
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, finest_ln);
+        const double force_bytes = (num_local_springs * 2.0 + num_local_beams * 3.0) * 2.0 * NDIM * sizeof(double);
+        recorder.beginCase("ib_standard_force_gen/compute_lagrangian_force", force_bytes, num_local_nodes);
+        while (recorder.nextRep())
+        {
+            int ierr = VecSet(F_data->getVec(), 0.0);
+            IBTK_CHKERRQ(ierr);
+            ib_force_fcn->computeLagrangianForce(
+                F_data, X_data, U_data, patch_hierarchy, finest_ln, time, l_data_manager);
+        }
+
+        recorder.writeResults();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
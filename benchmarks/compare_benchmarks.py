@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+"""Compare two sets of IBAMR benchmark results.
+
+usage: compare_benchmarks.py [--tolerance 0.1] baseline_dir current_dir
+
+Each directory should contain the JSON files written by the benchmark drivers
+(e.g. as collected by run_benchmarks.sh).  Cases are matched by suite name,
+case name, and number of processes; results obtained with different benchmark
+parameters are not compared.  The median times are compared, and any case
+that is slower than the baseline by more than the specified relative
+tolerance is reported as a regression, in which case the script exits with a
+nonzero status.
+
+For each suite and case in the current results, the parallel efficiency
+relative to the smallest process count is also reported, assuming a fixed
+problem size (strong scaling).
+"""
+from __future__ import print_function
+
+import argparse
+import glob
+import json
+import os
+import sys
+
+
+def load_results(dirname):
+    """Return a dictionary mapping (suite, case, nprocs) to results."""
+    results = {}
+    for file_name in sorted(glob.glob(os.path.join(dirname, '*.json'))):
+        with open(file_name) as f:
+            data = json.load(f)
+        for case in data['cases']:
+            key = (data['suite'], case['name'], data['nprocs'])
+            results[key] = (data['parameters'], case)
+    return results
+
+
+def compare(baseline, current, tolerance):
+    """Print a comparison table and return the number of regressions."""
+    num_regressions = 0
+    print('%-60s %6s %12s %12s %8s' % ('case', 'nprocs', 'baseline', 'current', 'change'))
+    for key in sorted(current.keys()):
+        suite, name, nprocs = key
+        label = suite + '/' + name
+        params, case = current[key]
+        if key not in baseline:
+            print('%-60s %6d %12s %12.4e %8s' % (label, nprocs, '-', case['time_median'], 'new'))
+            continue
+        base_params, base_case = baseline[key]
+        if base_params != params:
+            print('%-60s %6d %12s %12s %8s' % (label, nprocs, '-', '-', 'params'))
+            continue
+        t0 = base_case['time_median']
+        t1 = case['time_median']
+        change = (t1 - t0) / t0 if t0 > 0.0 else 0.0
+        flag = ''
+        if change > tolerance:
+            flag = '  REGRESSION'
+            num_regressions += 1
+        print('%-60s %6d %12.4e %12.4e %+7.1f%%%s' % (label, nprocs, t0, t1, 100.0 * change, flag))
+    return num_regressions
+
+
+def report_scaling(results):
+    """Print the strong-scaling parallel efficiency of each case."""
+    cases = {}
+    for (suite, name, nprocs), (params, case) in results.items():
+        cases.setdefault((suite, name), {})[nprocs] = case['time_median']
+    print('\n%-60s %6s %12s %10s' % ('case', 'nprocs', 'time', 'efficiency'))
+    for (suite, name) in sorted(cases.keys()):
+        times = cases[(suite, name)]
+        np0 = min(times.keys())
+        t0 = times[np0]
+        for nprocs in sorted(times.keys()):
+            t = times[nprocs]
+            eff = (t0 * np0) / (t * nprocs) if t > 0.0 else 0.0
+            print('%-60s %6d %12.4e %9.1f%%' % (suite + '/' + name, nprocs, t, 100.0 * eff))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare IBAMR benchmark results.')
+    parser.add_argument('baseline_dir')
+    parser.add_argument('current_dir')
+    parser.add_argument('--tolerance', type=float, default=0.1,
+                        help='relative slowdown that is reported as a regression (default 0.1)')
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline_dir)
+    current = load_results(args.current_dir)
+    if not current:
+        print('no benchmark results found in ' + args.current_dir)
+        return 1
+    num_regressions = compare(baseline, current, args.tolerance)
+    report_scaling(current)
+    if num_regressions > 0:
+        print('\n%d case(s) regressed by more than %.0f%%' % (num_regressions, 100.0 * args.tolerance))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
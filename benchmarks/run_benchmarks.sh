@@ -0,0 +1,49 @@
+#!/bin/bash
+## Run the IBAMR benchmark drivers at one or more process counts and collect
+## the JSON results files in a single directory.
+##
+## usage: run_benchmarks.sh [-b build_dir] [-o results_dir] [-n "1 2 4 8"]
+##                          [-m mpirun_command] [suite ...]
+##
+## The drivers must already have been compiled via "make benchmarks" in the
+## build directory.  If no suites are specified, all available suites are run.
+
+set -e
+
+BUILD_DIR=$(pwd)
+RESULTS_DIR=$(pwd)/benchmark_results
+NPROCS="1 2 4"
+MPIRUN=${MPIRUN:-mpirun}
+ALL_SUITES="ConvectiveOperators FAC FEDataManager GhostFill LEInteractor Lagrangian"
+
+while getopts "b:o:n:m:h" opt; do
+    case $opt in
+        b) BUILD_DIR=$OPTARG ;;
+        o) RESULTS_DIR=$OPTARG ;;
+        n) NPROCS=$OPTARG ;;
+        m) MPIRUN=$OPTARG ;;
+        *) sed -n '/^## usage/,/^## build/p' "$0" | sed 's/^## \{0,1\}//'; exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+SUITES=${*:-$ALL_SUITES}
+
+mkdir -p "$RESULTS_DIR"
+RESULTS_DIR=$(cd "$RESULTS_DIR" && pwd)
+
+for suite in $SUITES; do
+    suite_dir=$BUILD_DIR/$suite
+    if [ ! -x "$suite_dir/main2d" ]; then
+        echo "skipping $suite: $suite_dir/main2d not found (run \"make benchmarks\" first)"
+        continue
+    fi
+    for np in $NPROCS; do
+        echo "running $suite on $np process(es)"
+        (cd "$suite_dir" && rm -rf benchmark_results && \
+            $MPIRUN -np "$np" ./main2d input2d > "$RESULTS_DIR/${suite}_np${np}.log" 2>&1) || \
+            { echo "  $suite failed on $np process(es); see $RESULTS_DIR/${suite}_np${np}.log"; continue; }
+        cp "$suite_dir"/benchmark_results/*.json "$RESULTS_DIR"/
+    done
+done
+
+echo "results written to $RESULTS_DIR"
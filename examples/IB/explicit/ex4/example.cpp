@@ -52,6 +52,7 @@
 #include <ibtk/LData.h>
 #include <ibtk/LDataManager.h>
 #include <ibtk/LEInteractor.h>
+#include <ibtk/PhaseProfiler.h>
 #include <ibtk/muParserCartGridFunction.h>
 #include <ibtk/muParserRobinBcCoefs.h>
 
@@ -153,6 +154,10 @@ run_example(int argc, char* argv[])
         const bool dump_timer_data = app_initializer->dumpTimerData();
         const int timer_dump_interval = app_initializer->getTimerDumpInterval();
 
+        const bool dump_profiler_data = app_initializer->dumpProfilerData();
+        const int profiler_dump_interval = app_initializer->getProfilerDumpInterval();
+        const string profiler_dump_dirname = app_initializer->getProfilerDumpDirectory();
+
         // Create major algorithm and data objects that comprise the
         // application.  These objects are configured from the input database
         // and, if this is a restarted run, from the restart database.
@@ -343,6 +348,11 @@ run_example(int argc, char* argv[])
                 pout << "\nWriting timer data...\n\n";
                 TimerManager::getManager()->print(plog);
             }
+            if (dump_profiler_data && (iteration_num % profiler_dump_interval == 0 || last_step))
+            {
+                pout << "\nWriting profiler data...\n\n";
+                PhaseProfiler::getProfiler()->writeData(profiler_dump_dirname, iteration_num);
+            }
             if (dump_postproc_data && (iteration_num % postproc_data_dump_interval == 0 || last_step))
             {
                 output_data(patch_hierarchy,
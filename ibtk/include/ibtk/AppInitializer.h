@@ -200,6 +200,22 @@ public:
      */
     int getTimerDumpInterval() const;
 
+    /*!
+     * Return a boolean value indicating whether to write profiler data.  When
+     * this is true, the PhaseProfiler has been enabled.
+     */
+    bool dumpProfilerData() const;
+
+    /*!
+     * Return the profiler data dump interval.
+     */
+    int getProfilerDumpInterval() const;
+
+    /*!
+     * Return the profiler data dump directory name.
+     */
+    std::string getProfilerDumpDirectory() const;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -259,6 +275,12 @@ private:
      * Timer options.
      */
     int d_timer_dump_interval;
+
+    /*!
+     * Profiler options.
+     */
+    int d_profiler_dump_interval;
+    std::string d_profiler_dump_dirname;
 };
 } // namespace IBTK
 
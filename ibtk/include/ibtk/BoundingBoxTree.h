@@ -0,0 +1,170 @@
+// Filename: BoundingBoxTree.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_BoundingBoxTree
+#define included_IBTK_BoundingBoxTree
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <utility>
+#include <vector>
+
+#include "ibtk/ibtk_utilities.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class BoundingBoxTree is a bounding volume hierarchy of axis-aligned
+ * bounding boxes that supports logarithmic-time queries for the boxes that
+ * intersect a given region.
+ *
+ * The tree is built over a subset of the boxes stored in an array of (lower,
+ * upper) bounds, and the boxes are identified by their indices in that array.
+ * The tree keeps its own copy of the bounds of these boxes.
+ * When the boxes move, the tree may be refit, which recomputes the bounds of
+ * the tree nodes without changing the topology of the tree.  Refitting is
+ * cheaper than rebuilding, but the quality of the tree degrades as the boxes
+ * move relative to each other; refit() returns a measure of that degradation
+ * that may be used to decide when to rebuild the tree.
+ */
+class BoundingBoxTree
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    BoundingBoxTree();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~BoundingBoxTree();
+
+    /*!
+     * \brief Build the tree over the boxes with the specified indices.
+     */
+    void build(const std::vector<std::pair<Point, Point> >& bboxes, const std::vector<unsigned int>& box_ids);
+
+    /*!
+     * \brief Recompute the bounds of the tree nodes from the updated boxes
+     * without changing the structure of the tree.
+     *
+     * \return The ratio of the total extent of the tree nodes (relative to the
+     * extent of the root node) to that at the time the tree was built.  Values much larger than one indicate that the
+     * tree should be rebuilt.
+     */
+    double refit(const std::vector<std::pair<Point, Point> >& bboxes);
+
+    /*!
+     * \brief Remove all boxes from the tree.
+     */
+    void clear();
+
+    /*!
+     * \return Whether the tree contains no boxes.
+     */
+    bool empty() const;
+
+    /*!
+     * \return The indices of the boxes in the tree, in the order in which they
+     * were provided to build().
+     */
+    const std::vector<unsigned int>& getBoxIDs() const;
+
+    /*!
+     * \brief Collect the indices of all boxes that intersect the closed region
+     * [\a x_lower, \a x_upper].  Indices are appended to \a box_ids.
+     */
+    void collectIntersectingBoxes(std::vector<unsigned int>& box_ids, const Point& x_lower, const Point& x_upper) const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    BoundingBoxTree(const BoundingBoxTree& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    BoundingBoxTree& operator=(const BoundingBoxTree& that);
+
+    /*!
+     * \brief Recursively construct the subtree for the sorted boxes in the
+     * range [begin,end) and return the index of its root node.
+     */
+    int buildSubtree(const std::vector<std::pair<Point, Point> >& bboxes, int begin, int end);
+
+    /*!
+     * \brief Store the bounds of the boxes in the order in which they are
+     * referenced by the leaf nodes.
+     */
+    void storeBoxBounds(const std::vector<std::pair<Point, Point> >& bboxes);
+
+    /*!
+     * \return The sum of the extents of the tree nodes relative to the extent
+     * of the root node.
+     */
+    double computeTotalExtent() const;
+
+    /*!
+     * \brief A node of the tree.  Leaf nodes refer to the range [begin,end) of
+     * d_sorted_box_ids; interior nodes have two children.
+     */
+    struct Node
+    {
+        double lower[NDIM], upper[NDIM];
+        int begin, end;
+        int left, right;
+    };
+
+    std::vector<Node> d_nodes;
+    std::vector<unsigned int> d_box_ids, d_sorted_box_ids;
+    std::vector<double> d_sorted_box_bounds;
+    double d_build_extent;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_BoundingBoxTree
@@ -0,0 +1,170 @@
+// Filename: CFInterpolationStencilTable.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_CFInterpolationStencilTable
+#define included_IBTK_CFInterpolationStencilTable
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "Box.h"
+#include "Index.h"
+
+namespace SAMRAI
+{
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+template <int DIM, class TYPE>
+class SideData;
+} // namespace pdat
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class CFInterpolationStencilTable stores a precompiled collection of
+ * linear interpolation stencils that set patch data values at coarse-fine
+ * interfaces.
+ *
+ * Each stencil sets one destination value to a weighted sum of source values.
+ * Stencils are specified in index space when the table is built, typically once
+ * per patch hierarchy configuration, and are flattened into array offsets the
+ * first time that the table is applied to patch data with a particular ghost
+ * box.  Applying the table is therefore a sparse gather that does not require
+ * any interpolation weights to be recomputed.
+ *
+ * \note All stencil values are computed from the source data before any
+ * destination values are modified, so that the source and destination data may
+ * be the same object.
+ */
+class CFInterpolationStencilTable
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    CFInterpolationStencilTable();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~CFInterpolationStencilTable();
+
+    /*!
+     * \brief Remove all stencils from the table.
+     */
+    void clear();
+
+    /*!
+     * \brief Return whether the table contains any stencils.
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Begin a new stencil that sets the value at the specified index.
+     *
+     * For side-centered data, the index is interpreted as the side index with
+     * the specified axis and lower side.  For cell-centered data, the axis must
+     * be zero.
+     */
+    void beginStencil(int axis, const SAMRAI::hier::Index<NDIM>& dst_index);
+
+    /*!
+     * \brief Add a source point to the most recently started stencil.
+     *
+     * The source point uses the same axis as the destination point.
+     */
+    void addStencilPoint(const SAMRAI::hier::Index<NDIM>& src_index, double wgt);
+
+    /*!
+     * \brief Apply the stencils to cell-centered data.
+     */
+    void apply(SAMRAI::pdat::CellData<NDIM, double>& dst_data, const SAMRAI::pdat::CellData<NDIM, double>& src_data);
+
+    /*!
+     * \brief Apply the stencils to side-centered data.
+     */
+    void apply(SAMRAI::pdat::SideData<NDIM, double>& dst_data, const SAMRAI::pdat::SideData<NDIM, double>& src_data);
+
+private:
+    /*!
+     * \brief Stencil offsets flattened for particular destination and source
+     * ghost boxes.
+     */
+    struct Layout
+    {
+        SAMRAI::hier::Box<NDIM> dst_ghost_box, src_ghost_box;
+        bool side_centered;
+        std::vector<int> dst_offsets, src_offsets;
+    };
+
+    /*!
+     * \brief Return the flattened stencil offsets for the specified ghost
+     * boxes, computing them if necessary.
+     */
+    const Layout& getLayout(const SAMRAI::hier::Box<NDIM>& dst_ghost_box,
+                            const SAMRAI::hier::Box<NDIM>& src_ghost_box,
+                            bool side_centered);
+
+    /*!
+     * \brief Apply the stencils to the arrays associated with one data depth.
+     */
+    void applyStencils(double* const dst[NDIM],
+                       const double* const src[NDIM],
+                       const Layout& layout,
+                       bool src_is_dst);
+
+    /*!
+     * Stencils in index space, stored in compressed row format.
+     */
+    std::vector<int> d_axis;
+    std::vector<SAMRAI::hier::Index<NDIM> > d_dst_idx;
+    std::vector<int> d_stencil_ptr;
+    std::vector<SAMRAI::hier::Index<NDIM> > d_src_idx;
+    std::vector<double> d_wgt;
+
+    /*!
+     * Cached flattened offsets and workspace.
+     */
+    std::vector<Layout> d_layouts;
+    std::vector<double> d_vals;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_CFInterpolationStencilTable
@@ -43,6 +43,7 @@
 #include "IntVector.h"
 #include "PatchHierarchy.h"
 #include "RefineOperator.h"
+#include "ibtk/CFInterpolationStencilTable.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "tbox/Pointer.h"
 
@@ -190,7 +191,7 @@ public:
 
     /*!
      * Set the patch hierarchy used in constructing coarse-fine interface
-     * boundary boxes.
+     * boundary boxes and normal extension stencils.
      */
     void setPatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
 
@@ -255,6 +256,12 @@ private:
     std::vector<SAMRAI::hier::CoarseFineBoundary<NDIM>*> d_cf_boundary;
     std::vector<SAMRAI::hier::BoxArray<NDIM>*> d_domain_boxes;
     std::vector<SAMRAI::hier::IntVector<NDIM> > d_periodic_shift;
+
+    /*!
+     * Precompiled normal extension stencils, indexed by patch level number and
+     * patch number.
+     */
+    std::vector<std::vector<CFInterpolationStencilTable> > d_normal_stencils;
 };
 } // namespace IBTK
 
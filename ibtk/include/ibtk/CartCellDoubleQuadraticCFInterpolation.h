@@ -43,6 +43,7 @@
 #include "IntVector.h"
 #include "PatchHierarchy.h"
 #include "RefineOperator.h"
+#include "ibtk/CFInterpolationStencilTable.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "tbox/Pointer.h"
 
@@ -69,6 +70,10 @@ namespace IBTK
  * values for cell-centered double precision patch data via quadratic
  * interpolation in the normal and tangential directions at coarse-fine
  * interfaces.
+ *
+ * The interpolation stencils are compiled for each local patch when the patch
+ * hierarchy is set, and are subsequently applied to all registered patch data
+ * indices without recomputing the interpolation weights.
  */
 class CartCellDoubleQuadraticCFInterpolation : public CoarseFineBoundaryRefinePatchStrategy
 {
@@ -191,7 +196,7 @@ public:
 
     /*!
      * Set the patch hierarchy used in constructing coarse-fine interface
-     * boundary boxes.
+     * boundary boxes and interpolation stencils.
      */
     void setPatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
 
@@ -276,6 +281,12 @@ private:
     std::vector<SAMRAI::hier::CoarseFineBoundary<NDIM>*> d_cf_boundary;
     std::vector<SAMRAI::hier::BoxArray<NDIM>*> d_domain_boxes;
     std::vector<SAMRAI::hier::IntVector<NDIM> > d_periodic_shift;
+
+    /*!
+     * Precompiled tangential interpolation and normal extension stencils,
+     * indexed by patch level number and patch number.
+     */
+    std::vector<std::vector<CFInterpolationStencilTable> > d_tangential_stencils, d_normal_stencils;
 };
 } // namespace IBTK
 
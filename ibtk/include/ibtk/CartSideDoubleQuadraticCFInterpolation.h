@@ -44,6 +44,7 @@
 #include "PatchHierarchy.h"
 #include "RefineOperator.h"
 #include "SideVariable.h"
+#include "ibtk/CFInterpolationStencilTable.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "tbox/Pointer.h"
 
@@ -68,6 +69,12 @@ namespace IBTK
  * values for side-centered double precision patch data via quadratic
  * interpolation in the normal and tangential directions at coarse-fine
  * interfaces.
+ *
+ * By default, the interpolation stencils are compiled for each local patch
+ * when the patch hierarchy is set, and are subsequently applied to all
+ * registered patch data indices without recomputing the interpolation weights.
+ * The original Fortran kernels, which recompute the weights on every call, may
+ * be used instead via setUsePrecompiledStencils().
  */
 class CartSideDoubleQuadraticCFInterpolation : public CoarseFineBoundaryRefinePatchStrategy
 {
@@ -173,6 +180,14 @@ public:
      */
     void setConsistentInterpolationScheme(bool consistent_type_2_bdry);
 
+    /*!
+     * \brief Whether to apply precompiled interpolation stencils (the default)
+     * or to use the Fortran interpolation kernels.
+     *
+     * \note This function must be called before setPatchHierarchy().
+     */
+    void setUsePrecompiledStencils(bool use_precompiled_stencils);
+
     /*!
      * \brief Reset the patch data index operated upon by this class.
      */
@@ -190,7 +205,7 @@ public:
 
     /*!
      * Set the patch hierarchy used in constructing coarse-fine interface
-     * boundary boxes.
+     * boundary boxes and interpolation stencils.
      */
     void setPatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
 
@@ -231,6 +246,15 @@ private:
      */
     CartSideDoubleQuadraticCFInterpolation& operator=(const CartSideDoubleQuadraticCFInterpolation& that);
 
+    /*!
+     * Set the coarse-fine interface ghost cell values using the Fortran
+     * tangential interpolation and normal extension kernels.
+     */
+    void applyTangentialInterpolationKernels(SAMRAI::hier::Patch<NDIM>& fine,
+                                             const SAMRAI::hier::Patch<NDIM>& coarse,
+                                             const SAMRAI::hier::IntVector<NDIM>& ratio);
+    void applyNormalExtensionKernels(SAMRAI::hier::Patch<NDIM>& patch, const SAMRAI::hier::IntVector<NDIM>& ratio);
+
     /*!
      * The patch data indices corresponding to the "scratch" patch data that is
      * operated on by this class.
@@ -243,6 +267,12 @@ private:
      */
     bool d_consistent_type_2_bdry;
 
+    /*!
+     * Boolean value indicating whether the precompiled interpolation stencils
+     * or the Fortran interpolation kernels are used.
+     */
+    bool d_use_precompiled_stencils;
+
     /*!
      * Refine operator employed to fill coarse grid ghost cell values.
      */
@@ -255,6 +285,12 @@ private:
     std::vector<SAMRAI::hier::CoarseFineBoundary<NDIM>*> d_cf_boundary;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, int> > d_sc_indicator_var;
     int d_sc_indicator_idx;
+
+    /*!
+     * Precompiled tangential interpolation and normal extension stencils,
+     * indexed by patch level number and patch number.
+     */
+    std::vector<std::vector<CFInterpolationStencilTable> > d_tangential_stencils, d_normal_stencils;
 };
 } // namespace IBTK
 
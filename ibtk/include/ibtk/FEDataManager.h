@@ -54,6 +54,8 @@
 #include "VariableContext.h"
 #include "boost/multi_array.hpp"
 #include "boost/unordered_map.hpp"
+#include "ibtk/BoundingBoxTree.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
@@ -89,6 +91,7 @@ template <typename T>
 class LinearSolver;
 template <typename T>
 class NumericVector;
+class Partitioner;
 template <typename T>
 class SparseMatrix;
 } // namespace libMesh
@@ -349,6 +352,19 @@ public:
      */
     void reinitElementMappings();
 
+    /*!
+     * \brief Repartition the mesh using the specified partitioner, and
+     * redistribute the data of all of the systems of the equation systems
+     * object accordingly.
+     *
+     * \note This function requires a replicated (serial) mesh.  The mappings
+     * from elements to Cartesian grid patches must be reinitialized after the
+     * mesh is repartitioned.
+     *
+     * \see reinitElementMappings
+     */
+    void repartitionMesh(libMesh::Partitioner& partitioner);
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -544,9 +560,40 @@ public:
 
     /*!
      * \brief Update the cell workload estimate.
+     *
+     * The workload per cell is defined by
+     *
+     *    workload(i) = 1 + qp_work*qp_count(i)
+     *
+     * in which qp_work defaults to the value 1.
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Set the workload weight of a quadrature point relative to that of
+     * a Cartesian grid cell.
+     */
+    void setQuadPointWorkloadWeight(double qp_work);
+
+    /*!
+     * \brief Register a workload cost model that is notified of the
+     * synchronizing operations performed while spreading and interpolating, so
+     * that the time spent in those operations is excluded from the measured
+     * costs.
+     *
+     * \note The L2 projections are also treated as synchronizing operations,
+     * because their cost is determined by the partitioning of the FE mesh
+     * rather than by the distribution of the patches.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<WorkloadCostModel> workload_cost_model);
+
+    /*!
+     * \return The number of quadrature points in the local patches of the
+     * patch hierarchy, as determined by the most recent call to
+     * updateWorkloadEstimates().
+     */
+    double getNumberOfLocalQuadPoints() const;
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.  The level number indicates that of
@@ -690,6 +737,17 @@ private:
      */
     std::vector<std::pair<Point, Point> >* computeActiveElementBoundingBoxes();
 
+    /*!
+     * Update the bounding box tree of the active elements.  The tree is refit
+     * in place when the set of active elements is unchanged and the boxes
+     * have not grown too much since the tree was last built; otherwise, the
+     * tree is rebuilt.
+     *
+     * \note This method assumes that computeActiveElementBoundingBoxes() has
+     * already been called.
+     */
+    void updateActiveElementBoundingBoxTree();
+
     /*!
      * Collect all of the active elements which are located within a local
      * Cartesian grid patch grown by the specified ghost cell width.
@@ -776,6 +834,13 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
+    double d_qp_work, d_num_local_quad_points;
+
+    /*
+     * Optional model of the measured costs that is used to determine the
+     * workload estimates.
+     */
+    SAMRAI::tbox::Pointer<WorkloadCostModel> d_workload_cost_model;
 
     /*
      * The default kernel functions and quadrature rule used to mediate
@@ -803,6 +868,8 @@ private:
     std::vector<std::vector<libMesh::Elem*> > d_active_patch_elem_map;
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
     std::vector<std::pair<Point, Point> > d_active_elem_bboxes;
+    BoundingBoxTree d_active_elem_bbox_tree;
+    std::vector<libMesh::Elem*> d_active_elem_ptrs;
 
     /*
      * Ghost vectors for the various equation systems.
@@ -0,0 +1,146 @@
+// Filename: FEPatchPartitioner.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_FEPatchPartitioner
+#define included_IBTK_FEPatchPartitioner
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "libmesh/auto_ptr.h"
+#include "libmesh/id_types.h"
+#include "libmesh/partitioner.h"
+
+namespace IBTK
+{
+class FEDataManager;
+} // namespace IBTK
+
+namespace libMesh
+{
+class MeshBase;
+} // namespace libMesh
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class FEPatchPartitioner is a libMesh::Partitioner that aligns the
+ * parallel distribution of a finite element mesh with that of the Cartesian
+ * grid patches on which the mesh is embedded.
+ *
+ * Each active element is assigned to the MPI process that owns the patch that
+ * contains the centroid of the element in the current configuration, which is
+ * obtained from the coordinates system of the associated FEDataManager.  With
+ * this assignment, most of the data required to spread and interpolate on the
+ * elements are local, and so the ghost data transferred in those operations are
+ * greatly reduced.
+ *
+ * Because the patch assignment alone can badly unbalance the work done by the
+ * process-local element computations, the number of elements assigned to each
+ * process is capped at (1 + max_imbalance) times the average number of
+ * elements per process.  Excess elements are reassigned to the processes with
+ * the fewest elements.
+ *
+ * \note This partitioner requires a replicated (serial) mesh, and it is
+ * intended to be used only after the patch hierarchy has been initialized.
+ */
+class FEPatchPartitioner : public libMesh::Partitioner
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    FEPatchPartitioner(FEDataManager* fe_data_manager, double max_imbalance = 0.1);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~FEPatchPartitioner();
+
+    /*!
+     * \brief Create a copy of the partitioner.
+     */
+    libMesh::UniquePtr<libMesh::Partitioner> clone() const;
+
+    /*!
+     * \brief Compute the fraction of the active elements of the mesh whose
+     * current processor assignments differ from those that would be computed by
+     * the partitioner.
+     *
+     * \note This is a collective operation.
+     */
+    double computeMisalignedElementFraction(const libMesh::MeshBase& mesh) const;
+
+protected:
+    /*!
+     * \brief Assign the active elements of the mesh to processors.
+     */
+    void _do_partition(libMesh::MeshBase& mesh, unsigned int n);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    FEPatchPartitioner();
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    FEPatchPartitioner& operator=(const FEPatchPartitioner& that);
+
+    /*!
+     * \brief Compute the processor assignments of the active elements of the
+     * mesh, which are indexed by element id.
+     */
+    void computeElementAssignments(std::vector<libMesh::processor_id_type>& elem_procs,
+                                   const libMesh::MeshBase& mesh,
+                                   unsigned int n) const;
+
+    FEDataManager* const d_fe_data_manager;
+    const double d_max_imbalance;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_FEPatchPartitioner
@@ -95,6 +95,14 @@ namespace IBTK
  * \note All specified variable descriptor indices must refer to
  * SAMRAI::hier::Variable / SAMRAI::hier::VariableContext pairs that have been
  * registered with the SAMRAI::hier::VariableDatabase.
+ *
+ * \note When IBTK is configured with --enable-openmp, the patch operations on
+ * each level are distributed among the OpenMP threads of each MPI process.
+ * Each patch is processed by a single thread, and none of the operations
+ * accumulates values across patches, so the results are independent of the
+ * number of threads.  With OMP_NUM_THREADS=1, or without OpenMP, the patches
+ * are processed serially as before.  strain_rate() and the computation of the
+ * control volume weights are always performed serially.
  */
 class HierarchyMathOps : public SAMRAI::tbox::DescribedClass
 {
@@ -133,6 +141,14 @@ public:
      */
     void resetLevels(int coarsest_ln, int finest_ln);
 
+    /*!
+     * \brief Set whether the patch operations on each level may be distributed
+     * among OpenMP threads.
+     *
+     * \note This setting has no effect unless IBTK is compiled with OpenMP.
+     */
+    void setUseThreadedPatchLoops(bool use_threaded_patch_loops);
+
     //\}
 
     /*!
@@ -848,6 +864,40 @@ public:
                     int src2_idx = -1,
                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var = NULL);
 
+    /*!
+     * \brief Compute the action of the staggered-grid (MAC) Stokes operator.
+     *
+     * Sets dst_u = C src_u + D L src_u + gamma grad src_p and dst_p = delta
+     * div src_u, in which C and D are specified by the
+     * SAMRAI::solv::PoissonSpecifications object poisson_spec.
+     *
+     * The result is the same as that obtained by the sequence grad(),
+     * laplace(), and div() (with coarse-fine boundary synchronization of
+     * src_u), but the patch data are visited in a single sweep on the finest
+     * level.  On coarser levels, the divergence is recomputed after src_u has
+     * been synchronized with the next finer level.
+     *
+     * \note The present implementation of this operator \em requires that
+     * damping factor C and diffusivity D be spatially constant and
+     * scalar-valued.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void stokes(int dst_u_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst_u_var,
+                int dst_p_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > dst_p_var,
+                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                int src_u_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src_u_var,
+                int src_p_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > src_p_var,
+                SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+                double src_ghost_fill_time,
+                double gamma = 1.0,
+                double delta = -1.0);
+
     /*!
      * \brief Compute dst = alpha src1 + beta src2, pointwise.
      *
@@ -1299,6 +1349,9 @@ private:
     int d_wgt_cc_idx, d_wgt_fc_idx, d_wgt_sc_idx;
     bool d_using_wgt_cc, d_using_wgt_fc, d_using_wgt_sc;
     double d_volume;
+
+    // Whether to distribute the patch operations among OpenMP threads.
+    bool d_use_threaded_patch_loops;
 };
 } // namespace IBTK
 
@@ -61,6 +61,7 @@
 #include "ibtk/LNodeSetVariable.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscao.h"
 #include "petscvec.h"
@@ -801,6 +802,37 @@ public:
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Set the workload weight of a Lagrangian node relative to that of a
+     * Cartesian grid cell, i.e., the parameter beta_work used by
+     * updateWorkloadEstimates().
+     */
+    void setNodeWorkloadWeight(double beta_work);
+
+    /*!
+     * \brief Register a workload cost model that is notified of the
+     * synchronizing operations performed while spreading and interpolating, so
+     * that the time spent in those operations is excluded from the measured
+     * costs.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<WorkloadCostModel> workload_cost_model);
+
+    /*!
+     * \brief Get the workload cost model registered with this object, if any.
+     */
+    SAMRAI::tbox::Pointer<WorkloadCostModel> getWorkloadCostModel() const;
+
+    /*!
+     * \brief Set whether restart data are written in a form that allows the
+     * Lagrangian data to be restored on a different number of MPI processes.
+     *
+     * When enabled, each LData vector is additionally gathered, in the
+     * Lagrangian ordering, on the root MPI process when restart data are
+     * written.  This requires O(N) memory and I/O on the root process at every
+     * restart dump, and so it is disabled by default.
+     */
+    void setWriteRedistributableRestartData(bool write_redistributable_restart_data);
+
     /*!
      * \brief Update the count of nodes per cell.
      *
@@ -1017,6 +1049,14 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Recompute the distribution of the Lagrangian nodes from the patch data
+     * restored from restart, and rebuild the Lagrangian data from the values
+     * stored in the Lagrangian ordering.  This is used when the restart data
+     * were written by a different number of MPI processes.
+     */
+    void restoreRedistributedRestartData();
+
     /*!
      * Static data members used to control access to and destruction of
      * singleton data manager instance.
@@ -1077,6 +1117,12 @@ private:
     int d_workload_idx;
     bool d_output_workload;
 
+    /*
+     * Optional model of the measured costs that is used to determine the
+     * workload estimates.
+     */
+    SAMRAI::tbox::Pointer<WorkloadCostModel> d_workload_cost_model;
+
     /*
      * SAMRAI::hier::Variable pointer and patch data descriptor indices for the
      * cell variable used to keep track of the count of the nodes in each cell
@@ -1213,6 +1259,15 @@ private:
      */
     std::vector<std::vector<int> > d_nonlocal_petsc_indices;
 
+    /*!
+     * Data used to restore the Lagrangian data when the restart data were
+     * written by a different number of MPI processes.  The values, which are in
+     * the Lagrangian ordering, are stored only on the root MPI process.
+     */
+    bool d_write_redistributable_restart_data, d_redistribute_restart_data;
+    std::vector<std::map<std::string, int> > d_restart_ldata_depths;
+    std::vector<std::map<std::string, std::vector<double> > > d_restart_ldata_vals;
+
     //\}
 };
 } // namespace IBTK
@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <stddef.h>
 #include <map>
 #include <set>
 #include <string>
@@ -111,6 +112,44 @@ public:
 
     //\}
 
+    /*!
+     * \brief Set the number of MPI processes that write their data to each
+     * Silo file.
+     *
+     * By default, each MPI process writes its data to its own file.  When
+     * several processes share a file, they take turns appending their data to
+     * the file, each in its own directory, which reduces the number of files
+     * created for each visualization dump.
+     */
+    void setNumberOfProcessorsPerFile(int nprocs_per_file);
+
+    /*!
+     * \brief Enable or disable asynchronous output.
+     *
+     * When asynchronous output is enabled, writePlotData() copies the local
+     * Lagrangian data into memory buffers, completes all required
+     * communication, and hands the buffers to a helper thread that writes the
+     * Silo files while the caller continues.  Data are written synchronously
+     * on all processes when the buffered data on any process would exceed \a
+     * max_buffer_bytes or when several processes share each Silo file.
+     *
+     * At most one asynchronous write is pending at any time.  A pending write is
+     * completed before the next call to writePlotData(), before any of the
+     * registered data are modified, and when the object is destroyed.
+     *
+     * \note The helper thread does not make any MPI calls, and it does not
+     * abort the program when an error occurs.  Errors encountered by the helper
+     * thread are reported by waitForPendingOutput().
+     */
+    void setAsynchronousOutput(bool async_output, size_t max_buffer_bytes = 256 * 1024 * 1024);
+
+    /*!
+     * \brief Block until any pending asynchronous write has completed.
+     *
+     * An unrecoverable error is raised if the pending write failed.
+     */
+    void waitForPendingOutput();
+
     /*!
      * \brief Register or update a range of Lagrangian indices that are to be
      * visualized as a cloud of marker particles.
@@ -261,6 +300,27 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Buffered plot data.
+     */
+    struct PlotData;
+
+    /*!
+     * Write the buffered local data to the local Silo file.
+     */
+    void writeLocalPlotData(const PlotData& plot_data);
+
+    /*!
+     * Write the summary Silo file and update the VisIt dumps file.  This is
+     * done only on the root MPI process.
+     */
+    void writeSummaryPlotData(const PlotData& plot_data);
+
+    /*!
+     * Entry point for the helper thread that writes the pending plot data.
+     */
+    static void* writePlotDataAsync(void* writer);
+
     /*
      * The object name is used as a handle to databases stored in restart files
      * and for error reporting purposes.  The boolean is used to control restart
@@ -274,6 +334,19 @@ private:
      */
     std::string d_dump_directory_name;
 
+    /*
+     * The number of MPI processes that share each Silo file.
+     */
+    int d_nprocs_per_file;
+
+    /*
+     * Asynchronous output settings and the plot data that are being written by
+     * the helper thread, if any.
+     */
+    bool d_async_output;
+    size_t d_async_output_max_bytes;
+    PlotData* d_pending_plot_data;
+
     /*
      * Time step number (passed in by user).
      */
@@ -0,0 +1,255 @@
+// Filename: PETScBlockKrylovSolver.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PETScBlockKrylovSolver
+#define included_IBTK_PETScBlockKrylovSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "petscksp.h"
+#include "petscmat.h"
+#include "petscpc.h"
+#include "petscvec.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PETScBlockKrylovSolver solves linear systems of the form
+ * \f$AX=B\f$ with several right-hand sides \f$B = [b_1, \ldots, b_k]\f$ that
+ * share the same PETSc Mat \f$A\f$ using a restarted block GMRES method.
+ *
+ * All right-hand sides are advanced in a single block Krylov subspace, so that
+ * each operator application contributes to the solution of every system.  For
+ * expensive matrix-free operators (e.g., operators that require a fluid solve
+ * per application) this typically requires substantially fewer operator
+ * applications than solving the systems one at a time.
+ *
+ * An optional preconditioner is applied on the right (flexible variant), so
+ * that the reported residuals are the true (unpreconditioned) residuals.  The
+ * residuals \f$b_i - A x_i\f$ are recomputed explicitly at the end of each
+ * restart cycle, which costs one operator application per unconverged system,
+ * and convergence is only declared on the basis of these recomputed residuals.
+ * Systems that have converged at the start of a restart cycle are removed from
+ * the block.
+ *
+ * A block of \f$k\f$ systems with restart length \f$m\f$ requires
+ * \f$(m+1)k\f$ basis vectors, and \f$(2m+1)k\f$ if a preconditioner is
+ * used, each of the size of the solution vectors.  To bound the memory use, the
+ * number of block steps per restart cycle is reduced as needed so that the
+ * total number of basis vectors does not exceed a prescribed maximum (see
+ * setMaxNumBasisVectors()).
+ *
+ * The solver may be configured directly or from an existing PETSc KSP object,
+ * in which case the operator, preconditioner, tolerances, restart length, and
+ * initial guess settings of the KSP are used.  In the latter case, the
+ * following options are also read from the PETSc options database using the
+ * options prefix of the KSP:
+ *
+ * - <tt>-ksp_block_max_basis_vectors \<n\></tt>: see setMaxNumBasisVectors()
+ * - <tt>-ksp_block_check_separate_solves</tt>: see setCheckSeparateSolves()
+ */
+class PETScBlockKrylovSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    PETScBlockKrylovSolver(const std::string& object_name);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PETScBlockKrylovSolver();
+
+    /*!
+     * \brief Configure the solver using the operator, preconditioner,
+     * tolerances, restart length, and initial guess settings of a PETSc KSP
+     * object.
+     *
+     * \note The operators of the KSP object must be set.
+     */
+    void setFromKSP(KSP petsc_ksp);
+
+    /*!
+     * \brief Set the linear operator.
+     */
+    void setOperator(Mat petsc_mat);
+
+    /*!
+     * \brief Set the (right) preconditioner, or NULL to solve the
+     * unpreconditioned systems.
+     */
+    void setPreconditioner(PC petsc_pc);
+
+    /*!
+     * \brief Set the convergence tolerances.  System \f$i\f$ is considered
+     * converged once \f$\|b_i - A x_i\| \le \max(\mbox{rtol}\|b_i\|,
+     * \mbox{atol})\f$.
+     */
+    void setTolerances(double rel_residual_tol, double abs_residual_tol, int max_iterations);
+
+    /*!
+     * \brief Set the maximum number of block iterations between restarts.
+     *
+     * \note The solver stores (restart+1) basis vectors per right-hand side, or
+     * (2*restart+1) if a preconditioner is used, subject to the limit set by
+     * setMaxNumBasisVectors().
+     */
+    void setRestart(int restart);
+
+    /*!
+     * \brief Set the maximum total number of basis vectors that may be
+     * allocated by the solver.  Each restart cycle takes at least one block
+     * step, so that at least 2k (or 3k if a preconditioner is used) basis
+     * vectors are allocated for a block of k systems.
+     *
+     * By default, at most 200 basis vectors are allocated.  A nonpositive
+     * value removes the limit.
+     */
+    void setMaxNumBasisVectors(int max_num_basis_vecs);
+
+    /*!
+     * \brief Set whether the block solutions are checked against solutions
+     * obtained by solving each system separately.
+     *
+     * This is a diagnostic: it roughly doubles the cost of each solve.  The
+     * differences between the solutions and the operator applications
+     * required by both approaches are written to the log, and a warning is
+     * issued if the block solve fails where the separate solves succeed or if
+     * the solutions differ by more than the square root of the relative
+     * residual tolerance.
+     */
+    void setCheckSeparateSolves(bool check_separate_solves);
+
+    /*!
+     * \brief Set whether the initial values of the solution vectors are used as
+     * the initial guess.
+     */
+    void setInitialGuessNonzero(bool initial_guess_nonzero);
+
+    /*!
+     * \brief Enable or disable logging.
+     */
+    void setLoggingEnabled(bool enable_logging);
+
+    /*!
+     * \brief Solve the linear systems \f$Ax_i=b_i\f$.
+     *
+     * \return \p true if all systems converged to the specified tolerances, \p
+     * false otherwise.
+     */
+    bool solveSystems(const std::vector<Vec>& x, const std::vector<Vec>& b);
+
+    /*!
+     * \brief Return the number of block iterations performed during the most
+     * recent solve.
+     */
+    int getNumIterations() const;
+
+    /*!
+     * \brief Return the number of operator applications performed during the
+     * most recent solve.
+     */
+    int getNumOperatorApplications() const;
+
+    /*!
+     * \brief Return the largest residual norm at the end of the most recent
+     * solve.
+     */
+    double getResidualNorm() const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PETScBlockKrylovSolver();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PETScBlockKrylovSolver(const PETScBlockKrylovSolver& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PETScBlockKrylovSolver& operator=(const PETScBlockKrylovSolver& that);
+
+    /*!
+     * \brief Orthogonalize \em w against the first \em n vectors of \em V using
+     * classical Gram-Schmidt with one step of reorthogonalization.  The
+     * projection coefficients are returned in \em h.
+     */
+    static void orthogonalize(Vec w, int n, Vec* V, std::vector<PetscScalar>& h);
+
+    /*!
+     * \brief Solve the systems by solving each one separately and compare the
+     * results to the block solutions \em x.  The initial guesses are taken
+     * from \em x0 if the initial guess is nonzero.
+     */
+    void checkSeparateSolves(const std::vector<Vec>& x,
+                             const std::vector<Vec>& x0,
+                             const std::vector<Vec>& b,
+                             bool block_converged);
+
+    std::string d_object_name;
+    Mat d_petsc_mat;
+    PC d_petsc_pc;
+    double d_rel_residual_tol, d_abs_residual_tol;
+    int d_max_iterations, d_restart, d_max_num_basis_vecs;
+    bool d_initial_guess_nonzero;
+    bool d_check_separate_solves;
+    bool d_enable_logging;
+    int d_current_iterations, d_current_applications;
+    double d_current_residual_norm;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PETScBlockKrylovSolver
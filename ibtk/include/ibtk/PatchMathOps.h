@@ -72,6 +72,14 @@ namespace IBTK
  *
  * \note Coarse-fine interface discretizations are handled in an implicit manner
  * via ghost cells.
+ *
+ * \note PatchMathOps objects are stateless, and operations on distinct patches
+ * may be performed concurrently by multiple threads.  The exception is
+ * strain_rate() with separate diagonal and off-diagonal outputs, which
+ * allocates temporary patch data.  The Fortran kernels do not use SAVE or
+ * COMMON data, but concurrent calls also require their local variables to be
+ * allocated on the stack.  When IBTK is configured with --enable-openmp, the
+ * Fortran sources are compiled with the OpenMP flag, which ensures this.
  */
 class PatchMathOps : public SAMRAI::tbox::DescribedClass
 {
@@ -419,6 +427,24 @@ public:
                     int m = 0,
                     int n = 0) const;
 
+    /*!
+     * \brief Computes the action of the staggered-grid Stokes operator,
+     * dst_u = alpha L src_u + beta src_u + gamma grad src_p and dst_p = delta
+     * div src_u, in a single sweep over the patch.
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D) for the
+     * Laplacian and the standard MAC gradient and divergence.
+     */
+    void stokes(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst_u,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst_p,
+                double alpha,
+                double beta,
+                double gamma,
+                double delta,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src_u,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src_p,
+                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
     /*!
      * \brief Compute dst_i = alpha src1_j + beta src2_k, pointwise.
      */
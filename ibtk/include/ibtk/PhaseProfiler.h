@@ -0,0 +1,306 @@
+// Filename: PhaseProfiler.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PhaseProfiler
+#define included_IBTK_PhaseProfiler
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// MACRO DEFINITIONS ////////////////////////////
+
+#define IBTK_PROFILER_SCOPE_VAR_NAME2(line) ibtk_profiler_scope_##line
+#define IBTK_PROFILER_SCOPE_VAR_NAME(line) IBTK_PROFILER_SCOPE_VAR_NAME2(line)
+
+/*!
+ * Open a profiler scope with the specified name that is closed at the end of
+ * the enclosing C++ block.
+ */
+#define IBTK_PROFILER_SCOPE(name) IBTK::PhaseProfiler::ScopeGuard IBTK_PROFILER_SCOPE_VAR_NAME(__LINE__)(name)
+
+/*!
+ * Add the specified value to a counter of the innermost open profiler scope.
+ * The value is not evaluated when the profiler is disabled.
+ */
+#define IBTK_PROFILER_COUNT(counter, value)                                                                            \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (IBTK::PhaseProfiler::isEnabled())                                                                          \
+            IBTK::PhaseProfiler::getProfiler()->addToCounter(IBTK::PhaseProfiler::counter, (value));                   \
+    } while (0)
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PhaseProfiler is a singleton class that records the time spent
+ * in nested, named scopes (e.g., time step > integrator phase > solver >
+ * kernel) along with per-scope call counts and optional counters.
+ *
+ * Unlike the timers managed by SAMRAI::tbox::TimerManager, which are reported
+ * as flat, per-process tables, the profiler keeps a tree of scopes for each
+ * MPI process.  When the profile data are written, the trees from all
+ * processes are merged, and the minimum, mean, and maximum times over all
+ * processes along with the load imbalance (the ratio of the maximum time to
+ * the mean time) are computed for each scope.  The results are written in JSON
+ * format, and the individual scope instances may optionally be written as a
+ * Chrome trace file (one "process" per MPI rank) that may be viewed with
+ * chrome://tracing or Perfetto.
+ *
+ * Scopes are opened and closed via the IBTK_PROFILER_SCOPE macro, e.g.,
+ *
+ \code
+ void Foo::bar()
+ {
+     IBTK_PROFILER_SCOPE("Foo::bar");
+     ...
+     IBTK_PROFILER_COUNT(KRYLOV_ITERATIONS_COUNTER, num_iterations);
+ }
+ \endcode
+ *
+ * When the profiler is disabled (the default), opening a scope or updating a
+ * counter costs a single test of a static flag, so that the instrumentation
+ * may be left in production code.
+ *
+ * Sample input database entries:
+ *
+ \verbatim
+ enable_trace = FALSE       // whether to record individual scope instances
+ max_trace_events = 100000  // maximum number of recorded instances per process
+ \endverbatim
+ *
+ * The profiler is normally configured by class AppInitializer via the
+ * profiler_dump_interval and profiler_dump_dirname entries of the Main
+ * database and the entries of the PhaseProfiler database.
+ */
+class PhaseProfiler
+{
+public:
+    /*!
+     * \brief Enumerated type for the optional per-scope counters.
+     */
+    enum Counter
+    {
+        BYTES_COUNTER = 0,
+        MARKERS_COUNTER = 1,
+        CELLS_COUNTER = 2,
+        KRYLOV_ITERATIONS_COUNTER = 3,
+        NUM_COUNTERS = 4
+    };
+
+    /*!
+     * \brief Class ScopeGuard opens a profiler scope upon construction and
+     * closes it upon destruction.
+     */
+    class ScopeGuard
+    {
+    public:
+        /*!
+         * \brief Open a scope when the profiler is enabled.
+         */
+        explicit ScopeGuard(const char* name) : d_active(s_enabled)
+        {
+            if (d_active) getProfiler()->startScope(name);
+        } // ScopeGuard
+
+        /*!
+         * \brief Close the scope opened by the constructor.
+         */
+        ~ScopeGuard()
+        {
+            if (d_active) getProfiler()->stopScope();
+        } // ~ScopeGuard
+
+    private:
+        ScopeGuard(const ScopeGuard& from);
+        ScopeGuard& operator=(const ScopeGuard& that);
+
+        const bool d_active;
+    };
+
+    /*!
+     * Return a pointer to the instance of the profiler.  Access to PhaseProfiler
+     * objects is mediated by the getProfiler() function.
+     *
+     * Note that when the profiler is accessed for the first time, the
+     * freeProfiler static method is registered with the ShutdownRegistry
+     * class.  Consequently, the allocated profiler is freed at program
+     * completion.  Thus, users of this class do not explicitly allocate or
+     * deallocate the profiler instance.
+     *
+     * \return A pointer to the profiler instance.
+     */
+    static PhaseProfiler* getProfiler();
+
+    /*!
+     * Deallocate the profiler instance.  It is not necessary to call this
+     * function at program termination since it is automatically called by the
+     * ShutdownRegistry class.
+     */
+    static void freeProfiler();
+
+    /*!
+     * \brief Indicate whether the profiler is enabled.
+     */
+    static inline bool isEnabled()
+    {
+        return s_enabled;
+    } // isEnabled
+
+    /*!
+     * \brief Set the profiler options from the specified input database and
+     * start recording profile data.
+     *
+     * \note This is a collective operation.
+     */
+    void enable(
+        SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = SAMRAI::tbox::Pointer<SAMRAI::tbox::Database>());
+
+    /*!
+     * \brief Stop recording profile data.
+     */
+    void disable();
+
+    /*!
+     * \brief Open a new scope nested within the innermost open scope.
+     */
+    void startScope(const char* name);
+
+    /*!
+     * \brief Close the innermost open scope.
+     */
+    void stopScope();
+
+    /*!
+     * \brief Add the specified value to a counter of the innermost open scope.
+     */
+    void addToCounter(Counter counter, double value);
+
+    /*!
+     * \brief Clear all recorded profile data.  Open scopes remain open.
+     */
+    void reset();
+
+    /*!
+     * \brief Write the profile data to <dirname>/profile.<timestep_num>.json
+     * and, if tracing is enabled, the recorded scope instances to
+     * <dirname>/trace.<timestep_num>.json.  A summary of the profile data is
+     * also written to plog.
+     *
+     * Only scopes that have been closed at least once are included in the
+     * output, and the recorded scope instances are cleared once they have
+     * been written.
+     *
+     * \note This is a collective operation.
+     */
+    void writeData(const std::string& dirname, int timestep_num);
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    PhaseProfiler();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PhaseProfiler();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PhaseProfiler(const PhaseProfiler& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PhaseProfiler& operator=(const PhaseProfiler& that);
+
+    /*!
+     * Static data members used to control access to and destruction of the
+     * profiler instance.
+     */
+    static PhaseProfiler* s_profiler_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+
+    /*!
+     * \brief The data associated with a node of the local scope tree.  Node 0 is
+     * the root of the tree and does not correspond to a user scope.
+     */
+    struct ScopeNode
+    {
+        std::string name;
+        int parent;
+        std::vector<int> children;
+        double num_calls, total_time, start_time;
+        double counters[NUM_COUNTERS];
+    };
+    std::vector<ScopeNode> d_nodes;
+    int d_current_node;
+
+    /*
+     * Recorded scope instances, stored as (node, start time, duration) triples.
+     */
+    bool d_enable_trace;
+    int d_max_trace_events;
+    std::vector<double> d_trace_events;
+    int d_num_dropped_trace_events;
+
+    /*
+     * The (synchronized) wall-clock time at which the profiler was enabled.
+     */
+    double d_start_time;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PhaseProfiler
@@ -38,6 +38,7 @@
 #include <stddef.h>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ibtk/PoissonFACPreconditioner.h"
@@ -96,6 +97,20 @@ namespace IBTK
  * By default, the class is configured to solve the Poisson problem \f$
  * -\nabla^2 u = f \f$, subject to homogeneous Dirichlet boundary conditions.
  *
+ * In addition to Gauss-Seidel smoothers, this class provides a Jacobi
+ * preconditioned Chebyshev polynomial smoother (\c "CHEBYSHEV").  The
+ * Chebyshev smoother has no ordering dependence, and it targets the part of
+ * the spectrum of the Jacobi preconditioned operator that lies in \f$
+ * [\lambda_{\max} \cdot \mbox{chebyshev\_eig\_ratio}, \lambda_{\max}]
+ * \f$, in which the bound \f$ \lambda_{\max} \f$ is estimated once per
+ * level from the (constant coefficient) discrete operator.
+ *
+ * The \c "PATCH_GAUSS_SEIDEL" and \c "CHEBYSHEV" smoothers may also be run in
+ * a communication-avoiding mode by setting \p sweeps_per_ghost_fill to a value
+ * \f$ s > 1 \f$.  In this mode, \f$ s \f$ layers of ghost cells are filled
+ * with a single halo exchange, and \f$ s \f$ sweeps are performed before the
+ * next exchange.  See class CCPoissonPointRelaxationFACOperator.
+ *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
@@ -106,6 +121,8 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ sweeps_per_ghost_fill = 1                    // number of sweeps performed per halo exchange
+ chebyshev_eig_ratio = 0.1                    // lower/upper eigenvalue bound ratio used by "CHEBYSHEV"
  coarse_solver_db = { ... }                   // SAMRAI::tbox::Database for initializing coarse
  level solver
  \endverbatim
@@ -150,6 +167,7 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV"
      */
     void setSmootherType(const std::string& smoother_type);
 
@@ -257,6 +275,34 @@ private:
      */
     SCPoissonPointRelaxationFACOperator& operator=(const SCPoissonPointRelaxationFACOperator& that);
 
+    /*!
+     * \brief Allocate the smoother scratch data and compute the eigenvalue
+     * bounds, patch boundary boxes, and communication schedules used by the
+     * Chebyshev and communication-avoiding smoothers.
+     */
+    void initializeSmootherScratchData(int coarsest_reset_ln, int finest_reset_ln);
+
+    /*!
+     * \brief Perform a given number of Gauss-Seidel or Chebyshev sweeps on the
+     * error using the smoother scratch data, filling the ghost cells of that
+     * data once every d_sweeps_per_ghost_fill sweeps.
+     */
+    void smoothErrorDeepGhost(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error,
+                              const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual,
+                              int level_num,
+                              int num_sweeps,
+                              bool use_chebyshev);
+
+    /*!
+     * \brief Fill the ghost cells of the smoother scratch data on a single
+     * level of the patch hierarchy without using data from coarser levels.
+     *
+     * The ghost cells of the right-hand side scratch data are filled only when
+     * \p initial_fill is true.  The physical boundary operator must be set up
+     * to act on the smoother solution data before calling this function.
+     */
+    void fillSmootherGhostCells(int level_num, bool initial_fill);
+
     /*
      * Coarse level solvers and solver parameters.
      */
@@ -274,6 +320,27 @@ private:
      */
     SAMRAI::tbox::Pointer<StaggeredPhysicalBoundaryHelper> d_bc_helper;
     int d_mask_idx;
+
+    /*
+     * Chebyshev and communication-avoiding smoother data.
+     *
+     * d_patch_cf_bdry_boxes holds the coarse-fine interface ghost sides of
+     * each local patch, and d_patch_redundant_update_boxes[ln][p][m] holds the
+     * ghost sides of patch p that are redundantly updated when m additional
+     * sweeps remain before the next ghost cell fill.
+     */
+    int d_sweeps_per_ghost_fill;
+    double d_chebyshev_eig_ratio;
+    bool d_use_smoother_scratch_data;
+    std::vector<std::pair<double, double> > d_chebyshev_eig_bounds;
+    int d_smoother_sol_idx, d_smoother_rhs_idx, d_smoother_dir_idx;
+    std::vector<std::vector<boost::array<SAMRAI::hier::BoxList<NDIM>, NDIM> > > d_patch_cf_bdry_boxes;
+    std::vector<std::vector<std::vector<boost::array<SAMRAI::hier::BoxList<NDIM>, NDIM> > > >
+        d_patch_redundant_update_boxes;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > > d_smoother_fill_algorithms,
+        d_smoother_initial_fill_algorithms;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_smoother_fill_schedules,
+        d_smoother_initial_fill_schedules;
 };
 } // namespace IBTK
 
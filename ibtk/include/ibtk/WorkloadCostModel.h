@@ -0,0 +1,273 @@
+// Filename: WorkloadCostModel.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_WorkloadCostModel
+#define included_IBTK_WorkloadCostModel
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+
+#include "PatchHierarchy.h"
+#include "tbox/Database.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class WorkloadCostModel maintains an online model of the computational
+ * cost of the Eulerian and Lagrangian parts of an immersed boundary time step
+ * that is used to determine the workload estimates for nonuniform load
+ * balancing.
+ *
+ * The model measures the wall-clock time spent by each MPI process in the
+ * Eulerian, Lagrangian-Eulerian interaction, and Lagrangian force phases of
+ * each time step, and it fits per-cell, per-Lagrangian node, and per-quadrature
+ * point cost coefficients by least squares.  The Eulerian time is fit to the
+ * number of local Cartesian grid cells, and the time spent in the interaction
+ * and force phases is fit to the numbers of local Lagrangian nodes and
+ * quadrature points.  The samples obtained from every MPI process during each
+ * regridding interval are combined with those of earlier intervals, which are
+ * weighted by a forgetting factor, so that the model tracks changes in the
+ * relative costs of the phases over the course of a simulation.
+ *
+ * The phases end in operations that synchronize the processes (e.g., ghost
+ * value updates), so that the wall-clock time of a phase on a lightly loaded
+ * process includes the time spent waiting for the most heavily loaded one.
+ * To keep this waiting time out of the fits, the time spent in synchronizing
+ * operations within a phase, which are bracketed by calls to
+ * startSynchronization() and stopSynchronization(), is subtracted from the
+ * phase time.  The timers are purely local: the processes only communicate
+ * when the samples are combined in updateCostCoefficients(), once per
+ * regridding interval.  The Eulerian
+ * phase is not subdivided in this way, but because the Lagrangian work is
+ * timed separately, the waiting time in that phase only reflects the (small)
+ * imbalance in the number of cells per process.
+ *
+ * Before the samples from a regridding interval are used, the costs are also
+ * fit to those samples alone.  If the relative residual of either fit exceeds
+ * max_relative_fit_residual, the measured times are not explained by the local
+ * workload (e.g., because of waiting time in operations that are not
+ * bracketed by calls to startSynchronization() and stopSynchronization()),
+ * and the samples are discarded so that the previous workload weights remain
+ * in use.
+ *
+ * Workload estimates are expressed relative to the cost of a single Cartesian
+ * grid cell, i.e., each cell has unit workload, and each Lagrangian node and
+ * quadrature point contributes getLagrangianNodeWorkloadWeight() and
+ * getQuadPointWorkloadWeight() to the workload of the cell that contains it.
+ *
+ * Sample input database entries:
+ *
+ \verbatim
+ forgetting_factor = 0.5          // weight of the samples from earlier intervals
+ min_workload_weight = 0.0        // lower bound on the fitted workload weights
+ max_relative_fit_residual = 0.25 // upper bound on the relative residual of the fits
+ \endverbatim
+ */
+class WorkloadCostModel : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Enumerated type for the timed phases of a time step.
+     */
+    enum Phase
+    {
+        EULERIAN_PHASE = 0,
+        INTERACTION_PHASE = 1,
+        FORCE_PHASE = 2,
+        NUM_PHASES = 3
+    };
+
+    /*!
+     * \brief Constructor.
+     */
+    WorkloadCostModel(
+        const std::string& object_name,
+        SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = SAMRAI::tbox::Pointer<SAMRAI::tbox::Database>());
+
+    /*!
+     * \brief Destructor.
+     */
+    ~WorkloadCostModel();
+
+    /*!
+     * \brief Start timing the specified phase on this MPI process.
+     */
+    void startPhase(Phase phase);
+
+    /*!
+     * \brief Stop timing the specified phase on this MPI process.
+     */
+    void stopPhase(Phase phase);
+
+    /*!
+     * \brief Start or stop timing an operation that synchronizes this MPI
+     * process with other processes (e.g., a ghost value update).
+     *
+     * The time spent in such operations is subtracted from the times of the
+     * phases that are being timed.  Calls may be nested, and calls that are
+     * made while no phase is being timed have no effect.
+     */
+    void startSynchronization();
+    void stopSynchronization();
+
+    /*!
+     * \brief Indicate that a time step has been completed.
+     */
+    void completeTimeStep();
+
+    /*!
+     * \brief Update the fitted cost coefficients using the times measured since
+     * the preceding call to this function and the local numbers of Cartesian
+     * grid cells, Lagrangian nodes, and quadrature points associated with those
+     * time steps.  Also reports the load imbalance achieved over those time
+     * steps.
+     *
+     * A warning is issued if time steps have been completed without any phase
+     * having been timed, in which case the fitted costs are not changed.
+     *
+     * \note This is a collective operation.
+     */
+    void updateCostCoefficients(double num_local_cells, double num_local_nodes, double num_local_quad_points);
+
+    /*!
+     * \brief Indicate whether the fitted cost coefficients may be used to
+     * determine workload estimates.
+     */
+    bool hasCostCoefficients() const;
+
+    /*!
+     * \brief Get the fitted costs (in seconds per time step) of a Cartesian grid
+     * cell, a Lagrangian node, and a quadrature point.
+     */
+    double getCellCost() const;
+    double getLagrangianNodeCost() const;
+    double getQuadPointCost() const;
+
+    /*!
+     * \brief Get the workload weights of a Lagrangian node and a quadrature
+     * point relative to that of a Cartesian grid cell.
+     */
+    double getLagrangianNodeWorkloadWeight() const;
+    double getQuadPointWorkloadWeight() const;
+
+    /*!
+     * \brief Compute the number of Cartesian grid cells in the local patches of
+     * the patch hierarchy.
+     */
+    static double computeNumberOfLocalCells(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Report the load imbalance predicted by the workload estimates
+     * stored in the specified cell-centered patch data.
+     *
+     * \note This is a collective operation.
+     */
+    void reportPredictedImbalance(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                  int workload_idx) const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    WorkloadCostModel(const WorkloadCostModel& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    WorkloadCostModel& operator=(const WorkloadCostModel& that);
+
+    /*!
+     * \brief Reset the phase timers and the number of completed time steps.
+     */
+    void resetTimers();
+
+    /*!
+     * \brief Solve the normal equations for the fitted cost coefficients.
+     */
+    static void solveNormalEquations(double cell_AtA,
+                                     double cell_Atb,
+                                     const double lag_AtA[2][2],
+                                     const double lag_Atb[2],
+                                     double& cell_cost,
+                                     double& node_cost,
+                                     double& qp_cost);
+
+    std::string d_object_name;
+
+    /*
+     * Parameters.
+     */
+    double d_forgetting_factor, d_min_workload_weight, d_max_relative_fit_residual;
+
+    /*
+     * Phase timers, along with the times spent in synchronizing operations
+     * within each phase.
+     */
+    double d_phase_start_time[NUM_PHASES], d_phase_time[NUM_PHASES];
+    double d_phase_sync_time[NUM_PHASES], d_sync_start_time;
+    int d_sync_depth;
+    int d_num_steps;
+
+    /*
+     * Accumulated normal equations for the least-squares fits of the Eulerian
+     * time to the number of cells and of the Lagrangian time to the numbers of
+     * nodes and quadrature points.
+     */
+    double d_cell_AtA, d_cell_Atb;
+    double d_lag_AtA[2][2], d_lag_Atb[2];
+
+    /*
+     * Fitted cost coefficients.
+     */
+    bool d_has_cost_coefs;
+    double d_cell_cost, d_node_cost, d_qp_cost;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_WorkloadCostModel
@@ -141,6 +141,41 @@ typedef void (*TensorSurfaceFcnPtr)(
     double data_time,
     void* ctx);
 
+/*!
+ * Struct encapsulating the data at a batch of quadrature points that is passed
+ * to batched mesh functions.  All arrays are stored in structure-of-arrays
+ * form, with the quadrature point index varying fastest:
+ *
+ * - FF[(i*NDIM+j)*n_qp+qp] is the (i,j) component of the deformation gradient;
+ * - x[d*n_qp+qp] and X[d*n_qp+qp] are the current and reference coordinates;
+ * - system_var_data[l][v*n_qp+qp] is the value of variable v of system l; and
+ * - system_grad_var_data[l][(v*NDIM+d)*n_qp+qp] is component d of the gradient
+ *   of variable v of system l.
+ *
+ * The systems are ordered as in the std::vector<SystemData> registered along
+ * with the function.
+ */
+struct MeshFcnBatchData
+{
+    MeshFcnBatchData() : n_qp(0), FF(NULL), x(NULL), X(NULL)
+    {
+    }
+
+    unsigned int n_qp;
+    const double* FF;
+    const double* x;
+    const double* X;
+    std::vector<unsigned int> system_n_vars, system_n_grad_vars;
+    std::vector<const double*> system_var_data, system_grad_var_data;
+};
+
+/*!
+ * Batched tensor-valued mesh function.  The function must set
+ * F[(i*NDIM+j)*n_qp+qp] for each quadrature point in the batch.
+ */
+typedef void (*TensorMeshBatchFcnPtr)(
+    double* F, const MeshFcnBatchData& batch_data, libMesh::Elem* elem, double data_time, void* ctx);
+
 template <class MultiArray, class Array>
 inline void
 get_values_for_interpolation(MultiArray& U_node,
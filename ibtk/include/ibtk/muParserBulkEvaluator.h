@@ -0,0 +1,194 @@
+// Filename: muParserBulkEvaluator.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_muParserBulkEvaluator
+#define included_IBTK_muParserBulkEvaluator
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <map>
+#include <vector>
+
+#include "Box.h"
+#include "Index.h"
+#include "boost/array.hpp"
+#include "muParser.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class muParserBulkEvaluator evaluates a mu::Parser expression at all
+ * of the points of a Cartesian index box using muParser's bulk evaluation
+ * mode.
+ *
+ * The evaluator binds the time variables (\c T, \c t) and the position
+ * variables (\c X0, \c x0, \c X_0, \c x_0, etc.) of the parser to internal
+ * arrays, and it determines which of these variables are used by the
+ * expression.  Expressions are evaluated only along the coordinate axes that
+ * they depend upon, and values are broadcast along the remaining axes.  Values
+ * of time-independent expressions are cached and reused by subsequent
+ * evaluations on the same points.
+ *
+ * The bulk evaluation mode executes the same bytecode as mu::Parser::Eval(), so
+ * the computed values are identical to those obtained by evaluating the
+ * expression point-by-point.
+ *
+ * The parser variables are bound to fixed-size internal buffers once, when the
+ * evaluator is constructed, and the points of the index box are evaluated in
+ * chunks of at most BULK_SIZE points.  Redefining parser variables causes
+ * muParser to reparse the expression, and so the bindings are never changed
+ * by evaluate().
+ *
+ * \note The parser must remain valid for the lifetime of the evaluator, and
+ * all parser constants must be defined before the evaluator is constructed.
+ */
+class muParserBulkEvaluator
+{
+public:
+    /*!
+     * \brief The maximum number of points evaluated by a single bulk evaluation.
+     */
+    static const int BULK_SIZE = 4096;
+
+    /*!
+     * \brief Constructor.
+     */
+    muParserBulkEvaluator(mu::Parser* parser, size_t max_cached_values = 1048576);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~muParserBulkEvaluator();
+
+    /*!
+     * \return Whether the expression depends on the time variable.
+     */
+    bool isTimeDependent() const;
+
+    /*!
+     * \return Whether the expression depends on neither the time variable nor
+     * any of the position variables.
+     */
+    bool isConstant() const;
+
+    /*!
+     * \return Whether the expression depends on the position along the
+     * specified coordinate axis.
+     */
+    bool dependsOnAxis(unsigned int axis) const;
+
+    /*!
+     * \brief Evaluate the expression at the points of the index box.
+     *
+     * The position of index \a i along axis \a d is \f$ x_{\mbox{lower}}[d] +
+     * \Delta x[d] ((i(d) - i_{\mbox{lower}}(d)) + \mbox{offset}[d]) \f$.
+     * Values are stored in \a values in the order in which the box is
+     * traversed by SAMRAI::hier::Box::Iterator.
+     *
+     * \note mu::ParserError exceptions generated by the parser are not caught.
+     */
+    void evaluate(std::vector<double>& values,
+                  const SAMRAI::hier::Box<NDIM>& box,
+                  const SAMRAI::hier::Index<NDIM>& i_lower,
+                  const double* x_lower,
+                  const double* dx,
+                  const boost::array<double, NDIM>& offset,
+                  double time);
+
+    /*!
+     * \brief Clear the cached values of time-independent expressions.
+     */
+    void clearCache();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    muParserBulkEvaluator();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    muParserBulkEvaluator(const muParserBulkEvaluator& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    muParserBulkEvaluator& operator=(const muParserBulkEvaluator& that);
+
+    /*!
+     * \brief Evaluate the expression at the points currently stored in the
+     * bulk evaluation buffers.
+     */
+    void evaluateBuffers(double* values, int num_values);
+
+    /*!
+     * The parser and the variables upon which the expression depends.
+     */
+    mu::Parser* d_parser;
+    bool d_time_dependent;
+    boost::array<bool, NDIM> d_axis_dependent;
+
+    /*!
+     * Bulk evaluation buffers, which are bound to the parser variables and are
+     * never resized.
+     */
+    std::vector<double> d_time_vals;
+    boost::array<std::vector<double>, NDIM> d_posn_vals;
+    std::vector<double> d_reduced_vals;
+
+    /*!
+     * Cached values of time-independent expressions.
+     */
+    std::map<std::vector<double>, std::vector<double> > d_cache;
+    size_t d_num_cached_values, d_max_cached_values;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_muParserBulkEvaluator
@@ -45,6 +45,7 @@
 #include "boost/array.hpp"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/muParserBulkEvaluator.h"
 #include "muParser.h"
 #include "tbox/Pointer.h"
 
@@ -72,6 +73,12 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * Functions are evaluated in bulk on each patch by class muParserBulkEvaluator,
+ * which evaluates each function only along the coordinate axes that it depends
+ * upon and caches the values of time-independent functions.  The function
+ * object is reported to be time-dependent only if at least one of the functions
+ * depends on the time variable.
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -164,10 +171,10 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * The bulk evaluators, which define the time and position variables used by
+     * the mu::Parser objects.
      */
-    double d_parser_time;
-    Point d_parser_posn;
+    std::vector<muParserBulkEvaluator*> d_evaluators;
 };
 } // namespace IBTK
 
@@ -46,6 +46,11 @@
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Pointer.h"
 
+namespace IBTK
+{
+class muParserBulkEvaluator;
+} // namespace IBTK
+
 namespace SAMRAI
 {
 namespace hier
@@ -212,10 +217,12 @@ private:
     std::vector<mu::Parser> d_gcoef_parsers;
 
     /*!
-     * Time and position variables.
+     * The bulk evaluators, which define the time and position variables used by
+     * the mu::Parser objects.
      */
-    double* d_parser_time;
-    Point* d_parser_posn;
+    std::vector<muParserBulkEvaluator*> d_acoef_evaluators;
+    std::vector<muParserBulkEvaluator*> d_bcoef_evaluators;
+    std::vector<muParserBulkEvaluator*> d_gcoef_evaluators;
 };
 } // namespace IBTK
 
@@ -68,6 +68,7 @@
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PhaseProfiler.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -581,6 +582,7 @@ void
 HierarchyGhostCellInterpolation::fillData(double fill_time)
 {
     IBTK_TIMER_START(t_fill_data);
+    IBTK_PROFILER_SCOPE("HierarchyGhostCellInterpolation::fillData");
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_is_initialized);
@@ -0,0 +1,277 @@
+// Filename: CFInterpolationStencilTable.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "Box.h"
+#include "CellData.h"
+#include "IBTK_config.h"
+#include "Index.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "ibtk/CFInterpolationStencilTable.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+inline int
+array_offset(const Index<NDIM>& i, const Box<NDIM>& array_box)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(array_box.contains(i));
+#endif
+    int offset = 0;
+    int stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - array_box.lower()(d)) * stride;
+        stride *= array_box.numberCells(d);
+    }
+    return offset;
+} // array_offset
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+CFInterpolationStencilTable::CFInterpolationStencilTable()
+    : d_axis(), d_dst_idx(), d_stencil_ptr(1, 0), d_src_idx(), d_wgt(), d_layouts(), d_vals()
+{
+    // intentionally blank
+    return;
+} // CFInterpolationStencilTable
+
+CFInterpolationStencilTable::~CFInterpolationStencilTable()
+{
+    // intentionally blank
+    return;
+} // ~CFInterpolationStencilTable
+
+void
+CFInterpolationStencilTable::clear()
+{
+    d_axis.clear();
+    d_dst_idx.clear();
+    d_stencil_ptr.assign(1, 0);
+    d_src_idx.clear();
+    d_wgt.clear();
+    d_layouts.clear();
+    d_vals.clear();
+    return;
+} // clear
+
+bool
+CFInterpolationStencilTable::empty() const
+{
+    return d_dst_idx.empty();
+} // empty
+
+void
+CFInterpolationStencilTable::beginStencil(const int axis, const Index<NDIM>& dst_index)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= axis && axis < NDIM);
+#endif
+    d_axis.push_back(axis);
+    d_dst_idx.push_back(dst_index);
+    d_stencil_ptr.push_back(d_stencil_ptr.back());
+    d_layouts.clear();
+    return;
+} // beginStencil
+
+void
+CFInterpolationStencilTable::addStencilPoint(const Index<NDIM>& src_index, const double wgt)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_dst_idx.empty());
+#endif
+    d_src_idx.push_back(src_index);
+    d_wgt.push_back(wgt);
+    ++d_stencil_ptr.back();
+    return;
+} // addStencilPoint
+
+void
+CFInterpolationStencilTable::apply(CellData<NDIM, double>& dst_data, const CellData<NDIM, double>& src_data)
+{
+    if (d_dst_idx.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst_data.getDepth() == src_data.getDepth());
+#endif
+    const Layout& layout = getLayout(dst_data.getGhostBox(), src_data.getGhostBox(), /*side_centered*/ false);
+    const bool src_is_dst = &src_data == &dst_data;
+    double* dst[NDIM];
+    const double* src[NDIM];
+    for (int depth = 0; depth < dst_data.getDepth(); ++depth)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            dst[axis] = dst_data.getPointer(depth);
+            src[axis] = src_data.getPointer(depth);
+        }
+        applyStencils(dst, src, layout, src_is_dst);
+    }
+    return;
+} // apply
+
+void
+CFInterpolationStencilTable::apply(SideData<NDIM, double>& dst_data, const SideData<NDIM, double>& src_data)
+{
+    if (d_dst_idx.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst_data.getDepth() == src_data.getDepth());
+#endif
+    const Layout& layout = getLayout(dst_data.getGhostBox(), src_data.getGhostBox(), /*side_centered*/ true);
+    const bool src_is_dst = &src_data == &dst_data;
+    double* dst[NDIM];
+    const double* src[NDIM];
+    for (int depth = 0; depth < dst_data.getDepth(); ++depth)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            dst[axis] = dst_data.getPointer(axis, depth);
+            src[axis] = src_data.getPointer(axis, depth);
+        }
+        applyStencils(dst, src, layout, src_is_dst);
+    }
+    return;
+} // apply
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+const CFInterpolationStencilTable::Layout&
+CFInterpolationStencilTable::getLayout(const Box<NDIM>& dst_ghost_box,
+                                       const Box<NDIM>& src_ghost_box,
+                                       const bool side_centered)
+{
+    for (std::vector<Layout>::const_iterator cit = d_layouts.begin(); cit != d_layouts.end(); ++cit)
+    {
+        if (cit->side_centered == side_centered && cit->dst_ghost_box == dst_ghost_box &&
+            cit->src_ghost_box == src_ghost_box)
+        {
+            return *cit;
+        }
+    }
+
+    // Flatten the stencils for the new ghost boxes.  For side-centered data,
+    // each axis is stored in a separate array.
+    d_layouts.push_back(Layout());
+    Layout& layout = d_layouts.back();
+    layout.dst_ghost_box = dst_ghost_box;
+    layout.src_ghost_box = src_ghost_box;
+    layout.side_centered = side_centered;
+    Box<NDIM> dst_array_box[NDIM], src_array_box[NDIM];
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        dst_array_box[axis] = side_centered ? SideGeometry<NDIM>::toSideBox(dst_ghost_box, axis) : dst_ghost_box;
+        src_array_box[axis] = side_centered ? SideGeometry<NDIM>::toSideBox(src_ghost_box, axis) : src_ghost_box;
+    }
+    const int n_stencils = static_cast<int>(d_dst_idx.size());
+    layout.dst_offsets.resize(n_stencils);
+    layout.src_offsets.resize(d_src_idx.size());
+    for (int s = 0; s < n_stencils; ++s)
+    {
+        const int axis = d_axis[s];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(side_centered || axis == 0);
+#endif
+        layout.dst_offsets[s] = array_offset(d_dst_idx[s], dst_array_box[axis]);
+        for (int k = d_stencil_ptr[s]; k < d_stencil_ptr[s + 1]; ++k)
+        {
+            layout.src_offsets[k] = array_offset(d_src_idx[k], src_array_box[axis]);
+        }
+    }
+    return layout;
+} // getLayout
+
+void
+CFInterpolationStencilTable::applyStencils(double* const dst[NDIM],
+                                           const double* const src[NDIM],
+                                           const Layout& layout,
+                                           const bool src_is_dst)
+{
+    const int n_stencils = static_cast<int>(d_dst_idx.size());
+    const int* const dst_offsets = &layout.dst_offsets[0];
+    const int* const src_offsets = &layout.src_offsets[0];
+    const int* const stencil_ptr = &d_stencil_ptr[0];
+    const double* const wgt = &d_wgt[0];
+    if (src_is_dst)
+    {
+        // Compute all of the new values before modifying any data, so that the
+        // stencils only ever read the original values.
+        d_vals.resize(n_stencils);
+        for (int s = 0; s < n_stencils; ++s)
+        {
+            const double* const U = src[d_axis[s]];
+            double val = 0.0;
+            for (int k = stencil_ptr[s]; k < stencil_ptr[s + 1]; ++k)
+            {
+                val += wgt[k] * U[src_offsets[k]];
+            }
+            d_vals[s] = val;
+        }
+        for (int s = 0; s < n_stencils; ++s)
+        {
+            dst[d_axis[s]][dst_offsets[s]] = d_vals[s];
+        }
+    }
+    else
+    {
+        for (int s = 0; s < n_stencils; ++s)
+        {
+            const double* const U = src[d_axis[s]];
+            double val = 0.0;
+            for (int k = stencil_ptr[s]; k < stencil_ptr[s + 1]; ++k)
+            {
+                val += wgt[k] * U[src_offsets[k]];
+            }
+            dst[d_axis[s]][dst_offsets[s]] = val;
+        }
+    }
+    return;
+} // applyStencils
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
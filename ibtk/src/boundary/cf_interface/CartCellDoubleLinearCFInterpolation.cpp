@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <set>
 #include <vector>
@@ -53,38 +54,13 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "RefineOperator.h"
+#include "ibtk/CFInterpolationStencilTable.h"
 #include "ibtk/CartCellDoubleLinearCFInterpolation.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-// FORTRAN ROUTINES
-#if (NDIM == 2)
-#define CC_LINEAR_NORMAL_INTERPOLATION_FC IBTK_FC_FUNC(cclinearnormalinterpolation2d, CCLINEARNORMALINTERPOLATION2D)
-#endif
-#if (NDIM == 3)
-#define CC_LINEAR_NORMAL_INTERPOLATION_FC IBTK_FC_FUNC(cclinearnormalinterpolation3d, CCLINEARNORMALINTERPOLATION3D)
-#endif
-
-// Function interfaces
-extern "C" {
-void CC_LINEAR_NORMAL_INTERPOLATION_FC(double* U,
-                                       const int& U_gcw,
-                                       const int& ilower0,
-                                       const int& iupper0,
-                                       const int& ilower1,
-                                       const int& iupper1,
-#if (NDIM == 3)
-                                       const int& ilower2,
-                                       const int& iupper2,
-#endif
-                                       const int& loc_index,
-                                       const int& ratio,
-                                       const int* blower,
-                                       const int* bupper);
-}
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -95,6 +71,71 @@ namespace
 {
 static const int REFINE_OP_STENCIL_WIDTH = 1;
 static const int GHOST_WIDTH_TO_FILL = 1;
+
+// Compile the stencils used to interpolate fine data in the normal direction
+// along a co-dimension 1 coarse-fine interface boundary box.  These stencils
+// reproduce the scheme of the cclinearnormalinterpolation kernels, in which
+// each ghost cell value is combined with the adjacent interior value and the
+// interior value that is mirrored within the overlying coarse cell.
+void
+compile_normal_extension_stencils(CFInterpolationStencilTable& stencils,
+                                  const Box<NDIM>& patch_box,
+                                  const Box<NDIM>& bc_fill_box,
+                                  const unsigned int location_index,
+                                  const int ratio)
+{
+    const unsigned int bdry_normal_axis = location_index / 2;
+    const bool is_lower = location_index % 2 == 0;
+    const int i_ghost = (is_lower ? patch_box.lower()(bdry_normal_axis) - 1 : patch_box.upper()(bdry_normal_axis) + 1);
+    const int i_intr = (is_lower ? patch_box.lower()(bdry_normal_axis) : patch_box.upper()(bdry_normal_axis));
+    const double R = static_cast<double>(ratio);
+    const double wgt_ghost = 2.0 / (R + 1.0);
+    const double wgt_intr = R / (R + 1.0);
+    const double wgt_mirror = -1.0 / (R + 1.0);
+
+    // Loop over the blocks of fine cells that are covered by individual coarse
+    // cells along the interface.
+    Index<NDIM> fine_lower;
+    Box<NDIM> block_box(Index<NDIM>(0), Index<NDIM>(0));
+    Box<NDIM> fine_offset_box(Index<NDIM>(0), Index<NDIM>(0));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (d == bdry_normal_axis) continue;
+        fine_lower(d) = std::max(bc_fill_box.lower()(d), patch_box.lower()(d));
+        const int fine_upper = std::min(bc_fill_box.upper()(d), patch_box.upper()(d));
+        if (fine_upper < fine_lower(d)) return;
+        block_box.upper()(d) = (fine_upper - fine_lower(d)) / ratio;
+        fine_offset_box.upper()(d) = ratio - 1;
+    }
+    for (Box<NDIM>::Iterator b(block_box); b; b++)
+    {
+        for (Box<NDIM>::Iterator f(fine_offset_box); f; f++)
+        {
+            Index<NDIM> i_dst, i_src, i_mirror;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (d == bdry_normal_axis)
+                {
+                    i_dst(d) = i_ghost;
+                    i_src(d) = i_intr;
+                    i_mirror(d) = i_intr;
+                }
+                else
+                {
+                    const int i_block = fine_lower(d) + b()(d) * ratio;
+                    i_dst(d) = i_block + f()(d);
+                    i_src(d) = i_dst(d);
+                    i_mirror(d) = i_block + ratio - 1 - f()(d);
+                }
+            }
+            stencils.beginStencil(0, i_dst);
+            stencils.addStencilPoint(i_dst, wgt_ghost);
+            stencils.addStencilPoint(i_src, wgt_intr);
+            stencils.addStencilPoint(i_mirror, wgt_mirror);
+        }
+    }
+    return;
+} // compile_normal_extension_stencils
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -229,6 +270,36 @@ CartCellDoubleLinearCFInterpolation::setPatchHierarchy(Pointer<PatchHierarchy<ND
         d_domain_boxes[ln]->refine(ratio);
         d_periodic_shift[ln] = grid_geom->getPeriodicShift(ratio);
     }
+
+    // Compile the normal extension stencils for each local patch.
+    d_normal_stencils.resize(finest_level_number + 1);
+    const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
+    for (int ln = 0; ln <= finest_level_number; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        d_normal_stencils[ln].resize(level->getNumberOfPatches());
+        if (ln == 0) continue;
+        const int ratio = level->getRatioToCoarserLevel().min();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const int patch_num = p();
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[ln]->getBoundaries(patch_num, 1);
+            for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
+            {
+                const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
+                const Box<NDIM> bc_fill_box = pgeom->getBoundaryFillBox(bdry_box, patch_box, ghost_width_to_fill);
+                const unsigned int location_index = bdry_box.getLocationIndex();
+                compile_normal_extension_stencils(d_normal_stencils[ln][patch_num],
+                                                  patch_box,
+                                                  bc_fill_box,
+                                                  location_index,
+                                                  ratio);
+            }
+        }
+    }
     return;
 } // setPatchHierarchy
 
@@ -249,6 +320,7 @@ CartCellDoubleLinearCFInterpolation::clearPatchHierarchy()
     }
     d_domain_boxes.clear();
     d_periodic_shift.clear();
+    d_normal_stencils.clear();
     return;
 } // clearPatchHierarchy
 
@@ -267,21 +339,18 @@ CartCellDoubleLinearCFInterpolation::computeNormalExtension(Patch<NDIM>& patch,
     // boundary box information.
     if (!patch.inHierarchy()) return;
 
-    // Get the co-dimension 1 cf boundary boxes.
+    // Apply the precompiled normal extension stencils.
     const int patch_num = patch.getPatchNumber();
     const int patch_level_num = patch.getPatchLevelNumber();
 #if !defined(NDEBUG)
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(patch_level_num);
     TBOX_ASSERT(&patch == level->getPatch(patch_num).getPointer());
+    TBOX_ASSERT(ratio == level->getRatioToCoarserLevel());
+#else
+    NULL_USE(ratio);
 #endif
-    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[patch_level_num]->getBoundaries(patch_num, 1);
-    const int n_cf_bdry_codim1_boxes = cf_bdry_codim1_boxes.size();
-
-    // Check to see if there are any co-dimension 1 coarse-fine boundary boxes
-    // associated with the patch; if not, there is nothing to do.
-    if (n_cf_bdry_codim1_boxes == 0) return;
-
-    // Get the patch data.
+    CFInterpolationStencilTable& stencils = d_normal_stencils[patch_level_num][patch_num];
+    if (stencils.empty()) return;
     for (std::set<int>::const_iterator cit = d_patch_data_indices.begin(); cit != d_patch_data_indices.end(); ++cit)
     {
         const int& patch_data_index = *cit;
@@ -289,44 +358,7 @@ CartCellDoubleLinearCFInterpolation::computeNormalExtension(Patch<NDIM>& patch,
 #if !defined(NDEBUG)
         TBOX_ASSERT(data);
 #endif
-        const int U_ghosts = (data->getGhostCellWidth()).max();
-#if !defined(NDEBUG)
-        if (U_ghosts != (data->getGhostCellWidth()).min())
-        {
-            TBOX_ERROR("CartCellDoubleLinearCFInterpolation::computeNormalExtension():\n"
-                       << "   patch data does not have uniform ghost cell widths"
-                       << std::endl);
-        }
-#endif
-        const int data_depth = data->getDepth();
-        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
-        const Box<NDIM>& patch_box = patch.getBox();
-        for (int k = 0; k < n_cf_bdry_codim1_boxes; ++k)
-        {
-            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
-            const Box<NDIM> bc_fill_box = pgeom->getBoundaryFillBox(bdry_box, patch_box, ghost_width_to_fill);
-            const unsigned int location_index = bdry_box.getLocationIndex();
-            for (int depth = 0; depth < data_depth; ++depth)
-            {
-                double* const U = data->getPointer(depth);
-                const int r = ratio.min();
-                CC_LINEAR_NORMAL_INTERPOLATION_FC(U,
-                                                  U_ghosts,
-                                                  patch_box.lower(0),
-                                                  patch_box.upper(0),
-                                                  patch_box.lower(1),
-                                                  patch_box.upper(1),
-#if (NDIM == 3)
-                                                  patch_box.lower(2),
-                                                  patch_box.upper(2),
-#endif
-                                                  location_index,
-                                                  r,
-                                                  bc_fill_box.lower(),
-                                                  bc_fill_box.upper());
-            }
-        }
+        stencils.apply(*data, *data);
     }
     return;
 } // computeNormalExtension
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <set>
 #include <vector>
@@ -55,76 +56,23 @@
 #include "PatchLevel.h"
 #include "RefineOperator.h"
 #include "boost/array.hpp"
+#include "ibtk/CFInterpolationStencilTable.h"
 #include "ibtk/CartCellDoubleQuadraticCFInterpolation.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-// FORTRAN ROUTINES
-#if (NDIM == 2)
-#define CC_QUAD_TANGENTIAL_INTERPOLATION_FC                                                                            \
-    IBTK_FC_FUNC(ccquadtangentialinterpolation2d, CCQUADTANGENTIALINTERPOLATION2D)
-#define CC_QUAD_NORMAL_INTERPOLATION_FC IBTK_FC_FUNC(ccquadnormalinterpolation2d, CCQUADNORMALINTERPOLATION2D)
-#endif
-#if (NDIM == 3)
-#define CC_QUAD_TANGENTIAL_INTERPOLATION_FC                                                                            \
-    IBTK_FC_FUNC(ccquadtangentialinterpolation3d, CCQUADTANGENTIALINTERPOLATION3D)
-#define CC_QUAD_NORMAL_INTERPOLATION_FC IBTK_FC_FUNC(ccquadnormalinterpolation3d, CCQUADNORMALINTERPOLATION3D)
-#endif
-
-// Function interfaces
-extern "C" {
-void CC_QUAD_TANGENTIAL_INTERPOLATION_FC(double* U_fine,
-                                         const int& U_fine_gcw,
-                                         const double* U_coarse,
-                                         const int& U_crse_gcw,
-                                         const int& ilowerf0,
-                                         const int& iupperf0,
-                                         const int& ilowerf1,
-                                         const int& iupperf1,
-#if (NDIM == 3)
-                                         const int& ilowerf2,
-                                         const int& iupperf2,
-#endif
-                                         const int& ilowerc0,
-                                         const int& iupperc0,
-                                         const int& ilowerc1,
-                                         const int& iupperc1,
-#if (NDIM == 3)
-                                         const int& ilowerc2,
-                                         const int& iupperc2,
-#endif
-                                         const int& loc_index,
-                                         const int* ratio_to_coarser,
-                                         const int* blower,
-                                         const int* bupper);
-
-void CC_QUAD_NORMAL_INTERPOLATION_FC(double* U,
-                                     const int& U_gcw,
-                                     const int& ilower0,
-                                     const int& iupper0,
-                                     const int& ilower1,
-                                     const int& iupper1,
-#if (NDIM == 3)
-                                     const int& ilower2,
-                                     const int& iupper2,
-#endif
-                                     const int& loc_index,
-                                     const int* ratio_to_coarser,
-                                     const int* blower,
-                                     const int* bupper);
-}
-
 // Note that there are two versions of this code:
 //
 //    - The expensive version uses only C++ constructs.
-//    - The optimized version uses hand-coded Fortran routines.
+//    - The optimized version uses precompiled interpolation stencils that
+//      reproduce the hand-coded Fortran routines.
 //
 // These two versions of the code may produce different values since they employ
 // different treatments at "Type 2" coarse-fine boundary ghost cells.  The
-// optimized Fortran version does not presently set values in "Type 0"
-// coarse-fine interface ghost cells.
+// optimized version does not presently set values in "Type 0" coarse-fine
+// interface ghost cells.
 //
 // The version of the code to be employed is determined at compile time by the
 // flag --enable-expensive-cf-interpolation.
@@ -212,6 +160,157 @@ is_corner_point(const Index<NDIM>& i,
     }
     return false;
 } // is_corner_point
+
+// Maximum refinement ratio and ghost cell width supported by the stencil
+// compilers.
+static const int MAX_RATIO = 16;
+static const int MAX_GCW = 8;
+
+// Compile the stencils used to interpolate coarse data in the tangential
+// directions along a co-dimension 1 coarse-fine interface boundary box.  These
+// stencils reproduce the scheme of the ccquadtangentialinterpolation kernels.
+void
+compile_tangential_stencils(CFInterpolationStencilTable& stencils,
+                            const Box<NDIM>& patch_box,
+                            const Box<NDIM>& bc_fill_box,
+                            const unsigned int location_index,
+                            const IntVector<NDIM>& ratio)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ratio.max() <= MAX_RATIO);
+#endif
+    const unsigned int bdry_normal_axis = location_index / 2;
+
+    // Compute the quadratic interpolation weights along each tangential
+    // direction.
+    double wgt[NDIM][MAX_RATIO][3];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (d == bdry_normal_axis) continue;
+        const double R = static_cast<double>(ratio(d));
+        for (int p = 0; p < ratio(d); ++p)
+        {
+#if (NDIM == 2)
+            const double t = static_cast<double>(p) + 0.5;
+            wgt[d][p][0] = 0.125 * (4.0 * t * t - 8.0 * t * R + 3.0 * R * R) / (R * R);
+            wgt[d][p][1] = 0.25 * (-4.0 * t * t + 4.0 * t * R + 3.0 * R * R) / (R * R);
+            wgt[d][p][2] = -0.125 * (-4.0 * t * t + R * R) / (R * R);
+#endif
+#if (NDIM == 3)
+            const double t = static_cast<double>(p) + 0.5 - 0.5 * R;
+            wgt[d][p][0] = 0.5 * t * t / (R * R) - 0.5 * t / R;
+            wgt[d][p][1] = -t * t / (R * R) + 1.0;
+            wgt[d][p][2] = 0.5 * t * t / (R * R) + 0.5 * t / R;
+#endif
+        }
+    }
+
+    // Loop over the fine cells in the boundary fill box that are aligned with
+    // the coarse grid in the tangential directions.
+    Index<NDIM> fine_lower, fine_stride;
+    Box<NDIM> coarse_cell_box(Index<NDIM>(0), Index<NDIM>(0));
+    Box<NDIM> fine_offset_box(Index<NDIM>(0), Index<NDIM>(0));
+    Box<NDIM> crse_offset_box(Index<NDIM>(0), Index<NDIM>(0));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const bool normal = d == bdry_normal_axis;
+        const int lower = (normal ? bc_fill_box.lower()(d) : std::max(bc_fill_box.lower()(d), patch_box.lower()(d)));
+        const int upper = (normal ? bc_fill_box.upper()(d) : std::min(bc_fill_box.upper()(d), patch_box.upper()(d)));
+        if (upper < lower) return;
+        fine_lower(d) = lower;
+        fine_stride(d) = (normal ? 1 : ratio(d));
+        coarse_cell_box.upper()(d) = (upper - lower) / fine_stride(d);
+        if (normal) continue;
+        fine_offset_box.upper()(d) = ratio(d) - 1;
+        crse_offset_box.lower()(d) = -1;
+        crse_offset_box.upper()(d) = 1;
+    }
+    for (Box<NDIM>::Iterator b(coarse_cell_box); b; b++)
+    {
+        Index<NDIM> i_fine, i_crse;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            i_fine(d) = fine_lower(d) + b()(d) * fine_stride(d);
+            i_crse(d) = coarsen(i_fine(d), ratio(d));
+        }
+        for (Box<NDIM>::Iterator f(fine_offset_box); f; f++)
+        {
+            const Index<NDIM>& p = f();
+            stencils.beginStencil(0, i_fine + p);
+            for (Box<NDIM>::Iterator c(crse_offset_box); c; c++)
+            {
+                const Index<NDIM>& w = c();
+                double w_prod = 1.0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (d == bdry_normal_axis) continue;
+                    w_prod *= wgt[d][p(d)][w(d) + 1];
+                }
+                stencils.addStencilPoint(i_crse + w, w_prod);
+            }
+        }
+    }
+    return;
+} // compile_tangential_stencils
+
+// Compile the stencils used to interpolate fine data in the normal direction
+// along a co-dimension 1 coarse-fine interface boundary box.  These stencils
+// reproduce the scheme of the ccquadnormalinterpolation kernels.
+void
+compile_normal_extension_stencils(CFInterpolationStencilTable& stencils,
+                                  const Box<NDIM>& patch_box,
+                                  const Box<NDIM>& bc_fill_box,
+                                  const unsigned int location_index,
+                                  const IntVector<NDIM>& ratio)
+{
+    const unsigned int bdry_normal_axis = location_index / 2;
+    const bool is_lower = location_index % 2 == 0;
+    const int gcw = bc_fill_box.numberCells(bdry_normal_axis);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(gcw <= MAX_GCW);
+#endif
+    const double R = static_cast<double>(ratio(bdry_normal_axis));
+    double wgt[MAX_GCW][3];
+    for (int p = 0; p < gcw; ++p)
+    {
+        const double t = static_cast<double>(p) + 0.5;
+        wgt[p][0] = -0.5 * (2.0 * R * t + R - 4.0 * t * t - 2.0 * t) / (R + 3.0);
+        wgt[p][1] = 0.5 * (2.0 * R * t + 3.0 * R - 4.0 * t * t - 6.0 * t) / (R + 1.0);
+        wgt[p][2] = (4.0 * t * t + 8.0 * t + 3.0) / (R + 1.0) / (R + 3.0);
+    }
+    const int i_bdry = (is_lower ? bc_fill_box.upper()(bdry_normal_axis) : bc_fill_box.lower()(bdry_normal_axis));
+    const int i_intr0 = (is_lower ? i_bdry + 1 : i_bdry - 1);
+    const int i_intr1 = (is_lower ? i_bdry + 2 : i_bdry - 2);
+
+    // Loop over the ghost cells, using the normal index to count the distance
+    // from the interface.
+    Box<NDIM> ghost_box(Index<NDIM>(0), Index<NDIM>(0));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (d == bdry_normal_axis)
+        {
+            ghost_box.upper()(d) = gcw - 1;
+        }
+        else
+        {
+            ghost_box.lower()(d) = std::max(bc_fill_box.lower()(d), patch_box.lower()(d));
+            ghost_box.upper()(d) = std::min(bc_fill_box.upper()(d), patch_box.upper()(d));
+        }
+    }
+    for (Box<NDIM>::Iterator b(ghost_box); b; b++)
+    {
+        const int p = b()(bdry_normal_axis);
+        Index<NDIM> i_dst(b()), i_src0(b()), i_src1(b());
+        i_dst(bdry_normal_axis) = (is_lower ? i_bdry - p : i_bdry + p);
+        i_src0(bdry_normal_axis) = i_intr0;
+        i_src1(bdry_normal_axis) = i_intr1;
+        stencils.beginStencil(0, i_dst);
+        stencils.addStencilPoint(i_dst, wgt[p][2]);
+        stencils.addStencilPoint(i_src0, wgt[p][1]);
+        stencils.addStencilPoint(i_src1, wgt[p][0]);
+    }
+    return;
+} // compile_normal_extension_stencils
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -368,6 +467,43 @@ CartCellDoubleQuadraticCFInterpolation::setPatchHierarchy(Pointer<PatchHierarchy
         d_domain_boxes[ln]->refine(ratio);
         d_periodic_shift[ln] = grid_geom->getPeriodicShift(ratio);
     }
+
+    // Compile the interpolation stencils for each local patch.
+    d_tangential_stencils.resize(finest_level_number + 1);
+    d_normal_stencils.resize(finest_level_number + 1);
+    const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
+    for (int ln = 0; ln <= finest_level_number; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        d_tangential_stencils[ln].resize(level->getNumberOfPatches());
+        d_normal_stencils[ln].resize(level->getNumberOfPatches());
+        if (ln == 0) continue;
+        const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const int patch_num = p();
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[ln]->getBoundaries(patch_num, 1);
+            for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
+            {
+                const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
+                const Box<NDIM> bc_fill_box = pgeom->getBoundaryFillBox(bdry_box, patch_box, ghost_width_to_fill);
+                const unsigned int location_index = bdry_box.getLocationIndex();
+                compile_tangential_stencils(d_tangential_stencils[ln][patch_num],
+                                            patch_box,
+                                            bc_fill_box,
+                                            location_index,
+                                            ratio);
+                compile_normal_extension_stencils(d_normal_stencils[ln][patch_num],
+                                                  patch_box,
+                                                  bc_fill_box,
+                                                  location_index,
+                                                  ratio);
+            }
+        }
+    }
     return;
 } // setPatchHierarchy
 
@@ -388,6 +524,8 @@ CartCellDoubleQuadraticCFInterpolation::clearPatchHierarchy()
     }
     d_domain_boxes.clear();
     d_periodic_shift.clear();
+    d_tangential_stencils.clear();
+    d_normal_stencils.clear();
     return;
 } // clearPatchHierarchy
 
@@ -624,14 +762,16 @@ CartCellDoubleQuadraticCFInterpolation::postprocessRefine_optimized(Patch<NDIM>&
                                                                     const Patch<NDIM>& coarse,
                                                                     const IntVector<NDIM>& ratio)
 {
-    // Get the co-dimension 1 cf boundary boxes.
+    // Apply the precompiled tangential interpolation stencils.
     const int patch_num = fine.getPatchNumber();
     const int fine_patch_level_num = fine.getPatchLevelNumber();
-    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes =
-        d_cf_boundary[fine_patch_level_num]->getBoundaries(patch_num, 1);
-    if (cf_bdry_codim1_boxes.size() == 0) return;
-
-    // Get the patch data.
+    CFInterpolationStencilTable& stencils = d_tangential_stencils[fine_patch_level_num][patch_num];
+    if (stencils.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ratio == d_hierarchy->getPatchLevel(fine_patch_level_num)->getRatioToCoarserLevel());
+#else
+    NULL_USE(ratio);
+#endif
     for (std::set<int>::const_iterator cit = d_patch_data_indices.begin(); cit != d_patch_data_indices.end(); ++cit)
     {
         const int& patch_data_index = *cit;
@@ -642,62 +782,7 @@ CartCellDoubleQuadraticCFInterpolation::postprocessRefine_optimized(Patch<NDIM>&
         TBOX_ASSERT(cdata);
         TBOX_ASSERT(cdata->getDepth() == fdata->getDepth());
 #endif
-        const int U_fine_ghosts = (fdata->getGhostCellWidth()).max();
-        const int U_crse_ghosts = (cdata->getGhostCellWidth()).max();
-#if !defined(NDEBUG)
-        if (U_fine_ghosts != (fdata->getGhostCellWidth()).min())
-        {
-            TBOX_ERROR("CartCellDoubleQuadraticCFInterpolation::postprocessRefine():\n"
-                       << "   patch data does not have uniform ghost cell widths"
-                       << std::endl);
-        }
-        if (U_crse_ghosts != (cdata->getGhostCellWidth()).min())
-        {
-            TBOX_ERROR("CartCellDoubleQuadraticCFInterpolation::postprocessRefine():\n"
-                       << "   patch data does not have uniform ghost cell widths"
-                       << std::endl);
-        }
-#endif
-        const int data_depth = fdata->getDepth();
-        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom_fine = fine.getPatchGeometry();
-        const Box<NDIM>& patch_box_fine = fine.getBox();
-        const Box<NDIM>& patch_box_crse = coarse.getBox();
-        for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
-        {
-            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
-            const Box<NDIM> bc_fill_box = pgeom_fine->getBoundaryFillBox(bdry_box, patch_box_fine, ghost_width_to_fill);
-            const unsigned int location_index = bdry_box.getLocationIndex();
-            for (int depth = 0; depth < data_depth; ++depth)
-            {
-                double* const U_fine = fdata->getPointer(depth);
-                const double* const U_crse = cdata->getPointer(depth);
-                CC_QUAD_TANGENTIAL_INTERPOLATION_FC(U_fine,
-                                                    U_fine_ghosts,
-                                                    U_crse,
-                                                    U_crse_ghosts,
-                                                    patch_box_fine.lower(0),
-                                                    patch_box_fine.upper(0),
-                                                    patch_box_fine.lower(1),
-                                                    patch_box_fine.upper(1),
-#if (NDIM == 3)
-                                                    patch_box_fine.lower(2),
-                                                    patch_box_fine.upper(2),
-#endif
-                                                    patch_box_crse.lower(0),
-                                                    patch_box_crse.upper(0),
-                                                    patch_box_crse.lower(1),
-                                                    patch_box_crse.upper(1),
-#if (NDIM == 3)
-                                                    patch_box_crse.lower(2),
-                                                    patch_box_crse.upper(2),
-#endif
-                                                    location_index,
-                                                    ratio,
-                                                    bc_fill_box.lower(),
-                                                    bc_fill_box.upper());
-            }
-        }
+        stencils.apply(*fdata, *cdata);
     }
     return;
 } // postprocessRefine_optimized
@@ -829,17 +914,16 @@ void
 CartCellDoubleQuadraticCFInterpolation::computeNormalExtension_optimized(Patch<NDIM>& patch,
                                                                          const IntVector<NDIM>& ratio)
 {
-    // Get the co-dimension 1 cf boundary boxes.
+    // Apply the precompiled normal extension stencils.
     const int patch_num = patch.getPatchNumber();
     const int patch_level_num = patch.getPatchLevelNumber();
-    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[patch_level_num]->getBoundaries(patch_num, 1);
-    const int n_cf_bdry_codim1_boxes = cf_bdry_codim1_boxes.size();
-
-    // Check to see if there are any co-dimension 1 coarse-fine boundary boxes
-    // associated with the patch; if not, there is nothing to do.
-    if (n_cf_bdry_codim1_boxes == 0) return;
-
-    // Get the patch data.
+    CFInterpolationStencilTable& stencils = d_normal_stencils[patch_level_num][patch_num];
+    if (stencils.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ratio == d_hierarchy->getPatchLevel(patch_level_num)->getRatioToCoarserLevel());
+#else
+    NULL_USE(ratio);
+#endif
     for (std::set<int>::const_iterator cit = d_patch_data_indices.begin(); cit != d_patch_data_indices.end(); ++cit)
     {
         const int& patch_data_index = *cit;
@@ -847,43 +931,7 @@ CartCellDoubleQuadraticCFInterpolation::computeNormalExtension_optimized(Patch<N
 #if !defined(NDEBUG)
         TBOX_ASSERT(data);
 #endif
-        const int U_ghosts = (data->getGhostCellWidth()).max();
-#if !defined(NDEBUG)
-        if (U_ghosts != (data->getGhostCellWidth()).min())
-        {
-            TBOX_ERROR("CartCellDoubleQuadraticCFInterpolation::computeNormalExtension():\n"
-                       << "   patch data does not have uniform ghost cell widths"
-                       << std::endl);
-        }
-#endif
-        const int data_depth = data->getDepth();
-        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
-        const Box<NDIM>& patch_box = patch.getBox();
-        for (int k = 0; k < n_cf_bdry_codim1_boxes; ++k)
-        {
-            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
-            const Box<NDIM> bc_fill_box = pgeom->getBoundaryFillBox(bdry_box, patch_box, ghost_width_to_fill);
-            const unsigned int location_index = bdry_box.getLocationIndex();
-            for (int depth = 0; depth < data_depth; ++depth)
-            {
-                double* const U = data->getPointer(depth);
-                CC_QUAD_NORMAL_INTERPOLATION_FC(U,
-                                                U_ghosts,
-                                                patch_box.lower(0),
-                                                patch_box.upper(0),
-                                                patch_box.lower(1),
-                                                patch_box.upper(1),
-#if (NDIM == 3)
-                                                patch_box.lower(2),
-                                                patch_box.upper(2),
-#endif
-                                                location_index,
-                                                ratio,
-                                                bc_fill_box.lower(),
-                                                bc_fill_box.upper());
-            }
-        }
+        stencils.apply(*data, *data);
     }
     return;
 } // computeNormalExtension_optimized
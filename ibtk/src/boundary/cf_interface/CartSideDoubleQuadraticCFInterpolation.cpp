@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <set>
 #include <vector>
@@ -54,10 +55,12 @@
 #include "RefineOperator.h"
 #include "RefineSchedule.h"
 #include "SideData.h"
+#include "SideIndex.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
 #include "VariableDatabase.h"
+#include "ibtk/CFInterpolationStencilTable.h"
 #include "ibtk/CartSideDoubleQuadraticCFInterpolation.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -159,6 +162,257 @@ namespace
 {
 static const int REFINE_OP_STENCIL_WIDTH = 1;
 static const int GHOST_WIDTH_TO_FILL = 1;
+
+// Maximum refinement ratio and ghost cell width supported by the stencil
+// compilers.
+static const int MAX_RATIO = 16;
+static const int MAX_GCW = 8;
+
+inline int
+coarsen(const int& index, const int& ratio)
+{
+    return (index < 0 ? (index + 1) / ratio - 1 : index / ratio);
+} // coarsen
+
+inline void
+compute_quadratic_tangential_weights(double wgt[MAX_RATIO][3], const int ratio)
+{
+    static const double fourth = 0.25;
+    static const double eighth = 0.125;
+    const double R = static_cast<double>(ratio);
+    for (int p = 0; p < ratio; ++p)
+    {
+        const double t = static_cast<double>(p) + 0.5;
+        wgt[p][0] = eighth * (4.0 * t * t - 8.0 * t * R + 3.0 * R * R) / (R * R);
+        wgt[p][1] = fourth * (-4.0 * t * t + 4.0 * t * R + 3.0 * R * R) / (R * R);
+        wgt[p][2] = -eighth * (-4.0 * t * t + R * R) / (R * R);
+    }
+    return;
+} // compute_quadratic_tangential_weights
+
+inline void
+compute_cubic_tangential_weights(double wgt[MAX_RATIO + 1][4], const int ratio)
+{
+    static const double half = 0.5;
+    static const double sixth = 0.16666666666667;
+    const double R = static_cast<double>(ratio);
+    for (int p = 0; p <= ratio; ++p)
+    {
+        const double t = static_cast<double>(p);
+        wgt[p][0] = -sixth * t * (t * t - 3.0 * t * R + 2.0 * R * R) / (R * R * R);
+        wgt[p][1] = half * (t * t * t - 2.0 * t * t * R - t * R * R + 2.0 * R * R * R) / (R * R * R);
+        wgt[p][2] = half * t * (-t * t + t * R + 2.0 * R * R) / (R * R * R);
+        wgt[p][3] = -sixth * t * (-t * t + R * R) / (R * R * R);
+    }
+    return;
+} // compute_cubic_tangential_weights
+
+// Compile the stencils that set the values of one component of the fine data
+// in the ghost cells associated with a single coarse cell along the
+// coarse-fine interface.  Cubic interpolation is used along the component axis
+// and quadratic interpolation is used along the other tangential axes.
+inline void
+compile_tangential_stencils_for_coarse_cell(CFInterpolationStencilTable& stencils,
+                                            const int axis,
+                                            const unsigned int bdry_normal_axis,
+                                            const Index<NDIM>& i_fine,
+                                            const Index<NDIM>& i_crse,
+                                            const IntVector<NDIM>& ratio,
+                                            const double quad_wgt[NDIM][MAX_RATIO][3],
+                                            const double cubic_wgt[NDIM][MAX_RATIO + 1][4],
+                                            const SideData<NDIM, int>& indicator_data)
+{
+    Box<NDIM> fine_offset_box(Index<NDIM>(0), Index<NDIM>(0));
+    Box<NDIM> crse_offset_box(Index<NDIM>(0), Index<NDIM>(0));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (d == bdry_normal_axis) continue;
+        fine_offset_box.upper()(d) = (static_cast<int>(d) == axis ? ratio(d) : ratio(d) - 1);
+        crse_offset_box.lower()(d) = -1;
+        crse_offset_box.upper()(d) = (static_cast<int>(d) == axis ? 2 : 1);
+    }
+    for (Box<NDIM>::Iterator b(fine_offset_box); b; b++)
+    {
+        const Index<NDIM>& p = b();
+        const Index<NDIM> i_dst = i_fine + p;
+        if (indicator_data(SideIndex<NDIM>(i_dst, axis, SideIndex<NDIM>::Lower)) == 1) continue;
+        stencils.beginStencil(axis, i_dst);
+        for (Box<NDIM>::Iterator c(crse_offset_box); c; c++)
+        {
+            const Index<NDIM>& w = c();
+            double wgt = 1.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (d == bdry_normal_axis) continue;
+                wgt *= (static_cast<int>(d) == axis ? cubic_wgt[d][p(d)][w(d) + 1] : quad_wgt[d][p(d)][w(d) + 1]);
+            }
+            stencils.addStencilPoint(i_crse + w, wgt);
+        }
+    }
+    return;
+} // compile_tangential_stencils_for_coarse_cell
+
+// Compile the stencils used to interpolate coarse data in the tangential
+// directions along a co-dimension 1 coarse-fine interface boundary box.  These
+// stencils use the same interpolation weights as the
+// scquadtangentialinterpolation kernels.  In 3D, the kernels interpolate along
+// one tangential direction at a time, whereas the stencils apply the tensor
+// product weights in a single sum, so that the results agree only up to
+// round-off errors.
+void
+compile_tangential_stencils(CFInterpolationStencilTable& stencils,
+                            const Box<NDIM>& patch_box,
+                            const Box<NDIM>& bc_fill_box,
+                            const unsigned int location_index,
+                            const IntVector<NDIM>& ratio,
+                            const SideData<NDIM, int>& indicator_data)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ratio.max() <= MAX_RATIO);
+#endif
+    const unsigned int bdry_normal_axis = location_index / 2;
+    const bool is_lower = location_index % 2 == 0;
+
+    // Compute the interpolation weights along each tangential direction.
+    double quad_wgt[NDIM][MAX_RATIO][3];
+    double cubic_wgt[NDIM][MAX_RATIO + 1][4];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (d == bdry_normal_axis) continue;
+        compute_quadratic_tangential_weights(quad_wgt[d], ratio(d));
+        compute_cubic_tangential_weights(cubic_wgt[d], ratio(d));
+    }
+
+    // Loop over the fine cells in the boundary fill box that are aligned with
+    // the coarse grid in the tangential directions.
+    Index<NDIM> fine_lower, fine_stride;
+    Box<NDIM> coarse_cell_box(Index<NDIM>(0), Index<NDIM>(0));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const bool normal = d == bdry_normal_axis;
+        const int lower = (normal ? bc_fill_box.lower()(d) : std::max(bc_fill_box.lower()(d), patch_box.lower()(d)));
+        const int upper = (normal ? bc_fill_box.upper()(d) : std::min(bc_fill_box.upper()(d), patch_box.upper()(d)));
+        if (upper < lower) return;
+        fine_lower(d) = lower;
+        fine_stride(d) = (normal ? 1 : ratio(d));
+        coarse_cell_box.upper()(d) = (upper - lower) / fine_stride(d);
+    }
+    for (Box<NDIM>::Iterator b(coarse_cell_box); b; b++)
+    {
+        Index<NDIM> i_fine, i_crse;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            i_fine(d) = fine_lower(d) + b()(d) * fine_stride(d);
+            i_crse(d) = coarsen(i_fine(d), ratio(d));
+        }
+
+        // The normal component is interpolated along the coarse-fine
+        // interface itself.
+        Index<NDIM> i_fine_normal(i_fine), i_crse_normal(i_crse);
+        if (!is_lower)
+        {
+            i_fine_normal(bdry_normal_axis) += 1;
+            i_crse_normal(bdry_normal_axis) += 1;
+        }
+        compile_tangential_stencils_for_coarse_cell(stencils,
+                                                    bdry_normal_axis,
+                                                    bdry_normal_axis,
+                                                    i_fine_normal,
+                                                    i_crse_normal,
+                                                    ratio,
+                                                    quad_wgt,
+                                                    cubic_wgt,
+                                                    indicator_data);
+
+        // The tangential components are interpolated at the centers of the
+        // ghost cells.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            if (axis == bdry_normal_axis) continue;
+            compile_tangential_stencils_for_coarse_cell(
+                stencils, axis, bdry_normal_axis, i_fine, i_crse, ratio, quad_wgt, cubic_wgt, indicator_data);
+        }
+    }
+    return;
+} // compile_tangential_stencils
+
+// Compile the stencils used to interpolate fine data in the normal direction
+// along a co-dimension 1 coarse-fine interface boundary box.  These stencils
+// use the same interpolation weights as the scquadnormalinterpolation kernels.
+void
+compile_normal_extension_stencils(CFInterpolationStencilTable& stencils,
+                                  const Box<NDIM>& patch_box,
+                                  const Box<NDIM>& bc_fill_box,
+                                  const unsigned int location_index,
+                                  const IntVector<NDIM>& ratio,
+                                  const SideData<NDIM, int>& indicator_data)
+{
+    const unsigned int bdry_normal_axis = location_index / 2;
+    const bool is_lower = location_index % 2 == 0;
+    const int gcw = bc_fill_box.numberCells(bdry_normal_axis);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(gcw <= MAX_GCW);
+#endif
+    const double R = static_cast<double>(ratio(bdry_normal_axis));
+    const int i_bdry = (is_lower ? bc_fill_box.upper()(bdry_normal_axis) : bc_fill_box.lower()(bdry_normal_axis));
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        // The normal component is located on the cell faces, whereas the
+        // tangential components are located at the cell centers, in the
+        // direction normal to the interface.
+        const bool normal_component = axis == bdry_normal_axis;
+        double wgt[MAX_GCW][3];
+        for (int p = 0; p < gcw; ++p)
+        {
+            if (normal_component)
+            {
+                const double t = static_cast<double>(p) + 1.0;
+                wgt[p][0] = -t * (-t + R) / (1.0 + R);
+                wgt[p][1] = (R * t + R - t * t - t) / R;
+                wgt[p][2] = t * (t + 1.0) / R / (1.0 + R);
+            }
+            else
+            {
+                const double t = static_cast<double>(p) + 0.5;
+                wgt[p][0] = 0.5 * (-2.0 * R * t - R + 4.0 * t * t + 2.0 * t) / (R + 3.0);
+                wgt[p][1] = -0.5 * (-2.0 * R * t - 3.0 * R + 4.0 * t * t + 6.0 * t) / (R + 1.0);
+                wgt[p][2] = (4.0 * t * t + 3.0 + 8.0 * t) / (R + 3.0) / (R + 1.0);
+            }
+        }
+        const int i_intr0 = (is_lower ? i_bdry + 1 : (normal_component ? i_bdry : i_bdry - 1));
+        const int i_intr1 = (is_lower ? i_bdry + 2 : (normal_component ? i_bdry - 1 : i_bdry - 2));
+
+        // Loop over the ghost values, using the normal index to count the
+        // distance from the interface.
+        Box<NDIM> ghost_box(Index<NDIM>(0), Index<NDIM>(0));
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (d == bdry_normal_axis)
+            {
+                ghost_box.upper()(d) = gcw - 1;
+            }
+            else
+            {
+                ghost_box.lower()(d) = std::max(bc_fill_box.lower()(d), patch_box.lower()(d));
+                ghost_box.upper()(d) = std::min(bc_fill_box.upper()(d), patch_box.upper()(d)) + (d == axis ? 1 : 0);
+            }
+        }
+        for (Box<NDIM>::Iterator b(ghost_box); b; b++)
+        {
+            const int p = b()(bdry_normal_axis);
+            Index<NDIM> i_dst(b()), i_src0(b()), i_src1(b());
+            i_dst(bdry_normal_axis) = (is_lower ? i_bdry - p : (normal_component ? i_bdry + p + 1 : i_bdry + p));
+            if (indicator_data(SideIndex<NDIM>(i_dst, axis, SideIndex<NDIM>::Lower)) == 1) continue;
+            i_src0(bdry_normal_axis) = i_intr0;
+            i_src1(bdry_normal_axis) = i_intr1;
+            stencils.beginStencil(axis, i_dst);
+            stencils.addStencilPoint(i_dst, wgt[p][2]);
+            stencils.addStencilPoint(i_src0, wgt[p][1]);
+            stencils.addStencilPoint(i_src1, wgt[p][0]);
+        }
+    }
+    return;
+} // compile_normal_extension_stencils
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -166,6 +420,7 @@ static const int GHOST_WIDTH_TO_FILL = 1;
 CartSideDoubleQuadraticCFInterpolation::CartSideDoubleQuadraticCFInterpolation()
     : d_patch_data_indices(),
       d_consistent_type_2_bdry(false),
+      d_use_precompiled_stencils(true),
       d_refine_op(new CartesianSideDoubleConservativeLinearRefine<NDIM>()),
       d_hierarchy(NULL),
       d_cf_boundary(),
@@ -252,112 +507,31 @@ CartSideDoubleQuadraticCFInterpolation::postprocessRefine(Patch<NDIM>& fine,
         TBOX_ASSERT(&fine == fine_level->getPatch(patch_num).getPointer());
     }
 #endif
-    // Get the co-dimension 1 cf boundary boxes.
+    if (!d_use_precompiled_stencils)
+    {
+        applyTangentialInterpolationKernels(fine, coarse, ratio);
+        return;
+    }
+
+    // Apply the precompiled tangential interpolation stencils.
     const int patch_num = fine.getPatchNumber();
     const int fine_patch_level_num = fine.getPatchLevelNumber();
-    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes =
-        d_cf_boundary[fine_patch_level_num]->getBoundaries(patch_num, 1);
-    if (cf_bdry_codim1_boxes.size() == 0) return;
-
-    // Get the patch data.
+    CFInterpolationStencilTable& stencils = d_tangential_stencils[fine_patch_level_num][patch_num];
+    if (stencils.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ratio == d_hierarchy->getPatchLevel(fine_patch_level_num)->getRatioToCoarserLevel());
+#endif
     for (std::set<int>::const_iterator cit = d_patch_data_indices.begin(); cit != d_patch_data_indices.end(); ++cit)
     {
         const int& patch_data_index = *cit;
         Pointer<SideData<NDIM, double> > fdata = fine.getPatchData(patch_data_index);
         Pointer<SideData<NDIM, double> > cdata = coarse.getPatchData(patch_data_index);
-        Pointer<SideData<NDIM, int> > indicator_data = fine.getPatchData(d_sc_indicator_idx);
 #if !defined(NDEBUG)
         TBOX_ASSERT(fdata);
         TBOX_ASSERT(cdata);
         TBOX_ASSERT(cdata->getDepth() == fdata->getDepth());
-        TBOX_ASSERT(indicator_data);
-#endif
-        const int U_fine_ghosts = (fdata->getGhostCellWidth()).max();
-        const int U_crse_ghosts = (cdata->getGhostCellWidth()).max();
-        const int indicator_ghosts = (indicator_data->getGhostCellWidth()).max();
-#if !defined(NDEBUG)
-        if (U_fine_ghosts != (fdata->getGhostCellWidth()).min())
-        {
-            TBOX_ERROR("CartSideDoubleQuadraticCFInterpolation::postprocessRefine():\n"
-                       << "   patch data does not have uniform ghost cell widths"
-                       << std::endl);
-        }
-        if (U_crse_ghosts != (cdata->getGhostCellWidth()).min())
-        {
-            TBOX_ERROR("CartSideDoubleQuadraticCFInterpolation::postprocessRefine():\n"
-                       << "   patch data does not have uniform ghost cell widths"
-                       << std::endl);
-        }
-        TBOX_ASSERT((indicator_data->getGhostCellWidth()).max() == GHOST_WIDTH_TO_FILL);
-        TBOX_ASSERT((indicator_data->getGhostCellWidth()).min() == GHOST_WIDTH_TO_FILL);
-#endif
-        const int data_depth = fdata->getDepth();
-        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom_fine = fine.getPatchGeometry();
-        const Box<NDIM>& patch_box_fine = fine.getBox();
-        const Box<NDIM>& patch_box_crse = coarse.getBox();
-        for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
-        {
-            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
-            const Box<NDIM> bc_fill_box = pgeom_fine->getBoundaryFillBox(bdry_box, patch_box_fine, ghost_width_to_fill);
-            const unsigned int location_index = bdry_box.getLocationIndex();
-            const int* const indicator0 = indicator_data->getPointer(0);
-            const int* const indicator1 = indicator_data->getPointer(1);
-#if (NDIM == 3)
-            const int* const indicator2 = indicator_data->getPointer(2);
-#endif
-            for (int depth = 0; depth < data_depth; ++depth)
-            {
-                double* const U_fine0 = fdata->getPointer(0, depth);
-                double* const U_fine1 = fdata->getPointer(1, depth);
-#if (NDIM == 3)
-                double* const U_fine2 = fdata->getPointer(2, depth);
 #endif
-                const double* const U_crse0 = cdata->getPointer(0, depth);
-                const double* const U_crse1 = cdata->getPointer(1, depth);
-#if (NDIM == 3)
-                const double* const U_crse2 = cdata->getPointer(2, depth);
-#endif
-                SC_QUAD_TANGENTIAL_INTERPOLATION_FC(U_fine0,
-                                                    U_fine1,
-#if (NDIM == 3)
-                                                    U_fine2,
-#endif
-                                                    U_fine_ghosts,
-                                                    U_crse0,
-                                                    U_crse1,
-#if (NDIM == 3)
-                                                    U_crse2,
-#endif
-                                                    U_crse_ghosts,
-                                                    indicator0,
-                                                    indicator1,
-#if (NDIM == 3)
-                                                    indicator2,
-#endif
-                                                    indicator_ghosts,
-                                                    patch_box_fine.lower(0),
-                                                    patch_box_fine.upper(0),
-                                                    patch_box_fine.lower(1),
-                                                    patch_box_fine.upper(1),
-#if (NDIM == 3)
-                                                    patch_box_fine.lower(2),
-                                                    patch_box_fine.upper(2),
-#endif
-                                                    patch_box_crse.lower(0),
-                                                    patch_box_crse.upper(0),
-                                                    patch_box_crse.lower(1),
-                                                    patch_box_crse.upper(1),
-#if (NDIM == 3)
-                                                    patch_box_crse.lower(2),
-                                                    patch_box_crse.upper(2),
-#endif
-                                                    location_index,
-                                                    ratio,
-                                                    bc_fill_box.lower(),
-                                                    bc_fill_box.upper());
-            }
-        }
+        stencils.apply(*fdata, *cdata);
     }
     return;
 } // postprocessRefine
@@ -369,6 +543,16 @@ CartSideDoubleQuadraticCFInterpolation::setConsistentInterpolationScheme(const b
     return;
 } // setConsistentInterpolationScheme
 
+void
+CartSideDoubleQuadraticCFInterpolation::setUsePrecompiledStencils(const bool use_precompiled_stencils)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_hierarchy);
+#endif
+    d_use_precompiled_stencils = use_precompiled_stencils;
+    return;
+} // setUsePrecompiledStencils
+
 void
 CartSideDoubleQuadraticCFInterpolation::setPatchDataIndex(const int patch_data_index)
 {
@@ -445,6 +629,49 @@ CartSideDoubleQuadraticCFInterpolation::setPatchHierarchy(Pointer<PatchHierarchy
         }
         refine_alg->createSchedule(d_hierarchy->getPatchLevel(ln))->fillData(0.0);
     }
+
+    // Compile the interpolation stencils for each local patch.  The stencils
+    // depend only on the configuration of the patch hierarchy, so they can be
+    // reused for every subsequent ghost cell fill.
+    if (!d_use_precompiled_stencils) return;
+    d_tangential_stencils.resize(finest_level_number + 1);
+    d_normal_stencils.resize(finest_level_number + 1);
+    const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
+    for (int ln = 0; ln <= finest_level_number; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        d_tangential_stencils[ln].resize(level->getNumberOfPatches());
+        d_normal_stencils[ln].resize(level->getNumberOfPatches());
+        if (ln == 0) continue;
+        const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const int patch_num = p();
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
+            Pointer<SideData<NDIM, int> > indicator_data = patch->getPatchData(d_sc_indicator_idx);
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[ln]->getBoundaries(patch_num, 1);
+            for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
+            {
+                const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
+                const Box<NDIM> bc_fill_box = pgeom->getBoundaryFillBox(bdry_box, patch_box, ghost_width_to_fill);
+                const unsigned int location_index = bdry_box.getLocationIndex();
+                compile_tangential_stencils(d_tangential_stencils[ln][patch_num],
+                                            patch_box,
+                                            bc_fill_box,
+                                            location_index,
+                                            ratio,
+                                            *indicator_data);
+                compile_normal_extension_stencils(d_normal_stencils[ln][patch_num],
+                                                  patch_box,
+                                                  bc_fill_box,
+                                                  location_index,
+                                                  ratio,
+                                                  *indicator_data);
+            }
+        }
+    }
     return;
 } // setPatchHierarchy
 
@@ -458,6 +685,8 @@ CartSideDoubleQuadraticCFInterpolation::clearPatchHierarchy()
         (*it) = NULL;
     }
     d_cf_boundary.clear();
+    d_tangential_stencils.clear();
+    d_normal_stencils.clear();
     return;
 } // clearPatchHierarchy
 
@@ -485,6 +714,158 @@ CartSideDoubleQuadraticCFInterpolation::computeNormalExtension(Patch<NDIM>& patc
         TBOX_ASSERT(&patch == level->getPatch(patch_num).getPointer());
     }
 #endif
+    if (!d_use_precompiled_stencils)
+    {
+        applyNormalExtensionKernels(patch, ratio);
+        return;
+    }
+
+    // Apply the precompiled normal extension stencils.  The stencils are
+    // evaluated using the original data values, so no copy of the data is
+    // required.
+    const int patch_num = patch.getPatchNumber();
+    const int patch_level_num = patch.getPatchLevelNumber();
+    CFInterpolationStencilTable& stencils = d_normal_stencils[patch_level_num][patch_num];
+    if (stencils.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ratio == d_hierarchy->getPatchLevel(patch_level_num)->getRatioToCoarserLevel());
+#else
+    NULL_USE(ratio);
+#endif
+    for (std::set<int>::const_iterator cit = d_patch_data_indices.begin(); cit != d_patch_data_indices.end(); ++cit)
+    {
+        const int& patch_data_index = *cit;
+        Pointer<SideData<NDIM, double> > data = patch.getPatchData(patch_data_index);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(data);
+#endif
+        stencils.apply(*data, *data);
+    }
+    return;
+} // computeNormalExtension
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+CartSideDoubleQuadraticCFInterpolation::applyTangentialInterpolationKernels(Patch<NDIM>& fine,
+                                                                            const Patch<NDIM>& coarse,
+                                                                            const IntVector<NDIM>& ratio)
+{
+    // Get the co-dimension 1 cf boundary boxes.
+    const int patch_num = fine.getPatchNumber();
+    const int fine_patch_level_num = fine.getPatchLevelNumber();
+    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes =
+        d_cf_boundary[fine_patch_level_num]->getBoundaries(patch_num, 1);
+    if (cf_bdry_codim1_boxes.size() == 0) return;
+
+    // Get the patch data.
+    for (std::set<int>::const_iterator cit = d_patch_data_indices.begin(); cit != d_patch_data_indices.end(); ++cit)
+    {
+        const int& patch_data_index = *cit;
+        Pointer<SideData<NDIM, double> > fdata = fine.getPatchData(patch_data_index);
+        Pointer<SideData<NDIM, double> > cdata = coarse.getPatchData(patch_data_index);
+        Pointer<SideData<NDIM, int> > indicator_data = fine.getPatchData(d_sc_indicator_idx);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(fdata);
+        TBOX_ASSERT(cdata);
+        TBOX_ASSERT(cdata->getDepth() == fdata->getDepth());
+        TBOX_ASSERT(indicator_data);
+#endif
+        const int U_fine_ghosts = (fdata->getGhostCellWidth()).max();
+        const int U_crse_ghosts = (cdata->getGhostCellWidth()).max();
+        const int indicator_ghosts = (indicator_data->getGhostCellWidth()).max();
+#if !defined(NDEBUG)
+        if (U_fine_ghosts != (fdata->getGhostCellWidth()).min())
+        {
+            TBOX_ERROR("CartSideDoubleQuadraticCFInterpolation::applyTangentialInterpolationKernels():\n"
+                       << "   patch data does not have uniform ghost cell widths"
+                       << std::endl);
+        }
+        if (U_crse_ghosts != (cdata->getGhostCellWidth()).min())
+        {
+            TBOX_ERROR("CartSideDoubleQuadraticCFInterpolation::applyTangentialInterpolationKernels():\n"
+                       << "   patch data does not have uniform ghost cell widths"
+                       << std::endl);
+        }
+        TBOX_ASSERT((indicator_data->getGhostCellWidth()).max() == GHOST_WIDTH_TO_FILL);
+        TBOX_ASSERT((indicator_data->getGhostCellWidth()).min() == GHOST_WIDTH_TO_FILL);
+#endif
+        const int data_depth = fdata->getDepth();
+        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom_fine = fine.getPatchGeometry();
+        const Box<NDIM>& patch_box_fine = fine.getBox();
+        const Box<NDIM>& patch_box_crse = coarse.getBox();
+        for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
+        {
+            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
+            const Box<NDIM> bc_fill_box = pgeom_fine->getBoundaryFillBox(bdry_box, patch_box_fine, ghost_width_to_fill);
+            const unsigned int location_index = bdry_box.getLocationIndex();
+            const int* const indicator0 = indicator_data->getPointer(0);
+            const int* const indicator1 = indicator_data->getPointer(1);
+#if (NDIM == 3)
+            const int* const indicator2 = indicator_data->getPointer(2);
+#endif
+            for (int depth = 0; depth < data_depth; ++depth)
+            {
+                double* const U_fine0 = fdata->getPointer(0, depth);
+                double* const U_fine1 = fdata->getPointer(1, depth);
+#if (NDIM == 3)
+                double* const U_fine2 = fdata->getPointer(2, depth);
+#endif
+                const double* const U_crse0 = cdata->getPointer(0, depth);
+                const double* const U_crse1 = cdata->getPointer(1, depth);
+#if (NDIM == 3)
+                const double* const U_crse2 = cdata->getPointer(2, depth);
+#endif
+                SC_QUAD_TANGENTIAL_INTERPOLATION_FC(U_fine0,
+                                                    U_fine1,
+#if (NDIM == 3)
+                                                    U_fine2,
+#endif
+                                                    U_fine_ghosts,
+                                                    U_crse0,
+                                                    U_crse1,
+#if (NDIM == 3)
+                                                    U_crse2,
+#endif
+                                                    U_crse_ghosts,
+                                                    indicator0,
+                                                    indicator1,
+#if (NDIM == 3)
+                                                    indicator2,
+#endif
+                                                    indicator_ghosts,
+                                                    patch_box_fine.lower(0),
+                                                    patch_box_fine.upper(0),
+                                                    patch_box_fine.lower(1),
+                                                    patch_box_fine.upper(1),
+#if (NDIM == 3)
+                                                    patch_box_fine.lower(2),
+                                                    patch_box_fine.upper(2),
+#endif
+                                                    patch_box_crse.lower(0),
+                                                    patch_box_crse.upper(0),
+                                                    patch_box_crse.lower(1),
+                                                    patch_box_crse.upper(1),
+#if (NDIM == 3)
+                                                    patch_box_crse.lower(2),
+                                                    patch_box_crse.upper(2),
+#endif
+                                                    location_index,
+                                                    ratio,
+                                                    bc_fill_box.lower(),
+                                                    bc_fill_box.upper());
+            }
+        }
+    }
+    return;
+} // applyTangentialInterpolationKernels
+
+void
+CartSideDoubleQuadraticCFInterpolation::applyNormalExtensionKernels(Patch<NDIM>& patch, const IntVector<NDIM>& ratio)
+{
     // Get the co-dimension 1 cf boundary boxes.
     const int patch_num = patch.getPatchNumber();
     const int patch_level_num = patch.getPatchLevelNumber();
@@ -513,13 +894,13 @@ CartSideDoubleQuadraticCFInterpolation::computeNormalExtension(Patch<NDIM>& patc
 #if !defined(NDEBUG)
         if (U_ghosts != (data->getGhostCellWidth()).min())
         {
-            TBOX_ERROR("CartSideDoubleQuadraticCFInterpolation::computeNormalExtension():\n"
+            TBOX_ERROR("CartSideDoubleQuadraticCFInterpolation::applyNormalExtensionKernels():\n"
                        << "   patch data does not have uniform ghost cell widths"
                        << std::endl);
         }
         if (W_ghosts != (data_copy.getGhostCellWidth()).min())
         {
-            TBOX_ERROR("CartSideDoubleQuadraticCFInterpolation::computeNormalExtension():\n"
+            TBOX_ERROR("CartSideDoubleQuadraticCFInterpolation::applyNormalExtensionKernels():\n"
                        << "   patch data does not have uniform ghost cell widths"
                        << std::endl);
         }
@@ -586,11 +967,7 @@ CartSideDoubleQuadraticCFInterpolation::computeNormalExtension(Patch<NDIM>& patc
         }
     }
     return;
-} // computeNormalExtension
-
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
+} // applyNormalExtensionKernels
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
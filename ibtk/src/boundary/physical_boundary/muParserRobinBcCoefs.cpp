@@ -46,7 +46,9 @@
 #include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
+#include "boost/array.hpp"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/muParserBulkEvaluator.h"
 #include "ibtk/muParserRobinBcCoefs.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "muParser.h"
@@ -74,6 +76,26 @@ namespace IBTK
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
+
+inline void
+set_coef_data(ArrayData<NDIM, double>& coef_data,
+              muParserBulkEvaluator& evaluator,
+              std::vector<double>& values,
+              const Index<NDIM>& patch_lower,
+              const double* const x_lower,
+              const double* const dx,
+              const boost::array<double, NDIM>& offset,
+              const double fill_time)
+{
+    const Box<NDIM>& coef_box = coef_data.getBox();
+    evaluator.evaluate(values, coef_box, patch_lower, x_lower, dx, offset, fill_time);
+    int k = 0;
+    for (Box<NDIM>::Iterator b(coef_box); b; b++, ++k)
+    {
+        coef_data(b(), 0) = values[k];
+    }
+    return;
+} // set_coef_data
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -89,8 +111,9 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
       d_acoef_parsers(2 * NDIM),
       d_bcoef_parsers(2 * NDIM),
       d_gcoef_parsers(2 * NDIM),
-      d_parser_time(new double),
-      d_parser_posn(new Point)
+      d_acoef_evaluators(2 * NDIM),
+      d_bcoef_evaluators(2 * NDIM),
+      d_gcoef_evaluators(2 * NDIM)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -318,28 +341,45 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         {
             (*cit)->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        (*cit)->DefineVar("T", d_parser_time);
-        (*cit)->DefineVar("t", d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Setup the bulk evaluators, which define the time and position variables
+    // and determine which of these variables are used by each function.
+    try
+    {
+        for (int d = 0; d < 2 * NDIM; ++d)
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            (*cit)->DefineVar("X" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("X_" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x_" + postfix, &d_parser_posn->data()[d]);
+            d_acoef_evaluators[d] = new muParserBulkEvaluator(&d_acoef_parsers[d]);
+            d_bcoef_evaluators[d] = new muParserBulkEvaluator(&d_bcoef_parsers[d]);
+            d_gcoef_evaluators[d] = new muParserBulkEvaluator(&d_gcoef_parsers[d]);
         }
     }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
     return;
 } // muParserRobinBcCoefs
 
 muParserRobinBcCoefs::~muParserRobinBcCoefs()
 {
-    delete d_parser_time;
-    delete d_parser_posn;
+    for (int d = 0; d < 2 * NDIM; ++d)
+    {
+        delete d_acoef_evaluators[d];
+        delete d_bcoef_evaluators[d];
+        delete d_gcoef_evaluators[d];
+    }
     return;
 } // ~muParserRobinBcCoefs
 
@@ -369,48 +409,70 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!acoef_data || bc_coef_box == acoef_data->getBox());
     TBOX_ASSERT(!bcoef_data || bc_coef_box == bcoef_data->getBox());
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
+#else
+    NULL_USE(bc_coef_box);
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    *d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    // Evaluate the coefficients in bulk over the boundary box.  Positions are
+    // located at cell centers in the tangential directions and at cell faces in
+    // the normal direction.
+    boost::array<double, NDIM> offset;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        const Index<NDIM>& i = b();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            if (d != bdry_normal_axis)
-            {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-            }
-            else
-            {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-            }
-        }
-        try
+        offset[d] = (d == bdry_normal_axis ? 0.0 : 0.5);
+    }
+    std::vector<double> values;
+    try
+    {
+        if (acoef_data)
         {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
+            set_coef_data(*acoef_data,
+                          *d_acoef_evaluators[location_index],
+                          values,
+                          patch_lower,
+                          x_lower,
+                          dx,
+                          offset,
+                          fill_time);
         }
-        catch (mu::ParserError& e)
+        if (bcoef_data)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: "
-                       << e.GetMsg()
-                       << "\n"
-                       << "  in:    "
-                       << e.GetExpr()
-                       << "\n");
+            set_coef_data(*bcoef_data,
+                          *d_bcoef_evaluators[location_index],
+                          values,
+                          patch_lower,
+                          x_lower,
+                          dx,
+                          offset,
+                          fill_time);
         }
-        catch (...)
+        if (gcoef_data)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
+            set_coef_data(*gcoef_data,
+                          *d_gcoef_evaluators[location_index],
+                          values,
+                          patch_lower,
+                          x_lower,
+                          dx,
+                          offset,
+                          fill_time);
         }
     }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
     return;
 } // setBcCoefs
 
@@ -85,6 +85,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -105,6 +106,7 @@
 #include "libmesh/mesh_base.h"
 #include "libmesh/node.h"
 #include "libmesh/numeric_vector.h"
+#include "libmesh/partitioner.h"
 #include "libmesh/petsc_linear_solver.h"
 #include "libmesh/petsc_matrix.h"
 #include "libmesh/petsc_vector.h"
@@ -155,6 +157,7 @@ namespace
 {
 // Timers.
 static Timer* t_reinit_element_mappings;
+static Timer* t_repartition_mesh;
 static Timer* t_build_ghosted_solution_vector;
 static Timer* t_spread;
 static Timer* t_prolong_data;
@@ -173,6 +176,10 @@ static Timer* t_put_to_database;
 // Version of FEDataManager restart file data.
 static const int FE_DATA_MANAGER_VERSION = 1;
 
+// The active element bounding box tree is rebuilt (rather than refit) when the
+// total extent of its nodes grows by more than this factor.
+static const double BBOX_TREE_REBUILD_FACTOR = 2.0;
+
 // Local helper functions.
 struct ElemComp : std::binary_function<Elem*, Elem*, bool>
 {
@@ -195,6 +202,41 @@ collect_unique_elems(std::vector<Elem*>& elems, const ContainerOfContainers& ele
     return;
 } // collect_unique_elems
 
+// Collect the DOF indices of all of the DOF objects of a replicated mesh in a
+// fixed order that does not depend on the partitioning of the mesh.
+inline void
+collect_dof_object_indices(std::vector<dof_id_type>& dof_indices, const MeshBase& mesh, const System& system)
+{
+    dof_indices.clear();
+    const unsigned int sys_num = system.number();
+    const unsigned int n_vars = system.n_vars();
+    const MeshBase::const_node_iterator nd_end = mesh.nodes_end();
+    for (MeshBase::const_node_iterator nd_it = mesh.nodes_begin(); nd_it != nd_end; ++nd_it)
+    {
+        const Node* const node = *nd_it;
+        for (unsigned int var_num = 0; var_num < n_vars; ++var_num)
+        {
+            for (unsigned int comp = 0; comp < node->n_comp(sys_num, var_num); ++comp)
+            {
+                dof_indices.push_back(node->dof_number(sys_num, var_num, comp));
+            }
+        }
+    }
+    const MeshBase::const_element_iterator el_end = mesh.elements_end();
+    for (MeshBase::const_element_iterator el_it = mesh.elements_begin(); el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        for (unsigned int var_num = 0; var_num < n_vars; ++var_num)
+        {
+            for (unsigned int comp = 0; comp < elem->n_comp(sys_num, var_num); ++comp)
+            {
+                dof_indices.push_back(elem->dof_number(sys_num, var_num, comp));
+            }
+        }
+    }
+    return;
+} // collect_dof_object_indices
+
 inline short int
 get_dirichlet_bdry_ids(const std::vector<short int>& bdry_ids)
 {
@@ -439,6 +481,96 @@ FEDataManager::reinitElementMappings()
     return;
 } // reinitElementMappings
 
+void
+FEDataManager::repartitionMesh(Partitioner& partitioner)
+{
+    IBTK_TIMER_START(t_repartition_mesh);
+
+    MeshBase& mesh = d_es->get_mesh();
+    TBOX_ASSERT(mesh.is_serial());
+
+    // Store the data of each system vector in a form that does not depend on
+    // the parallel distribution of the mesh.
+    const unsigned int n_systems = d_es->n_systems();
+    std::vector<std::vector<dof_id_type> > old_dof_indices(n_systems);
+    std::vector<std::vector<std::vector<double> > > vec_vals(n_systems);
+    for (unsigned int sys_num = 0; sys_num < n_systems; ++sys_num)
+    {
+        System& system = d_es->get_system(sys_num);
+        collect_dof_object_indices(old_dof_indices[sys_num], mesh, system);
+        vec_vals[sys_num].push_back(std::vector<double>());
+        system.solution->localize(vec_vals[sys_num].back());
+        for (System::vectors_iterator it = system.vectors_begin(); it != system.vectors_end(); ++it)
+        {
+            vec_vals[sys_num].push_back(std::vector<double>());
+            it->second->localize(vec_vals[sys_num].back());
+        }
+    }
+
+    // Repartition the mesh and redistribute the degrees of freedom.
+    partitioner.partition(mesh, mesh.n_processors());
+    d_es->reinit();
+
+    // Restore the values of the system vectors.
+    std::vector<dof_id_type> new_dof_indices;
+    for (unsigned int sys_num = 0; sys_num < n_systems; ++sys_num)
+    {
+        System& system = d_es->get_system(sys_num);
+        collect_dof_object_indices(new_dof_indices, mesh, system);
+        TBOX_ASSERT(new_dof_indices.size() == old_dof_indices[sys_num].size());
+        std::vector<NumericVector<double>*> vecs(1, system.solution.get());
+        for (System::vectors_iterator it = system.vectors_begin(); it != system.vectors_end(); ++it)
+        {
+            vecs.push_back(it->second);
+        }
+        for (unsigned int k = 0; k < vecs.size(); ++k)
+        {
+            NumericVector<double>& vec = *vecs[k];
+            const std::vector<double>& vals = vec_vals[sys_num][k];
+            const dof_id_type first_local_idx = vec.first_local_index();
+            const dof_id_type last_local_idx = vec.last_local_index();
+            for (unsigned int i = 0; i < new_dof_indices.size(); ++i)
+            {
+                const dof_id_type new_idx = new_dof_indices[i];
+                if (first_local_idx <= new_idx && new_idx < last_local_idx)
+                {
+                    vec.set(new_idx, vals[old_dof_indices[sys_num][i]]);
+                }
+            }
+            vec.close();
+        }
+        system.update();
+    }
+
+    // Clear cached data that depend on the distribution of the degrees of
+    // freedom.
+    d_system_dof_map_cache.clear();
+    for (std::map<std::string, LinearSolver<double>*>::iterator it = d_L2_proj_solver.begin();
+         it != d_L2_proj_solver.end();
+         ++it)
+    {
+        delete it->second;
+    }
+    d_L2_proj_solver.clear();
+    for (std::map<std::string, SparseMatrix<double>*>::iterator it = d_L2_proj_matrix.begin();
+         it != d_L2_proj_matrix.end();
+         ++it)
+    {
+        delete it->second;
+    }
+    d_L2_proj_matrix.clear();
+    for (std::map<std::string, NumericVector<double>*>::iterator it = d_L2_proj_matrix_diag.begin();
+         it != d_L2_proj_matrix_diag.end();
+         ++it)
+    {
+        delete it->second;
+    }
+    d_L2_proj_matrix_diag.clear();
+
+    IBTK_TIMER_STOP(t_repartition_mesh);
+    return;
+} // repartitionMesh
+
 NumericVector<double>*
 FEDataManager::getSolutionVector(const std::string& system_name) const
 {
@@ -569,7 +701,9 @@ FEDataManager::spread(const int f_data_idx,
 
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
+    if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
     /*if (!F_vec.closed())*/ F_vec.close();
+    if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
     PetscVector<double>* F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec);
     Vec F_global_vec = F_petsc_vec->vec();
     Vec F_local_vec;
@@ -577,7 +711,9 @@ FEDataManager::spread(const int f_data_idx,
     double* F_local_soln;
     VecGetArray(F_local_vec, &F_local_soln);
 
+    if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
     /*if (!X_vec.closed())*/ X_vec.close();
+    if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
     PetscVector<double>* X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
     Vec X_global_vec = X_petsc_vec->vec();
     Vec X_local_vec;
@@ -1019,12 +1155,14 @@ FEDataManager::interpWeighted(const int f_data_idx,
 
     // Communicate any unsynchronized ghost data and extract the underlying
     // solution data.
+    if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
     for (unsigned int k = 0; k < f_refine_scheds.size(); ++k)
     {
         if (f_refine_scheds[k]) f_refine_scheds[k]->fillData(fill_data_time);
     }
 
     /*if (!X_vec.closed())*/ X_vec.close();
+    if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
     PetscVector<double>* X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
     Vec X_global_vec = X_petsc_vec->vec();
     Vec X_local_vec;
@@ -1185,7 +1323,9 @@ FEDataManager::interpWeighted(const int f_data_idx,
             qp_offset += n_qp;
         }
     }
+    if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
     F_vec.close();
+    if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
 
     VecRestoreArray(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
@@ -1708,6 +1848,7 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
                                    const unsigned int max_its)
 {
     IBTK_TIMER_START(t_compute_l2_projection);
+    if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
 
     int ierr;
     bool converged = false;
@@ -1751,6 +1892,7 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
     U_vec.close();
     dof_map.enforce_constraints_exactly(system, &U_vec);
 
+    if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
     IBTK_TIMER_STOP(t_compute_l2_projection);
     return converged;
 } // computeL2Projection
@@ -1840,13 +1982,33 @@ FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int fines
     {
         updateQuadPointCountData(ln, ln);
         HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, ln, ln);
-        hier_cc_data_ops.add(d_workload_idx, d_qp_count_idx, d_workload_idx);
+        hier_cc_data_ops.axpy(d_workload_idx, d_qp_work, d_qp_count_idx, d_workload_idx);
     }
 
     IBTK_TIMER_STOP(t_update_workload_estimates);
     return;
 } // updateWorkloadEstimates
 
+void
+FEDataManager::setQuadPointWorkloadWeight(const double qp_work)
+{
+    d_qp_work = qp_work;
+    return;
+} // setQuadPointWorkloadWeight
+
+void
+FEDataManager::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    d_workload_cost_model = workload_cost_model;
+    return;
+} // registerWorkloadCostModel
+
+double
+FEDataManager::getNumberOfLocalQuadPoints() const
+{
+    return d_num_local_quad_points;
+} // getNumberOfLocalQuadPoints
+
 void
 FEDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                                    const int level_number,
@@ -2066,6 +2228,8 @@ FEDataManager::FEDataManager(const std::string& object_name,
       d_hierarchy(NULL),
       d_coarsest_ln(-1),
       d_finest_ln(-1),
+      d_qp_work(1.0),
+      d_num_local_quad_points(0.0),
       d_default_interp_spec(default_interp_spec),
       d_default_spread_spec(default_spread_spec),
       d_ghost_width(ghost_width),
@@ -2101,6 +2265,7 @@ FEDataManager::FEDataManager(const std::string& object_name,
     IBTK_DO_ONCE(
         t_reinit_element_mappings =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::reinitElementMappings()");
+        t_repartition_mesh = TimerManager::getManager()->getTimer("IBTK::FEDataManager::repartitionMesh()");
         t_build_ghosted_solution_vector =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildGhostedSolutionVector()");
         t_spread = TimerManager::getManager()->getTimer("IBTK::FEDataManager::spread()");
@@ -2169,6 +2334,7 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
         HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, ln, ln);
         hier_cc_data_ops.setToScalar(d_qp_count_idx, 0.0);
         if (ln != d_level_number) continue;
+        d_num_local_quad_points = 0.0;
 
         // Extract the mesh.
         const MeshBase& mesh = d_es->get_mesh();
@@ -2237,7 +2403,11 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
                 {
                     interpolate(&X_qp[0], qp, X_node, phi);
                     const Index<NDIM> i = IndexUtilities::getCellIndex(X_qp, grid_geom, ratio);
-                    if (patch_box.contains(i)) (*qp_count_data)(i) += 1.0;
+                    if (patch_box.contains(i))
+                    {
+                        (*qp_count_data)(i) += 1.0;
+                        d_num_local_quad_points += 1.0;
+                    }
                 }
             }
         }
@@ -2324,6 +2494,34 @@ FEDataManager::computeActiveElementBoundingBoxes()
     return &d_active_elem_bboxes;
 } // computeActiveElementBoundingBoxes
 
+void
+FEDataManager::updateActiveElementBoundingBoxTree()
+{
+    const MeshBase& mesh = d_es->get_mesh();
+    std::vector<unsigned int> active_elem_ids;
+    d_active_elem_ptrs.resize(d_active_elem_bboxes.size());
+    std::fill(d_active_elem_ptrs.begin(), d_active_elem_ptrs.end(), static_cast<Elem*>(NULL));
+    MeshBase::const_element_iterator el_it = mesh.active_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
+    for (; el_it != el_end; ++el_it)
+    {
+        Elem* const elem = *el_it;
+        const unsigned int elem_id = elem->id();
+        active_elem_ids.push_back(elem_id);
+        d_active_elem_ptrs[elem_id] = elem;
+    }
+
+    // Refit the existing tree when possible.  The tree is rebuilt if the set
+    // of active elements has changed or if the refit tree has degraded too
+    // much relative to the tree that was originally built.
+    if (d_active_elem_bbox_tree.empty() || active_elem_ids != d_active_elem_bbox_tree.getBoxIDs() ||
+        d_active_elem_bbox_tree.refit(d_active_elem_bboxes) > BBOX_TREE_REBUILD_FACTOR)
+    {
+        d_active_elem_bbox_tree.build(d_active_elem_bboxes, active_elem_ids);
+    }
+    return;
+} // updateActiveElementBoundingBoxTree
+
 void
 FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& active_patch_elems,
                                           const int level_number,
@@ -2362,7 +2560,13 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     // processor will have access to all of the element bounding boxes.  This is
     // not a scalable approach, but we won't worry about this until it becomes
     // an actual issue.
+    //
+    // Candidate elements are obtained from a bounding box tree, so that the
+    // cost of associating elements with patches scales like the number of
+    // intersecting elements rather than the total number of elements.
     computeActiveElementBoundingBoxes();
+    updateActiveElementBoundingBoxTree();
+    std::vector<unsigned int> candidate_elem_ids;
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
@@ -2380,12 +2584,14 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
             x_upper[d] += dx[d] * ghost_width[d];
         }
 
-        MeshBase::const_element_iterator el_it = mesh.active_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
-        for (; el_it != el_end; ++el_it)
+        candidate_elem_ids.clear();
+        d_active_elem_bbox_tree.collectIntersectingBoxes(candidate_elem_ids, x_lower, x_upper);
+        for (std::vector<unsigned int>::const_iterator cit = candidate_elem_ids.begin();
+             cit != candidate_elem_ids.end();
+             ++cit)
         {
-            Elem* const elem = *el_it;
-            const unsigned int elem_id = elem->id();
+            const unsigned int elem_id = *cit;
+            Elem* const elem = d_active_elem_ptrs[elem_id];
             const Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
             const Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
             bool in_patch = true;
@@ -0,0 +1,253 @@
+// Filename: FEPatchPartitioner.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "IBTK_config.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "ibtk/BoundingBoxTree.h"
+#include "ibtk/FEDataManager.h"
+#include "ibtk/FEPatchPartitioner.h"
+#include "ibtk/IndexUtilities.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "libmesh/auto_ptr.h"
+#include "libmesh/elem.h"
+#include "libmesh/equation_systems.h"
+#include "libmesh/id_types.h"
+#include "libmesh/mesh_base.h"
+#include "libmesh/node.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/partitioner.h"
+#include "libmesh/system.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+FEPatchPartitioner::FEPatchPartitioner(FEDataManager* const fe_data_manager, const double max_imbalance)
+    : d_fe_data_manager(fe_data_manager), d_max_imbalance(max_imbalance)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_fe_data_manager);
+    TBOX_ASSERT(d_max_imbalance >= 0.0);
+#endif
+    return;
+} // FEPatchPartitioner
+
+FEPatchPartitioner::~FEPatchPartitioner()
+{
+    // intentionally blank
+    return;
+} // ~FEPatchPartitioner
+
+UniquePtr<Partitioner>
+FEPatchPartitioner::clone() const
+{
+    return UniquePtr<Partitioner>(new FEPatchPartitioner(d_fe_data_manager, d_max_imbalance));
+} // clone
+
+double
+FEPatchPartitioner::computeMisalignedElementFraction(const MeshBase& mesh) const
+{
+    std::vector<processor_id_type> elem_procs;
+    computeElementAssignments(elem_procs, mesh, mesh.n_processors());
+    unsigned int n_active_elems = 0, n_misaligned_elems = 0;
+    const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
+    for (MeshBase::const_element_iterator el_it = mesh.active_elements_begin(); el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        ++n_active_elems;
+        if (elem->processor_id() != elem_procs[elem->id()]) ++n_misaligned_elems;
+    }
+    return n_active_elems > 0 ? static_cast<double>(n_misaligned_elems) / static_cast<double>(n_active_elems) : 0.0;
+} // computeMisalignedElementFraction
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+FEPatchPartitioner::_do_partition(MeshBase& mesh, const unsigned int n)
+{
+    std::vector<processor_id_type> elem_procs;
+    computeElementAssignments(elem_procs, mesh, n);
+    const MeshBase::element_iterator el_end = mesh.active_elements_end();
+    for (MeshBase::element_iterator el_it = mesh.active_elements_begin(); el_it != el_end; ++el_it)
+    {
+        Elem* const elem = *el_it;
+        elem->processor_id() = elem_procs[elem->id()];
+    }
+    return;
+} // _do_partition
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+FEPatchPartitioner::computeElementAssignments(std::vector<processor_id_type>& elem_procs,
+                                              const MeshBase& mesh,
+                                              const unsigned int n) const
+{
+    if (!mesh.is_serial())
+    {
+        TBOX_ERROR("FEPatchPartitioner::computeElementAssignments():\n"
+                   << "  patch-aligned partitioning requires a replicated mesh." << std::endl);
+    }
+
+    // Get the patch level on which the mesh is embedded.
+    Pointer<PatchHierarchy<NDIM> > hierarchy = d_fe_data_manager->getPatchHierarchy();
+    const int level_number = d_fe_data_manager->getLevelNumber();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(level_number >= 0 && level_number <= hierarchy->getFinestLevelNumber());
+#endif
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const BoxArray<NDIM>& patch_boxes = level->getBoxes();
+    const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+
+    // Build a search tree over the (global) patch boxes in index space.
+    const int n_patches = patch_boxes.getNumberOfBoxes();
+    std::vector<std::pair<Point, Point> > patch_bboxes(n_patches);
+    std::vector<unsigned int> patch_ids(n_patches);
+    for (int k = 0; k < n_patches; ++k)
+    {
+        const Box<NDIM>& patch_box = patch_boxes[k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            patch_bboxes[k].first[d] = static_cast<double>(patch_box.lower()(d));
+            patch_bboxes[k].second[d] = static_cast<double>(patch_box.upper()(d) + 1);
+        }
+        patch_ids[k] = k;
+    }
+    BoundingBoxTree patch_tree;
+    patch_tree.build(patch_bboxes, patch_ids);
+
+    // Obtain the current coordinates of all of the nodes of the mesh.
+    EquationSystems* equation_systems = d_fe_data_manager->getEquationSystems();
+    System& X_system = equation_systems->get_system(d_fe_data_manager->COORDINATES_SYSTEM_NAME);
+    const unsigned int X_sys_num = X_system.number();
+    std::vector<double> X_vals;
+    X_system.solution->localize(X_vals);
+
+    // Assign each active element to the processor that owns the patch that
+    // contains its centroid.  Elements whose centroids lie outside of the patch
+    // level retain their current assignments.
+    elem_procs.resize(mesh.max_elem_id());
+    std::vector<unsigned int> n_proc_elems(n, 0);
+    std::vector<unsigned int> candidate_patch_ids;
+    unsigned int n_active_elems = 0;
+    const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
+    for (MeshBase::const_element_iterator el_it = mesh.active_elements_begin(); el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        const unsigned int n_nodes = elem->n_nodes();
+        Point X_centroid = Point::Zero();
+        for (unsigned int k = 0; k < n_nodes; ++k)
+        {
+            const Node* const node = elem->get_node(k);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X_centroid[d] += X_vals[node->dof_number(X_sys_num, d, 0)];
+            }
+        }
+        X_centroid /= static_cast<double>(n_nodes);
+        const Index<NDIM> i = IndexUtilities::getCellIndex(X_centroid, grid_geom, ratio);
+        Point i_center;
+        for (unsigned int d = 0; d < NDIM; ++d) i_center[d] = static_cast<double>(i(d)) + 0.5;
+        candidate_patch_ids.clear();
+        patch_tree.collectIntersectingBoxes(candidate_patch_ids, i_center, i_center);
+        processor_id_type proc = std::min(elem->processor_id(), static_cast<processor_id_type>(n - 1));
+        for (std::vector<unsigned int>::const_iterator cit = candidate_patch_ids.begin();
+             cit != candidate_patch_ids.end();
+             ++cit)
+        {
+            if (patch_boxes[*cit].contains(i))
+            {
+                proc = static_cast<processor_id_type>(processor_mapping.getProcessorAssignment(*cit));
+                break;
+            }
+        }
+        elem_procs[elem->id()] = proc;
+        ++n_proc_elems[proc];
+        ++n_active_elems;
+    }
+
+    // Cap the number of elements assigned to each processor.  All processes
+    // perform the same computation on the same data, so that the resulting
+    // assignments are consistent without additional communication.
+    const unsigned int max_proc_elems = static_cast<unsigned int>(
+        std::ceil((1.0 + d_max_imbalance) * static_cast<double>(n_active_elems) / static_cast<double>(n)));
+    std::vector<unsigned int> n_kept_elems(n, 0);
+    for (MeshBase::const_element_iterator el_it = mesh.active_elements_begin(); el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        processor_id_type& proc = elem_procs[elem->id()];
+        if (n_kept_elems[proc] < max_proc_elems)
+        {
+            ++n_kept_elems[proc];
+            continue;
+        }
+        const processor_id_type new_proc = static_cast<processor_id_type>(
+            std::min_element(n_proc_elems.begin(), n_proc_elems.end()) - n_proc_elems.begin());
+        --n_proc_elems[proc];
+        ++n_proc_elems[new_proc];
+        ++n_kept_elems[new_proc];
+        proc = new_proc;
+    }
+    return;
+} // computeElementAssignments
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -108,7 +108,9 @@
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/LTransaction.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/PhaseProfiler.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -447,8 +449,10 @@ LDataManager::spread(const int f_data_idx,
     {
         if (!levelContainsLagrangianData(ln)) continue;
 
+        if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
         if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
         if (ds_data_ghost_node_update) ds_data[ln]->endGhostUpdate();
+        if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
 
         const int depth = F_data[ln]->getDepth();
         F_ds_data[ln] = new LData("", getNumberOfLocalNodes(ln), depth, d_nonlocal_petsc_indices[ln]);
@@ -583,6 +587,7 @@ LDataManager::spread(const int f_data_idx,
                      const int finest_ln_in)
 {
     IBTK_TIMER_START(t_spread);
+    IBTK_PROFILER_SCOPE("LDataManager::spread");
 
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
@@ -630,14 +635,19 @@ LDataManager::spread(const int f_data_idx,
         // the coarser levels before spreading data on this level.
         if (ln > coarsest_ln && ln < static_cast<int>(f_prolongation_scheds.size()) && f_prolongation_scheds[ln])
         {
+            if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
             f_prolongation_scheds[ln]->fillData(fill_data_time);
+            if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
         }
 
         if (!levelContainsLagrangianData(ln)) continue;
+        IBTK_PROFILER_COUNT(MARKERS_COUNTER, getNumberOfLocalNodes(ln));
 
         // Spread data onto the grid.
+        if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
         if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
         if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
+        if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -732,6 +742,7 @@ LDataManager::interp(const int f_data_idx,
                      const int finest_ln_in)
 {
     IBTK_TIMER_START(t_interp);
+    IBTK_PROFILER_SCOPE("LDataManager::interp");
 
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
@@ -751,6 +762,7 @@ LDataManager::interp(const int f_data_idx,
     TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
 
     // Synchronize Eulerian values.
+    if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
     for (int ln = finest_ln; ln > coarsest_ln; --ln)
     {
         if (ln < static_cast<int>(f_synch_scheds.size()) && f_synch_scheds[ln])
@@ -758,16 +770,20 @@ LDataManager::interp(const int f_data_idx,
             f_synch_scheds[ln]->coarsenData();
         }
     }
+    if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
 
     // Interpolate data from the Eulerian grid to the Lagrangian mesh.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!levelContainsLagrangianData(ln)) continue;
+        IBTK_PROFILER_COUNT(MARKERS_COUNTER, getNumberOfLocalNodes(ln));
 
         if (ln < static_cast<int>(f_ghost_fill_scheds.size()) && f_ghost_fill_scheds[ln])
         {
+            if (d_workload_cost_model) d_workload_cost_model->startSynchronization();
             f_ghost_fill_scheds[ln]->fillData(fill_data_time);
+            if (d_workload_cost_model) d_workload_cost_model->stopSynchronization();
         }
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
@@ -1374,6 +1390,7 @@ void
 LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
     IBTK_TIMER_START(t_begin_data_redistribution);
+    IBTK_PROFILER_SCOPE("LDataManager::beginDataRedistribution");
 
     const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
     const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
@@ -1548,6 +1565,7 @@ void
 LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
     IBTK_TIMER_START(t_end_data_redistribution);
+    IBTK_PROFILER_SCOPE("LDataManager::endDataRedistribution");
 
     const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
     const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
@@ -2014,6 +2032,33 @@ LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest
     return;
 } // updateWorkloadEstimates
 
+void
+LDataManager::setNodeWorkloadWeight(const double beta_work)
+{
+    d_beta_work = beta_work;
+    return;
+} // setNodeWorkloadWeight
+
+void
+LDataManager::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    d_workload_cost_model = workload_cost_model;
+    return;
+} // registerWorkloadCostModel
+
+Pointer<WorkloadCostModel>
+LDataManager::getWorkloadCostModel() const
+{
+    return d_workload_cost_model;
+} // getWorkloadCostModel
+
+void
+LDataManager::setWriteRedistributableRestartData(const bool write_redistributable_restart_data)
+{
+    d_write_redistributable_restart_data = write_redistributable_restart_data;
+    return;
+} // setWriteRedistributableRestartData
+
 void
 LDataManager::updateNodeCountData(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2390,6 +2435,10 @@ LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM>
     setPatchHierarchy(hierarchy);
     setPatchLevels(0, finest_hier_level);
 
+    // Restore the Lagrangian data if the restart data were written by a
+    // different number of MPI processes.
+    if (d_redistribute_restart_data) restoreRedistributedRestartData();
+
     // Reset the Silo data writer.
     if (d_silo_writer)
     {
@@ -2545,6 +2594,8 @@ LDataManager::putToDatabase(Pointer<Database> db)
     db->putInteger("d_coarsest_ln", d_coarsest_ln);
     db->putInteger("d_finest_ln", d_finest_ln);
     db->putDouble("d_beta_work", d_beta_work);
+    db->putInteger("mpi_nodes", SAMRAI_MPI::getNodes());
+    db->putBool("d_write_redistributable_restart_data", d_write_redistributable_restart_data);
 
     // Write out data that is stored on a level-by-level basis.
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
@@ -2594,7 +2645,39 @@ LDataManager::putToDatabase(Pointer<Database> db)
              ++it)
         {
             ldata_names.push_back(it->first);
-            it->second->putToDatabase(level_db->putDatabase(ldata_names.back()));
+            Pointer<Database> ldata_db = level_db->putDatabase(ldata_names.back());
+            it->second->putToDatabase(ldata_db);
+
+            // Optionally also store the data in the Lagrangian ordering on the
+            // root MPI process.  Unlike the data stored by
+            // LData::putToDatabase(), these values do not depend on the
+            // parallel distribution of the nodes, which allows the data to be
+            // restored on a different number of MPI processes.
+            if (!d_write_redistributable_restart_data) continue;
+            int ierr;
+            Vec petsc_vec = it->second->getVec();
+            Vec lag_vec = NULL;
+            Vec lag_vec_seq = NULL;
+            ierr = VecDuplicate(petsc_vec, &lag_vec);
+            IBTK_CHKERRQ(ierr);
+            scatterPETScToLagrangian(petsc_vec, lag_vec, level_number);
+            scatterToZero(lag_vec, lag_vec_seq);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                int lag_vec_size;
+                ierr = VecGetSize(lag_vec_seq, &lag_vec_size);
+                IBTK_CHKERRQ(ierr);
+                double* lag_vec_arr;
+                ierr = VecGetArray(lag_vec_seq, &lag_vec_arr);
+                IBTK_CHKERRQ(ierr);
+                ldata_db->putDoubleArray("lagrangian_ordered_vals", lag_vec_arr, lag_vec_size);
+                ierr = VecRestoreArray(lag_vec_seq, &lag_vec_arr);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = VecDestroy(&lag_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&lag_vec_seq);
+            IBTK_CHKERRQ(ierr);
         }
         level_db->putInteger("n_ldata_names", static_cast<int>(ldata_names.size()));
         if (!ldata_names.empty())
@@ -2693,7 +2776,11 @@ LDataManager::LDataManager(const std::string& object_name,
       d_local_lag_indices(),
       d_nonlocal_lag_indices(),
       d_local_petsc_indices(),
-      d_nonlocal_petsc_indices()
+      d_nonlocal_petsc_indices(),
+      d_write_redistributable_restart_data(false),
+      d_redistribute_restart_data(false),
+      d_restart_ldata_depths(),
+      d_restart_ldata_vals()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -2924,6 +3011,73 @@ LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_
     return;
 } // endNonlocalDataFill
 
+void
+LDataManager::restoreRedistributedRestartData()
+{
+    int ierr;
+    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+
+        // Determine the distribution of the nodes from the restored patch data.
+        computeNodeDistribution(d_ao[level_number],
+                                d_local_lag_indices[level_number],
+                                d_nonlocal_lag_indices[level_number],
+                                d_local_petsc_indices[level_number],
+                                d_nonlocal_petsc_indices[level_number],
+                                d_num_nodes[level_number],
+                                d_node_offset[level_number],
+                                level_number);
+
+        // Rebuild the Lagrangian data from the values stored in the Lagrangian
+        // ordering on the root MPI process.
+        for (std::map<std::string, int>::const_iterator cit = d_restart_ldata_depths[level_number].begin();
+             cit != d_restart_ldata_depths[level_number].end();
+             ++cit)
+        {
+            const std::string& ldata_name = cit->first;
+            const int depth = cit->second;
+            Pointer<LData> ldata = new LData(
+                ldata_name, getNumberOfLocalNodes(level_number), depth, d_nonlocal_petsc_indices[level_number]);
+            Vec petsc_vec = ldata->getVec();
+            Vec lag_vec = NULL;
+            ierr = VecDuplicate(petsc_vec, &lag_vec);
+            IBTK_CHKERRQ(ierr);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                const std::vector<double>& vals = d_restart_ldata_vals[level_number][ldata_name];
+                if (static_cast<int>(vals.size()) != depth * static_cast<int>(d_num_nodes[level_number]))
+                {
+                    TBOX_ERROR(d_object_name << "::restoreRedistributedRestartData():\n"
+                                             << "  inconsistent restart data for " << ldata_name << std::endl);
+                }
+                std::vector<int> idxs(vals.size());
+                for (unsigned int k = 0; k < idxs.size(); ++k) idxs[k] = k;
+                ierr = VecSetValues(lag_vec,
+                                    static_cast<int>(idxs.size()),
+                                    idxs.empty() ? NULL : &idxs[0],
+                                    vals.empty() ? NULL : &vals[0],
+                                    INSERT_VALUES);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = VecAssemblyBegin(lag_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAssemblyEnd(lag_vec);
+            IBTK_CHKERRQ(ierr);
+            scatterLagrangianToPETSc(lag_vec, petsc_vec, level_number);
+            ierr = VecDestroy(&lag_vec);
+            IBTK_CHKERRQ(ierr);
+            ldata->beginGhostUpdate();
+            ldata->endGhostUpdate();
+            d_lag_mesh_data[level_number][ldata_name] = ldata;
+        }
+    }
+    d_redistribute_restart_data = false;
+    d_restart_ldata_depths.clear();
+    d_restart_ldata_vals.clear();
+    return;
+} // restoreRedistributedRestartData
+
 void
 LDataManager::computeNodeDistribution(AO& ao,
                                       std::vector<int>& local_lag_indices,
@@ -3167,6 +3321,35 @@ LDataManager::getFromRestart()
     d_finest_ln = db->getInteger("d_finest_ln");
     d_beta_work = db->getDouble("d_beta_work");
 
+    // When the number of MPI processes has changed since the restart data were
+    // written, e.g. because the restart files were redistributed with SAMRAI's
+    // restart-redistribute utility, the process-specific data stored in the
+    // restart database cannot be used.  Instead, the node distribution is
+    // recomputed from the restored patch data, and the Lagrangian data are
+    // restored from the values stored in the Lagrangian ordering, in
+    // resetHierarchyConfiguration().
+    const int restart_mpi_nodes = db->keyExists("mpi_nodes") ? db->getInteger("mpi_nodes") : SAMRAI_MPI::getNodes();
+    d_redistribute_restart_data = restart_mpi_nodes != SAMRAI_MPI::getNodes();
+    if (d_redistribute_restart_data)
+    {
+        const bool restart_data_are_redistributable = db->keyExists("d_write_redistributable_restart_data") &&
+                                                      db->getBool("d_write_redistributable_restart_data");
+        if (!restart_data_are_redistributable)
+        {
+            TBOX_ERROR(d_object_name << "::getFromRestart():\n"
+                                     << "  restart data were written by " << restart_mpi_nodes
+                                     << " MPI processes and cannot be restored on " << SAMRAI_MPI::getNodes()
+                                     << " MPI processes.\n"
+                                     << "  restart data must be written with write_redistributable_restart_data = TRUE"
+                                     << std::endl);
+        }
+        plog << d_object_name << "::getFromRestart(): restart data were written by " << restart_mpi_nodes
+             << " MPI processes; redistributing Lagrangian data over " << SAMRAI_MPI::getNodes()
+             << " MPI processes\n";
+    }
+    d_restart_ldata_depths.resize(d_finest_ln + 1);
+    d_restart_ldata_vals.resize(d_finest_ln + 1);
+
     // Resize some arrays.
     d_level_contains_lag_data.resize(d_finest_ln + 1, false);
     d_strct_name_to_strct_id_map.resize(d_finest_ln + 1);
@@ -3252,6 +3435,38 @@ LDataManager::getFromRestart()
             level_db->getStringArray("ldata_names", &ldata_names[0], n_ldata_names);
         }
 
+        if (d_redistribute_restart_data)
+        {
+            for (std::vector<std::string>::iterator it = ldata_names.begin(); it != ldata_names.end(); ++it)
+            {
+                const std::string& ldata_name = *it;
+                Pointer<Database> ldata_db = level_db->getDatabase(ldata_name);
+                d_restart_ldata_depths[level_number][ldata_name] = ldata_db->getInteger("d_depth");
+
+                // The values in the Lagrangian ordering are written only by the
+                // root MPI process, and they are read only by the root MPI
+                // process.  They are scattered to the other processes in
+                // restoreRedistributedRestartData().
+                if (SAMRAI_MPI::getRank() == 0)
+                {
+                    if (!ldata_db->keyExists("lagrangian_ordered_vals"))
+                    {
+                        TBOX_ERROR(d_object_name << "::getFromRestart():\n"
+                                                 << "  restart data for " << ldata_name
+                                                 << " cannot be restored on a different number of MPI processes"
+                                                 << std::endl);
+                    }
+                    std::vector<double>& vals = d_restart_ldata_vals[level_number][ldata_name];
+                    vals.resize(ldata_db->getArraySize("lagrangian_ordered_vals"));
+                    if (!vals.empty())
+                    {
+                        ldata_db->getDoubleArray("lagrangian_ordered_vals", &vals[0], static_cast<int>(vals.size()));
+                    }
+                }
+            }
+            continue;
+        }
+
         std::set<int> data_depths;
         for (std::vector<std::string>::iterator it = ldata_names.begin(); it != ldata_names.end(); ++it)
         {
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <pthread.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -41,6 +42,7 @@
 #include <map>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -89,10 +91,33 @@ static const std::string SILO_SUMMARY_FILE_PREFIX = "lag_data.cycle_";
 static const std::string SILO_SUMMARY_FILE_POSTFIX = ".summary.silo";
 static const std::string SILO_PROCESSOR_FILE_PREFIX = "lag_data.proc_";
 static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
+static const std::string SILO_PROCESSOR_DIR_PREFIX = "proc_";
 
 // Version of LSiloDataWriter restart file data.
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
 
+// Errors encountered while writing the Silo files are reported by throwing a
+// SiloWriteError rather than by calling TBOX_ERROR directly.  The files may be
+// written by a helper thread, which must not abort the program, and so errors
+// are caught and raised on the main thread.
+class SiloWriteError : public std::runtime_error
+{
+public:
+    explicit SiloWriteError(const std::string& message) : std::runtime_error(message)
+    {
+        // intentionally blank
+        return;
+    }
+};
+
+#define SILO_ERROR(X)                                                                                                  \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        std::ostringstream silo_error_stream;                                                                          \
+        silo_error_stream << X;                                                                                        \
+        throw SiloWriteError(silo_error_stream.str());                                                                 \
+    } while (0)
+
 #if defined(IBTK_HAVE_SILO)
 /*!
  * \brief Build a local mesh database entry corresponding to a cloud of marker
@@ -144,7 +169,7 @@ build_local_marker_cloud(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
+        SILO_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
                    << "  Could not set directory "
                    << dirname
                    << std::endl);
@@ -198,7 +223,7 @@ build_local_marker_cloud(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
+        SILO_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
                    << "  Could not return to the base directory from subdirectory "
                    << dirname
                    << std::endl);
@@ -310,7 +335,7 @@ build_local_curv_block(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_curv_block()\n"
+        SILO_ERROR("LSiloDataWriter::build_local_curv_block()\n"
                    << "  Could not set directory "
                    << dirname
                    << std::endl);
@@ -403,7 +428,7 @@ build_local_curv_block(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_curv_block()\n"
+        SILO_ERROR("LSiloDataWriter::build_local_curv_block()\n"
                    << "  Could not return to the base directory from subdirectory "
                    << dirname
                    << std::endl);
@@ -498,7 +523,7 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
+        SILO_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
                    << "  Could not set directory "
                    << dirname
                    << std::endl);
@@ -627,16 +652,95 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
+        SILO_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
                    << "  Could not return to the base directory from subdirectory "
                    << dirname
                    << std::endl);
     }
     return;
 } // build_local_ucd_mesh
+
+/*!
+ * \brief Get the name of the Silo file to which the data of the specified MPI
+ * process are written.
+ */
+inline std::string
+get_processor_file_name(const int proc, const int nprocs_per_file)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    sprintf(temp_buf, "%04d", proc / nprocs_per_file);
+    return SILO_PROCESSOR_FILE_PREFIX + temp_buf + SILO_PROCESSOR_FILE_POSTFIX;
+} // get_processor_file_name
+
+/*!
+ * \brief Get the name of the directory within the Silo file to which the data
+ * of the specified MPI process are written.
+ *
+ * \note When each process writes to its own file, the data are written to the
+ * root directory of the file, and the directory name is empty.
+ */
+inline std::string
+get_processor_dir_name(const int proc, const int nprocs_per_file)
+{
+    if (nprocs_per_file == 1) return std::string();
+    char temp_buf[SILO_NAME_BUFSIZE];
+    sprintf(temp_buf, "%04d", proc);
+    return SILO_PROCESSOR_DIR_PREFIX + temp_buf;
+} // get_processor_dir_name
+
+/*!
+ * \brief Append a null-terminated string to a character buffer.
+ */
+inline void
+pack_name(std::vector<char>& buf, const std::string& name)
+{
+    buf.insert(buf.end(), name.begin(), name.end());
+    buf.push_back('\0');
+    return;
+} // pack_name
+
+/*!
+ * \brief Extract a null-terminated string from a character buffer, starting at
+ * the specified position, and advance the position past the string.
+ */
+inline std::string
+unpack_name(const std::vector<char>& buf, int& pos)
+{
+    const std::string name(&buf[pos]);
+    pos += static_cast<int>(name.size()) + 1;
+    return name;
+} // unpack_name
 #endif // if defined(IBTK_HAVE_SILO)
 }
 
+// Buffered plot data, together with the information required to write it to
+// disk independently of the state of the MPI communicator.
+struct LSiloDataWriter::PlotData
+{
+    int time_step_number;
+    double simulation_time;
+    int mpi_nodes;
+    std::string current_dump_directory_name, dump_dirname, file_name, proc_dir_name;
+    bool create_file, write_summary;
+
+    // Local coordinate and variable data, indexed by level number.
+    std::vector<std::vector<double> > X_data;
+    std::vector<std::vector<std::vector<double> > > var_data;
+
+    // Data from all MPI processes required to write the summary file; only set
+    // on the root MPI process.
+    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
+    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
+    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
+        ucd_mesh_names_per_proc;
+
+    // The thread writing the data when output is asynchronous, and the
+    // description of any error encountered by that thread.
+    pthread_t thread;
+    std::string error_message;
+};
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
@@ -645,6 +749,10 @@ LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
     : d_object_name(object_name),
       d_registered_for_restart(register_for_restart),
       d_dump_directory_name(dump_directory_name),
+      d_nprocs_per_file(1),
+      d_async_output(false),
+      d_async_output_max_bytes(0),
+      d_pending_plot_data(NULL),
       d_time_step_number(-1),
       d_hierarchy(),
       d_coarsest_ln(0),
@@ -702,6 +810,8 @@ LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
 
 LSiloDataWriter::~LSiloDataWriter()
 {
+    waitForPendingOutput();
+
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
@@ -733,6 +843,25 @@ LSiloDataWriter::~LSiloDataWriter()
     return;
 } // ~LSiloDataWriter
 
+void
+LSiloDataWriter::setNumberOfProcessorsPerFile(const int nprocs_per_file)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(nprocs_per_file >= 1);
+#endif
+    d_nprocs_per_file = nprocs_per_file;
+    return;
+} // setNumberOfProcessorsPerFile
+
+void
+LSiloDataWriter::setAsynchronousOutput(const bool async_output, const size_t max_buffer_bytes)
+{
+    waitForPendingOutput();
+    d_async_output = async_output;
+    d_async_output_max_bytes = max_buffer_bytes;
+    return;
+} // setAsynchronousOutput
+
 void
 LSiloDataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
@@ -748,6 +877,7 @@ LSiloDataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 void
 LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
 {
+    waitForPendingOutput();
 #if !defined(NDEBUG)
     TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln));
     if (d_hierarchy)
@@ -851,6 +981,7 @@ LSiloDataWriter::registerMarkerCloud(const std::string& name,
                                      const int first_lag_idx,
                                      const int level_number)
 {
+    waitForPendingOutput();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -917,6 +1048,7 @@ LSiloDataWriter::registerLogicallyCartesianBlock(const std::string& name,
                                                  const int first_lag_idx,
                                                  const int level_number)
 {
+    waitForPendingOutput();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -989,6 +1121,7 @@ LSiloDataWriter::registerLogicallyCartesianMultiblock(const std::string& name,
                                                       const std::vector<int>& first_lag_idx,
                                                       const int level_number)
 {
+    waitForPendingOutput();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1068,6 +1201,7 @@ LSiloDataWriter::registerUnstructuredMesh(const std::string& name,
                                           const std::multimap<int, std::pair<int, int> >& edge_map,
                                           const int level_number)
 {
+    waitForPendingOutput();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1139,6 +1273,7 @@ LSiloDataWriter::registerUnstructuredMesh(const std::string& name,
 void
 LSiloDataWriter::registerCoordsData(Pointer<LData> coords_data, const int level_number)
 {
+    waitForPendingOutput();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1168,6 +1303,7 @@ LSiloDataWriter::registerVariableData(const std::string& var_name,
                                       const int var_depth,
                                       const int level_number)
 {
+    waitForPendingOutput();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1260,6 +1396,9 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     }
     d_time_step_number = time_step_number;
 
+    // Complete any pending asynchronous write before setting up the next one.
+    waitForPendingOutput();
+
     if (d_dump_directory_name.empty())
     {
         TBOX_ERROR(d_object_name << "::writePlotData()\n"
@@ -1272,8 +1411,6 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     int ierr;
     char temp_buf[SILO_NAME_BUFSIZE];
-    std::string current_file_name;
-    DBfile* dbfile;
     const int mpi_rank = SAMRAI_MPI::getRank();
     const int mpi_nodes = SAMRAI_MPI::getNodes();
 
@@ -1288,35 +1425,29 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     }
 
     // Create the working directory.
+    PlotData* plot_data = new PlotData();
+    plot_data->time_step_number = time_step_number;
+    plot_data->simulation_time = simulation_time;
+    plot_data->mpi_nodes = mpi_nodes;
     sprintf(temp_buf, "%06d", d_time_step_number);
-    std::string current_dump_directory_name = SILO_DUMP_DIR_PREFIX + temp_buf;
-    std::string dump_dirname = d_dump_directory_name + "/" + current_dump_directory_name;
-
-    Utilities::recursiveMkdir(dump_dirname);
+    plot_data->current_dump_directory_name = SILO_DUMP_DIR_PREFIX + temp_buf;
+    plot_data->dump_dirname = d_dump_directory_name + "/" + plot_data->current_dump_directory_name;
+    plot_data->file_name = plot_data->dump_dirname + "/" + get_processor_file_name(mpi_rank, d_nprocs_per_file);
+    plot_data->proc_dir_name = get_processor_dir_name(mpi_rank, d_nprocs_per_file);
+    plot_data->create_file = mpi_rank % d_nprocs_per_file == 0;
+    plot_data->write_summary = mpi_rank == SILO_MPI_ROOT;
 
-    // Create one local DBfile per MPI process.
-    sprintf(temp_buf, "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
-    {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named "
-                                 << current_file_name
-                                 << std::endl);
-    }
+    Utilities::recursiveMkdir(plot_data->dump_dirname);
 
-    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
-    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
+    plot_data->X_data.resize(d_finest_ln + 1);
+    plot_data->var_data.resize(d_finest_ln + 1);
 
-    // Set the local data.
+    // Scatter the local data from "global" to "local" form and copy it into
+    // the output buffers.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         if (d_coords_data[ln])
         {
-            // Scatter the data from "global" to "local" form.
             Vec local_X_vec;
             ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
             IBTK_CHKERRQ(ierr);
@@ -1331,8 +1462,16 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
             ierr = VecGetArray(local_X_vec, &local_X_arr);
             IBTK_CHKERRQ(ierr);
 
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
+            int local_X_size;
+            ierr = VecGetLocalSize(local_X_vec, &local_X_size);
+            IBTK_CHKERRQ(ierr);
+            plot_data->X_data[ln].assign(local_X_arr, local_X_arr + local_X_size);
+            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&local_X_vec);
+            IBTK_CHKERRQ(ierr);
+
+            plot_data->var_data[ln].resize(d_nvars[ln]);
 
             for (int v = 0; v < d_nvars[ln]; ++v)
             {
@@ -1353,767 +1492,287 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 ierr = VecGetArray(local_v_vec, &local_v_arr);
                 IBTK_CHKERRQ(ierr);
 
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
+                int local_v_size;
+                ierr = VecGetLocalSize(local_v_vec, &local_v_size);
+                IBTK_CHKERRQ(ierr);
+                plot_data->var_data[ln][v].assign(local_v_arr, local_v_arr + local_v_size);
+                ierr = VecRestoreArray(local_v_vec, &local_v_arr);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecDestroy(&local_v_vec);
+                IBTK_CHKERRQ(ierr);
             }
+        }
+    }
 
-            // Keep track of the current offset in the local Vec data.
-            int offset = 0;
+    // Collect the data required to create the multimesh and multivar objects
+    // on the root MPI process.  The local data are packed into integer and
+    // character buffers that are gathered on the root process using collective
+    // operations.
+    std::vector<int> local_int_data;
+    std::vector<char> local_char_data;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        local_int_data.push_back(d_nclouds[ln]);
+        for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+        {
+            pack_name(local_char_data, d_cloud_names[ln][cloud]);
+        }
 
-            // Add the local clouds to the local DBfile.
-            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-            {
-                const int nmarks = d_cloud_nmarks[ln][cloud];
+        local_int_data.push_back(d_nblocks[ln]);
+        for (int block = 0; block < d_nblocks[ln]; ++block)
+        {
+            local_int_data.push_back(DB_QUAD_CURV);
+            local_int_data.push_back(DB_QUADVAR);
+            pack_name(local_char_data, d_block_names[ln][block]);
+        }
 
-                std::ostringstream stream;
-                stream << "level_" << ln << "_cloud_" << cloud;
-                std::string dirname = stream.str();
+        local_int_data.push_back(d_nmbs[ln]);
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+        {
+            local_int_data.push_back(d_mb_nblocks[ln][mb]);
+            for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
+            {
+                local_int_data.push_back(DB_QUAD_CURV);
+                local_int_data.push_back(DB_QUADVAR);
+            }
+            pack_name(local_char_data, d_mb_names[ln][mb]);
+        }
 
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
-                }
+        local_int_data.push_back(d_nucd_meshes[ln]);
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            pack_name(local_char_data, d_ucd_mesh_names[ln][mesh]);
+        }
+    }
 
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
+    int local_data_sizes[2] = { static_cast<int>(local_int_data.size()), static_cast<int>(local_char_data.size()) };
+    std::vector<int> data_sizes(mpi_rank == SILO_MPI_ROOT ? 2 * mpi_nodes : 2);
+    MPI_Gather(local_data_sizes, 2, MPI_INT, &data_sizes[0], 2, MPI_INT, SILO_MPI_ROOT, SAMRAI_MPI::commWorld);
 
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
-
-                offset += nmarks;
-            }
+    std::vector<int> int_data_sizes(mpi_nodes, 0), int_data_offsets(mpi_nodes + 1, 0);
+    std::vector<int> char_data_sizes(mpi_nodes, 0), char_data_offsets(mpi_nodes + 1, 0);
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            int_data_sizes[proc] = data_sizes[2 * proc];
+            int_data_offsets[proc + 1] = int_data_offsets[proc] + int_data_sizes[proc];
+            char_data_sizes[proc] = data_sizes[2 * proc + 1];
+            char_data_offsets[proc + 1] = char_data_offsets[proc] + char_data_sizes[proc];
+        }
+    }
+    std::vector<int> int_data(std::max(int_data_offsets[mpi_nodes], 1));
+    std::vector<char> char_data(std::max(char_data_offsets[mpi_nodes], 1));
+    MPI_Gatherv(local_int_data.empty() ? NULL : &local_int_data[0],
+                local_data_sizes[0],
+                MPI_INT,
+                &int_data[0],
+                &int_data_sizes[0],
+                &int_data_offsets[0],
+                MPI_INT,
+                SILO_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    MPI_Gatherv(local_char_data.empty() ? NULL : &local_char_data[0],
+                local_data_sizes[1],
+                MPI_CHAR,
+                &char_data[0],
+                &char_data_sizes[0],
+                &char_data_offsets[0],
+                MPI_CHAR,
+                SILO_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+
+    // Unpack the gathered data on the root MPI process.
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        plot_data->nclouds_per_proc.resize(d_finest_ln + 1);
+        plot_data->nblocks_per_proc.resize(d_finest_ln + 1);
+        plot_data->nmbs_per_proc.resize(d_finest_ln + 1);
+        plot_data->nucd_meshes_per_proc.resize(d_finest_ln + 1);
+        plot_data->meshtypes_per_proc.resize(d_finest_ln + 1);
+        plot_data->vartypes_per_proc.resize(d_finest_ln + 1);
+        plot_data->mb_nblocks_per_proc.resize(d_finest_ln + 1);
+        plot_data->multimeshtypes_per_proc.resize(d_finest_ln + 1);
+        plot_data->multivartypes_per_proc.resize(d_finest_ln + 1);
+        plot_data->cloud_names_per_proc.resize(d_finest_ln + 1);
+        plot_data->block_names_per_proc.resize(d_finest_ln + 1);
+        plot_data->mb_names_per_proc.resize(d_finest_ln + 1);
+        plot_data->ucd_mesh_names_per_proc.resize(d_finest_ln + 1);
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            plot_data->nclouds_per_proc[ln].resize(mpi_nodes);
+            plot_data->nblocks_per_proc[ln].resize(mpi_nodes);
+            plot_data->nmbs_per_proc[ln].resize(mpi_nodes);
+            plot_data->nucd_meshes_per_proc[ln].resize(mpi_nodes);
+            plot_data->meshtypes_per_proc[ln].resize(mpi_nodes);
+            plot_data->vartypes_per_proc[ln].resize(mpi_nodes);
+            plot_data->mb_nblocks_per_proc[ln].resize(mpi_nodes);
+            plot_data->multimeshtypes_per_proc[ln].resize(mpi_nodes);
+            plot_data->multivartypes_per_proc[ln].resize(mpi_nodes);
+            plot_data->cloud_names_per_proc[ln].resize(mpi_nodes);
+            plot_data->block_names_per_proc[ln].resize(mpi_nodes);
+            plot_data->mb_names_per_proc[ln].resize(mpi_nodes);
+            plot_data->ucd_mesh_names_per_proc[ln].resize(mpi_nodes);
+        }
 
-            // Add the local blocks to the local DBfile.
-            for (int block = 0; block < d_nblocks[ln]; ++block)
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            int i = int_data_offsets[proc];
+            int c = char_data_offsets[proc];
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
-                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
-                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
-                const int ntot = nelem.getProduct();
-
-                std::ostringstream stream;
-                stream << "level_" << ln << "_block_" << block;
-                std::string dirname = stream.str();
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                plot_data->nclouds_per_proc[ln][proc] = int_data[i++];
+                plot_data->cloud_names_per_proc[ln][proc].resize(plot_data->nclouds_per_proc[ln][proc]);
+                for (int cloud = 0; cloud < plot_data->nclouds_per_proc[ln][proc]; ++cloud)
                 {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
+                    plot_data->cloud_names_per_proc[ln][proc][cloud] = unpack_name(char_data, c);
                 }
 
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+                plot_data->nblocks_per_proc[ln][proc] = int_data[i++];
+                plot_data->meshtypes_per_proc[ln][proc].resize(plot_data->nblocks_per_proc[ln][proc]);
+                plot_data->vartypes_per_proc[ln][proc].resize(plot_data->nblocks_per_proc[ln][proc]);
+                plot_data->block_names_per_proc[ln][proc].resize(plot_data->nblocks_per_proc[ln][proc]);
+                for (int block = 0; block < plot_data->nblocks_per_proc[ln][proc]; ++block)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    plot_data->meshtypes_per_proc[ln][proc][block] = int_data[i++];
+                    plot_data->vartypes_per_proc[ln][proc][block] = int_data[i++];
+                    plot_data->block_names_per_proc[ln][proc][block] = unpack_name(char_data, c);
                 }
 
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
-                meshtype[ln].push_back(DB_QUAD_CURV);
-                vartype[ln].push_back(DB_QUADVAR);
-
-                offset += ntot;
-            }
-
-            // Add the local multiblocks to the local DBfile.
-            multimeshtype[ln].resize(d_nmbs[ln]);
-            multivartype[ln].resize(d_nmbs[ln]);
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-            {
-                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
+                plot_data->nmbs_per_proc[ln][proc] = int_data[i++];
+                plot_data->mb_nblocks_per_proc[ln][proc].resize(plot_data->nmbs_per_proc[ln][proc]);
+                plot_data->multimeshtypes_per_proc[ln][proc].resize(plot_data->nmbs_per_proc[ln][proc]);
+                plot_data->multivartypes_per_proc[ln][proc].resize(plot_data->nmbs_per_proc[ln][proc]);
+                plot_data->mb_names_per_proc[ln][proc].resize(plot_data->nmbs_per_proc[ln][proc]);
+                for (int mb = 0; mb < plot_data->nmbs_per_proc[ln][proc]; ++mb)
                 {
-                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
-                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
-                    const int ntot = nelem.getProduct();
-
-                    std::ostringstream stream;
-                    stream << "level_" << ln << "_mb_" << mb << "_block_" << block;
-                    std::string dirname = stream.str();
-
-                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << dirname
-                                                 << std::endl);
-                    }
-
-                    const double* const X = local_X_arr + NDIM * offset;
-                    std::vector<const double*> var_vals(d_nvars[ln]);
-                    for (int v = 0; v < d_nvars[ln]; ++v)
+                    plot_data->mb_nblocks_per_proc[ln][proc][mb] = int_data[i++];
+                    plot_data->multimeshtypes_per_proc[ln][proc][mb].resize(plot_data->mb_nblocks_per_proc[ln][proc][mb]);
+                    plot_data->multivartypes_per_proc[ln][proc][mb].resize(plot_data->mb_nblocks_per_proc[ln][proc][mb]);
+                    for (int block = 0; block < plot_data->mb_nblocks_per_proc[ln][proc][mb]; ++block)
                     {
-                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                        plot_data->multimeshtypes_per_proc[ln][proc][mb][block] = int_data[i++];
+                        plot_data->multivartypes_per_proc[ln][proc][mb][block] = int_data[i++];
                     }
-
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
-                    multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
-                    multivartype[ln][mb].push_back(DB_QUADVAR);
-
-                    offset += ntot;
-                }
-            }
-
-            // Add the local UCD meshes to the local DBfile.
-            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-            {
-                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
-                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
-                const size_t ntot = vertices.size();
-
-                std::ostringstream stream;
-                stream << "level_" << ln << "_mesh_" << mesh;
-                std::string dirname = stream.str();
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
+                    plot_data->mb_names_per_proc[ln][proc][mb] = unpack_name(char_data, c);
                 }
 
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+                plot_data->nucd_meshes_per_proc[ln][proc] = int_data[i++];
+                plot_data->ucd_mesh_names_per_proc[ln][proc].resize(plot_data->nucd_meshes_per_proc[ln][proc]);
+                for (int mesh = 0; mesh < plot_data->nucd_meshes_per_proc[ln][proc]; ++mesh)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    plot_data->ucd_mesh_names_per_proc[ln][proc][mesh] = unpack_name(char_data, c);
                 }
-
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
-
-                offset += ntot;
-            }
-
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
-            IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
             }
+#if !defined(NDEBUG)
+            TBOX_ASSERT(i == int_data_offsets[proc + 1]);
+            TBOX_ASSERT(c == char_data_offsets[proc + 1]);
+#endif
         }
     }
 
-    DBClose(dbfile);
-
-    // Send data to the root MPI process required to create the multimesh and
-    // multivar objects.
-    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
-    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
-    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
-    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
-        ucd_mesh_names_per_proc;
-
-    if (mpi_rank == SILO_MPI_ROOT)
+    // Write the data to disk.  When asynchronous output is enabled and the
+    // buffered data fit within the memory budget on every process, the files
+    // are written by a helper thread and control returns to the caller
+    // immediately.  Otherwise, the files are written before returning.
+    // Because processes that share a DBfile must take turns writing to it,
+    // shared files are always written synchronously.
+    //
+    // NOTE: The choice between asynchronous and synchronous output must be the
+    // same on all processes because only synchronous output ends with a
+    // barrier.
+    size_t plot_data_bytes = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        nclouds_per_proc.resize(d_finest_ln + 1);
-        nblocks_per_proc.resize(d_finest_ln + 1);
-        nmbs_per_proc.resize(d_finest_ln + 1);
-        nucd_meshes_per_proc.resize(d_finest_ln + 1);
-        meshtypes_per_proc.resize(d_finest_ln + 1);
-        vartypes_per_proc.resize(d_finest_ln + 1);
-        mb_nblocks_per_proc.resize(d_finest_ln + 1);
-        multimeshtypes_per_proc.resize(d_finest_ln + 1);
-        multivartypes_per_proc.resize(d_finest_ln + 1);
-        cloud_names_per_proc.resize(d_finest_ln + 1);
-        block_names_per_proc.resize(d_finest_ln + 1);
-        mb_names_per_proc.resize(d_finest_ln + 1);
-        ucd_mesh_names_per_proc.resize(d_finest_ln + 1);
+        plot_data_bytes += plot_data->X_data[ln].size() * sizeof(double);
+        for (unsigned int v = 0; v < plot_data->var_data[ln].size(); ++v)
+        {
+            plot_data_bytes += plot_data->var_data[ln][v].size() * sizeof(double);
+        }
     }
-
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    const bool use_async_output =
+        d_async_output && d_nprocs_per_file == 1 &&
+        SAMRAI_MPI::minReduction(plot_data_bytes <= d_async_output_max_bytes ? 1 : 0) == 1;
+    if (use_async_output)
+    {
+        d_pending_plot_data = plot_data;
+        if (pthread_create(&d_pending_plot_data->thread, NULL, &LSiloDataWriter::writePlotDataAsync, this) != 0)
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create output thread"
+                                     << std::endl);
+        }
+    }
+    else
     {
-        if (mpi_rank == SILO_MPI_ROOT)
-        {
-            nclouds_per_proc[ln].resize(mpi_nodes);
-            nblocks_per_proc[ln].resize(mpi_nodes);
-            nmbs_per_proc[ln].resize(mpi_nodes);
-            nucd_meshes_per_proc[ln].resize(mpi_nodes);
-            meshtypes_per_proc[ln].resize(mpi_nodes);
-            vartypes_per_proc[ln].resize(mpi_nodes);
-            mb_nblocks_per_proc[ln].resize(mpi_nodes);
-            multimeshtypes_per_proc[ln].resize(mpi_nodes);
-            multivartypes_per_proc[ln].resize(mpi_nodes);
-            cloud_names_per_proc[ln].resize(mpi_nodes);
-            block_names_per_proc[ln].resize(mpi_nodes);
-            mb_names_per_proc[ln].resize(mpi_nodes);
-            ucd_mesh_names_per_proc[ln].resize(mpi_nodes);
-        }
-
-        // Set the values for the root process.
-        if (mpi_rank == SILO_MPI_ROOT)
-        {
-            nclouds_per_proc[ln][mpi_rank] = d_nclouds[ln];
-            nblocks_per_proc[ln][mpi_rank] = d_nblocks[ln];
-            nmbs_per_proc[ln][mpi_rank] = d_nmbs[ln];
-            nucd_meshes_per_proc[ln][mpi_rank] = d_nucd_meshes[ln];
-            meshtypes_per_proc[ln][mpi_rank] = meshtype[ln];
-            vartypes_per_proc[ln][mpi_rank] = vartype[ln];
-            mb_nblocks_per_proc[ln][mpi_rank] = d_mb_nblocks[ln];
-            multimeshtypes_per_proc[ln][mpi_rank] = multimeshtype[ln];
-            multivartypes_per_proc[ln][mpi_rank] = multivartype[ln];
-            cloud_names_per_proc[ln][mpi_rank] = d_cloud_names[ln];
-            block_names_per_proc[ln][mpi_rank] = d_block_names[ln];
-            mb_names_per_proc[ln][mpi_rank] = d_mb_names[ln];
-            ucd_mesh_names_per_proc[ln][mpi_rank] = d_ucd_mesh_names[ln];
-        }
-
-        // Get the values for the non-root processes.
         int one = 1;
-        for (int proc = 0; proc < mpi_nodes; ++proc)
+        const bool first_proc_in_file = mpi_rank % d_nprocs_per_file == 0;
+        const bool last_proc_in_file =
+            (mpi_rank % d_nprocs_per_file == d_nprocs_per_file - 1) || (mpi_rank == mpi_nodes - 1);
+        if (!first_proc_in_file)
         {
-            // Skip the root process; we already have those values.
-            if (proc == SILO_MPI_ROOT)
-            {
-                proc += 1;
-                if (proc >= mpi_nodes) break;
-            }
+            int baton;
+            SAMRAI_MPI::recv(&baton, one, mpi_rank - 1, false, SILO_MPI_TAG);
+        }
+        try
+        {
+            writeLocalPlotData(*plot_data);
+        }
+        catch (const SiloWriteError& e)
+        {
+            TBOX_ERROR(e.what());
+        }
+        if (!last_proc_in_file)
+        {
+            int baton = 0;
+            SAMRAI_MPI::send(&baton, one, mpi_rank + 1, false, SILO_MPI_TAG);
+        }
+        try
+        {
+            if (plot_data->write_summary) writeSummaryPlotData(*plot_data);
+        }
+        catch (const SiloWriteError& e)
+        {
+            TBOX_ERROR(e.what());
+        }
+        delete plot_data;
+        SAMRAI_MPI::barrier();
+    }
+#else
+    TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
+#endif // if defined(IBTK_HAVE_SILO)
+    return;
+} // writePlotData
 
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nclouds[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nclouds_per_proc[ln][proc], one, proc, false);
-            }
+void
+LSiloDataWriter::waitForPendingOutput()
+{
+    if (d_pending_plot_data)
+    {
+        pthread_join(d_pending_plot_data->thread, NULL);
+        const std::string error_message = d_pending_plot_data->error_message;
+        delete d_pending_plot_data;
+        d_pending_plot_data = NULL;
+        if (!error_message.empty())
+        {
+            TBOX_ERROR(d_object_name << "::waitForPendingOutput()\n"
+                                     << "  asynchronous output failed:\n"
+                                     << error_message);
+        }
+    }
+    return;
+} // waitForPendingOutput
 
-            if (mpi_rank == proc && d_nclouds[ln] > 0)
-            {
-                int num_bytes;
-                for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-                {
-                    num_bytes = static_cast<int>((d_cloud_names[ln][cloud].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_cloud_names[ln][cloud].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nclouds_per_proc[ln][proc] > 0)
-            {
-                cloud_names_per_proc[ln][proc].resize(nclouds_per_proc[ln][proc]);
+void
+LSiloDataWriter::putToDatabase(Pointer<Database> db)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    db->putInteger("LAG_SILO_DATA_WRITER_VERSION", LAG_SILO_DATA_WRITER_VERSION);
 
-                int num_bytes;
-                char* name;
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    cloud_names_per_proc[ln][proc][cloud].assign(name);
-                    delete[] name;
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nblocks[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nblocks_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nblocks[ln] > 0)
-            {
-                SAMRAI_MPI::send(&meshtype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-                SAMRAI_MPI::send(&vartype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int block = 0; block < d_nblocks[ln]; ++block)
-                {
-                    num_bytes = static_cast<int>((d_block_names[ln][block].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_block_names[ln][block].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nblocks_per_proc[ln][proc] > 0)
-            {
-                meshtypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                vartypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                block_names_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-
-                SAMRAI_MPI::recv(&meshtypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-                SAMRAI_MPI::recv(&vartypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                char* name;
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    block_names_per_proc[ln][proc][block].assign(name);
-                    delete[] name;
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nmbs[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nmbs_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nmbs[ln] > 0)
-            {
-                SAMRAI_MPI::send(&d_mb_nblocks[ln][0], d_nmbs[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-                {
-                    SAMRAI_MPI::send(&multimeshtype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::send(&multivartype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-
-                    num_bytes = static_cast<int>(d_mb_names[ln][mb].size()) + 1;
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-
-                    const void* mb_name_ptr = d_mb_names[ln][mb].c_str();
-                    MPI_Send(const_cast<void*>(mb_name_ptr),
-                             num_bytes,
-                             MPI_CHAR,
-                             SILO_MPI_ROOT,
-                             SILO_MPI_TAG,
-                             SAMRAI_MPI::commWorld);
-                    const int tree = SAMRAI_MPI::getTreeDepth();
-                    SAMRAI_MPI::updateOutgoingStatistics(tree, num_bytes * sizeof(char));
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nmbs_per_proc[ln][proc] > 0)
-            {
-                mb_nblocks_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multimeshtypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multivartypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                mb_names_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-
-                SAMRAI_MPI::recv(&mb_nblocks_per_proc[ln][proc][0], nmbs_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                char* name;
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    multimeshtypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-                    multivartypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-
-                    SAMRAI_MPI::recv(
-                        &multimeshtypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-                    SAMRAI_MPI::recv(
-                        &multivartypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes];
-
-                    MPI_Status status;
-                    MPI_Recv(name, num_bytes, MPI_CHAR, proc, SILO_MPI_TAG, SAMRAI_MPI::commWorld, &status);
-                    const int tree = SAMRAI_MPI::getTreeDepth();
-                    SAMRAI_MPI::updateIncomingStatistics(tree, num_bytes * sizeof(char));
-
-                    mb_names_per_proc[ln][proc][mb].assign(name);
-                    delete[] name;
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                SAMRAI_MPI::send(&d_nucd_meshes[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                SAMRAI_MPI::recv(&nucd_meshes_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nucd_meshes[ln] > 0)
-            {
-                int num_bytes;
-                for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-                {
-                    num_bytes = static_cast<int>((d_ucd_mesh_names[ln][mesh].size() + 1) * sizeof(char));
-                    SAMRAI_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    SAMRAI_MPI::sendBytes(
-                        static_cast<const void*>(d_ucd_mesh_names[ln][mesh].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nucd_meshes_per_proc[ln][proc] > 0)
-            {
-                ucd_mesh_names_per_proc[ln][proc].resize(nucd_meshes_per_proc[ln][proc]);
-                int num_bytes;
-                char* name;
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    SAMRAI_MPI::recv(&num_bytes, one, proc, false);
-                    name = new char[num_bytes / sizeof(char)];
-                    SAMRAI_MPI::recvBytes(static_cast<void*>(name), num_bytes);
-                    ucd_mesh_names_per_proc[ln][proc][mesh].assign(name);
-                    delete[] name;
-                }
-            }
-
-            SAMRAI_MPI::barrier();
-        }
-    }
-
-    if (mpi_rank == SILO_MPI_ROOT)
-    {
-        // Create and initialize the multimesh Silo database on the root MPI
-        // process.
-        sprintf(temp_buf, "%06d", d_time_step_number);
-        std::string summary_file_name =
-            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
-        {
-            TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                     << "  Could not create DBfile named "
-                                     << summary_file_name
-                                     << std::endl);
-        }
-
-        int cycle = time_step_number;
-        float time = float(simulation_time);
-        double dtime = simulation_time;
-
-        static const int MAX_OPTS = 3;
-        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
-        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
-        DBAddOption(optlist, DBOPT_TIME, &time);
-        DBAddOption(optlist, DBOPT_DTIME, &dtime);
-
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-            {
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_cloud_" << cloud << "/mesh";
-                    std::string meshname = stream.str();
-                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_POINTMESH;
-
-                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << cloud_name
-                                                 << std::endl);
-                    }
-                }
-
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_block_" << block << "/mesh";
-                    std::string meshname = stream.str();
-                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = meshtypes_per_proc[ln][proc][block];
-
-                    std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << block_name
-                                                 << std::endl);
-                    }
-                }
-
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-                    char** meshnames = new char*[nblocks];
-
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        std::ostringstream stream;
-                        stream << current_file_name << ":level_" << ln << "_mb_" << mb << "_block_" << block << "/mesh";
-                        meshnames[block] = strdup(stream.str().c_str());
-                    }
-
-                    std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                    DBPutMultimesh(dbfile,
-                                   mb_name.c_str(),
-                                   nblocks,
-                                   meshnames,
-                                   &multimeshtypes_per_proc[ln][proc][mb][0],
-                                   optlist);
-
-                    if (DBMkDir(dbfile, mb_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << mb_name
-                                                 << std::endl);
-                    }
-
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        free(meshnames[block]);
-                    }
-                    delete[] meshnames;
-                }
-
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_mesh_" << mesh << "/mesh";
-                    std::string meshname = stream.str();
-                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_UCDMESH;
-
-                    std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                    DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << mesh_name
-                                                 << std::endl);
-                    }
-                }
-
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                    {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_cloud_" << cloud << "/"
-                                       << d_var_names[ln][v];
-                        std::string varname = varname_stream.str();
-                        char* varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_POINTVAR;
-
-                        std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                        std::ostringstream stream;
-                        stream << cloud_name << "/" << d_var_names[ln][v];
-                        std::string var_name = stream.str();
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-
-                    for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                    {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_block_" << block << "/"
-                                       << d_var_names[ln][v];
-                        std::string varname = varname_stream.str();
-                        char* varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = vartypes_per_proc[ln][proc][block];
-
-                        std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                        std::ostringstream stream;
-                        stream << block_name << "/" << d_var_names[ln][v];
-                        std::string var_name = stream.str();
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-
-                    for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                    {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-                        char** varnames = new char*[nblocks];
-
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            std::ostringstream varname_stream;
-                            varname_stream << current_file_name << ":level_" << ln << "_mb_" << mb << "_block_" << block
-                                           << d_var_names[ln][v];
-                            varnames[block] = strdup(varname_stream.str().c_str());
-                        }
-
-                        std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                        std::ostringstream stream;
-                        stream << mb_name << "/" << d_var_names[ln][v];
-                        std::string var_name = stream.str();
-
-                        DBPutMultivar(dbfile,
-                                      var_name.c_str(),
-                                      nblocks,
-                                      varnames,
-                                      &multivartypes_per_proc[ln][proc][mb][0],
-                                      optlist);
-
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            free(varnames[block]);
-                        }
-                        delete[] varnames;
-                    }
-
-                    for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                    {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_mesh_" << mesh << "/"
-                                       << d_var_names[ln][v];
-                        std::string varname = varname_stream.str();
-                        char* varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_UCDVAR;
-
-                        std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                        std::ostringstream stream;
-                        stream << mesh_name << "/" << d_var_names[ln][v];
-                        std::string var_name = stream.str();
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-                }
-            }
-        }
-
-        DBFreeOptlist(optlist);
-        DBClose(dbfile);
-
-        // Create or update the dumps file on the root MPI process.
-        static bool summary_file_opened = false;
-        std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
-        sprintf(temp_buf, "%06d", d_time_step_number);
-        std::string file =
-            current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!summary_file_opened)
-        {
-            summary_file_opened = true;
-            std::ofstream sfile(path.c_str(), std::ios::out);
-            sfile << file << std::endl;
-            sfile.close();
-        }
-        else
-        {
-            std::ofstream sfile(path.c_str(), std::ios::app);
-            sfile << file << std::endl;
-            sfile.close();
-        }
-    }
-    SAMRAI_MPI::barrier();
-#else
-    TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
-#endif // if defined(IBTK_HAVE_SILO)
-    return;
-} // writePlotData
-
-void
-LSiloDataWriter::putToDatabase(Pointer<Database> db)
-{
-#if !defined(NDEBUG)
-    TBOX_ASSERT(db);
-#endif
-    db->putInteger("LAG_SILO_DATA_WRITER_VERSION", LAG_SILO_DATA_WRITER_VERSION);
-
-    db->putInteger("d_coarsest_ln", d_coarsest_ln);
-    db->putInteger("d_finest_ln", d_finest_ln);
+    db->putInteger("d_coarsest_ln", d_coarsest_ln);
+    db->putInteger("d_finest_ln", d_finest_ln);
 
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
@@ -2268,6 +1927,524 @@ LSiloDataWriter::putToDatabase(Pointer<Database> db)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+LSiloDataWriter::writeLocalPlotData(const PlotData& plot_data)
+{
+#if defined(IBTK_HAVE_SILO)
+    // Create or open the local DBfile.  Consecutive groups of MPI processes
+    // share a DBfile.  The processes within a group take turns appending their
+    // data to the file, each in its own directory.  Different groups write
+    // concurrently.
+    DBfile* dbfile;
+    if (plot_data.create_file)
+    {
+        if (!(dbfile = DBCreate(plot_data.file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+        {
+            SILO_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                     << "  Could not create DBfile named "
+                                     << plot_data.file_name
+                                     << std::endl);
+        }
+    }
+    else
+    {
+        if (!(dbfile = DBOpen(plot_data.file_name.c_str(), DB_PDB, DB_APPEND)))
+        {
+            SILO_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                     << "  Could not open DBfile named "
+                                     << plot_data.file_name
+                                     << std::endl);
+        }
+    }
+    if (!plot_data.proc_dir_name.empty())
+    {
+        if (DBMkDir(dbfile, plot_data.proc_dir_name.c_str()) == -1 ||
+            DBSetDir(dbfile, plot_data.proc_dir_name.c_str()) == -1)
+        {
+            SILO_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                     << "  Could not create directory named "
+                                     << plot_data.proc_dir_name
+                                     << std::endl);
+        }
+    }
+
+    // Set the local data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (!d_coords_data[ln]) continue;
+
+        const double* const local_X_arr = plot_data.X_data[ln].empty() ? NULL : &plot_data.X_data[ln][0];
+        std::vector<const double*> local_v_arrs(d_nvars[ln], static_cast<const double*>(NULL));
+        for (int v = 0; v < d_nvars[ln]; ++v)
+        {
+            if (!plot_data.var_data[ln][v].empty()) local_v_arrs[v] = &plot_data.var_data[ln][v][0];
+        }
+
+        // Keep track of the current offset in the local Vec data.
+        int offset = 0;
+
+        // Add the local clouds to the local DBfile.
+        for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+        {
+            const int nmarks = d_cloud_nmarks[ln][cloud];
+
+            std::ostringstream stream;
+            stream << "level_" << ln << "_cloud_" << cloud;
+            std::string dirname = stream.str();
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+            {
+                SILO_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                         << "  Could not create directory named "
+                                         << dirname
+                                         << std::endl);
+            }
+
+            const double* const X = local_X_arr + NDIM * offset;
+            std::vector<const double*> var_vals(d_nvars[ln]);
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+            }
+
+            build_local_marker_cloud(dbfile,
+                                     dirname,
+                                     nmarks,
+                                     X,
+                                     d_nvars[ln],
+                                     d_var_names[ln],
+                                     d_var_start_depths[ln],
+                                     d_var_plot_depths[ln],
+                                     d_var_depths[ln],
+                                     var_vals,
+                                     plot_data.time_step_number,
+                                     plot_data.simulation_time);
+
+            offset += nmarks;
+        }
+
+        // Add the local blocks to the local DBfile.
+        for (int block = 0; block < d_nblocks[ln]; ++block)
+        {
+            const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
+            const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
+            const int ntot = nelem.getProduct();
+
+            std::ostringstream stream;
+            stream << "level_" << ln << "_block_" << block;
+            std::string dirname = stream.str();
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+            {
+                SILO_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                         << "  Could not create directory named "
+                                         << dirname
+                                         << std::endl);
+            }
+
+            const double* const X = local_X_arr + NDIM * offset;
+            std::vector<const double*> var_vals(d_nvars[ln]);
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+            }
+
+            build_local_curv_block(dbfile,
+                                   dirname,
+                                   nelem,
+                                   periodic,
+                                   X,
+                                   d_nvars[ln],
+                                   d_var_names[ln],
+                                   d_var_start_depths[ln],
+                                   d_var_plot_depths[ln],
+                                   d_var_depths[ln],
+                                   var_vals,
+                                   plot_data.time_step_number,
+                                   plot_data.simulation_time);
+
+            offset += ntot;
+        }
+
+        // Add the local multiblocks to the local DBfile.
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+        {
+            for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
+            {
+                const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
+                const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
+                const int ntot = nelem.getProduct();
+
+                std::ostringstream stream;
+                stream << "level_" << ln << "_mb_" << mb << "_block_" << block;
+                std::string dirname = stream.str();
+
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                {
+                    SILO_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                             << "  Could not create directory named "
+                                             << dirname
+                                             << std::endl);
+                }
+
+                const double* const X = local_X_arr + NDIM * offset;
+                std::vector<const double*> var_vals(d_nvars[ln]);
+                for (int v = 0; v < d_nvars[ln]; ++v)
+                {
+                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                }
+
+                build_local_curv_block(dbfile,
+                                       dirname,
+                                       nelem,
+                                       periodic,
+                                       X,
+                                       d_nvars[ln],
+                                       d_var_names[ln],
+                                       d_var_start_depths[ln],
+                                       d_var_plot_depths[ln],
+                                       d_var_depths[ln],
+                                       var_vals,
+                                       plot_data.time_step_number,
+                                       plot_data.simulation_time);
+
+                offset += ntot;
+            }
+        }
+
+        // Add the local UCD meshes to the local DBfile.
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
+            const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
+            const size_t ntot = vertices.size();
+
+            std::ostringstream stream;
+            stream << "level_" << ln << "_mesh_" << mesh;
+            std::string dirname = stream.str();
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+            {
+                SILO_ERROR(d_object_name << "::writeLocalPlotData()\n"
+                                         << "  Could not create directory named "
+                                         << dirname
+                                         << std::endl);
+            }
+
+            const double* const X = local_X_arr + NDIM * offset;
+            std::vector<const double*> var_vals(d_nvars[ln]);
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+            }
+
+            build_local_ucd_mesh(dbfile,
+                                 dirname,
+                                 vertices,
+                                 edge_map,
+                                 X,
+                                 d_nvars[ln],
+                                 d_var_names[ln],
+                                 d_var_start_depths[ln],
+                                 d_var_plot_depths[ln],
+                                 d_var_depths[ln],
+                                 var_vals,
+                                 plot_data.time_step_number,
+                                 plot_data.simulation_time);
+
+            offset += ntot;
+        }
+    }
+
+    DBClose(dbfile);
+#else
+    NULL_USE(plot_data);
+#endif // if defined(IBTK_HAVE_SILO)
+    return;
+} // writeLocalPlotData
+
+void
+LSiloDataWriter::writeSummaryPlotData(const PlotData& plot_data)
+{
+#if defined(IBTK_HAVE_SILO)
+    char temp_buf[SILO_NAME_BUFSIZE];
+    DBfile* dbfile;
+
+    // Create and initialize the multimesh Silo database on the root MPI
+    // process.
+    sprintf(temp_buf, "%06d", plot_data.time_step_number);
+    std::string summary_file_name =
+        plot_data.dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+    if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+    {
+        SILO_ERROR(d_object_name << "::writeSummaryPlotData()\n"
+                                 << "  Could not create DBfile named "
+                                 << summary_file_name
+                                 << std::endl);
+    }
+
+    int cycle = plot_data.time_step_number;
+    float time = float(plot_data.simulation_time);
+    double dtime = plot_data.simulation_time;
+
+    static const int MAX_OPTS = 3;
+    DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
+    DBAddOption(optlist, DBOPT_CYCLE, &cycle);
+    DBAddOption(optlist, DBOPT_TIME, &time);
+    DBAddOption(optlist, DBOPT_DTIME, &dtime);
+
+    for (int proc = 0; proc < plot_data.mpi_nodes; ++proc)
+    {
+        // The data of each process are stored either in the root directory
+        // of its own file or in its own directory within a shared file.
+        std::string proc_path = get_processor_file_name(proc, d_nprocs_per_file) + ":";
+        const std::string dir_name = get_processor_dir_name(proc, d_nprocs_per_file);
+        if (!dir_name.empty()) proc_path += "/" + dir_name + "/";
+
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            for (int cloud = 0; cloud < plot_data.nclouds_per_proc[ln][proc]; ++cloud)
+            {
+                std::ostringstream stream;
+                stream << proc_path << "level_" << ln << "_cloud_" << cloud << "/mesh";
+                std::string meshname = stream.str();
+                char* meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = DB_POINTMESH;
+
+                std::string& cloud_name = plot_data.cloud_names_per_proc[ln][proc][cloud];
+
+                DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
+                {
+                    SILO_ERROR(d_object_name << "::writeSummaryPlotData()\n"
+                                             << "  Could not create directory named "
+                                             << cloud_name
+                                             << std::endl);
+                }
+            }
+
+            for (int block = 0; block < plot_data.nblocks_per_proc[ln][proc]; ++block)
+            {
+                std::ostringstream stream;
+                stream << proc_path << "level_" << ln << "_block_" << block << "/mesh";
+                std::string meshname = stream.str();
+                char* meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = plot_data.meshtypes_per_proc[ln][proc][block];
+
+                std::string& block_name = plot_data.block_names_per_proc[ln][proc][block];
+
+                DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                if (DBMkDir(dbfile, block_name.c_str()) == -1)
+                {
+                    SILO_ERROR(d_object_name << "::writeSummaryPlotData()\n"
+                                             << "  Could not create directory named "
+                                             << block_name
+                                             << std::endl);
+                }
+            }
+
+            for (int mb = 0; mb < plot_data.nmbs_per_proc[ln][proc]; ++mb)
+            {
+                const int nblocks = plot_data.mb_nblocks_per_proc[ln][proc][mb];
+                char** meshnames = new char*[nblocks];
+
+                for (int block = 0; block < nblocks; ++block)
+                {
+                    std::ostringstream stream;
+                    stream << proc_path << "level_" << ln << "_mb_" << mb << "_block_" << block << "/mesh";
+                    meshnames[block] = strdup(stream.str().c_str());
+                }
+
+                std::string& mb_name = plot_data.mb_names_per_proc[ln][proc][mb];
+
+                DBPutMultimesh(dbfile,
+                               mb_name.c_str(),
+                               nblocks,
+                               meshnames,
+                               &plot_data.multimeshtypes_per_proc[ln][proc][mb][0],
+                               optlist);
+
+                if (DBMkDir(dbfile, mb_name.c_str()) == -1)
+                {
+                    SILO_ERROR(d_object_name << "::writeSummaryPlotData()\n"
+                                             << "  Could not create directory named "
+                                             << mb_name
+                                             << std::endl);
+                }
+
+                for (int block = 0; block < nblocks; ++block)
+                {
+                    free(meshnames[block]);
+                }
+                delete[] meshnames;
+            }
+
+            for (int mesh = 0; mesh < plot_data.nucd_meshes_per_proc[ln][proc]; ++mesh)
+            {
+                std::ostringstream stream;
+                stream << proc_path << "level_" << ln << "_mesh_" << mesh << "/mesh";
+                std::string meshname = stream.str();
+                char* meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = DB_UCDMESH;
+
+                std::string& mesh_name = plot_data.ucd_mesh_names_per_proc[ln][proc][mesh];
+
+                DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
+                {
+                    SILO_ERROR(d_object_name << "::writeSummaryPlotData()\n"
+                                             << "  Could not create directory named "
+                                             << mesh_name
+                                             << std::endl);
+                }
+            }
+
+            for (int v = 0; v < d_nvars[ln]; ++v)
+            {
+                for (int cloud = 0; cloud < plot_data.nclouds_per_proc[ln][proc]; ++cloud)
+                {
+                    std::ostringstream varname_stream;
+                    varname_stream << proc_path << "level_" << ln << "_cloud_" << cloud << "/"
+                                   << d_var_names[ln][v];
+                    std::string varname = varname_stream.str();
+                    char* varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = DB_POINTVAR;
+
+                    std::string& cloud_name = plot_data.cloud_names_per_proc[ln][proc][cloud];
+
+                    std::ostringstream stream;
+                    stream << cloud_name << "/" << d_var_names[ln][v];
+                    std::string var_name = stream.str();
+
+                    DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+
+                for (int block = 0; block < plot_data.nblocks_per_proc[ln][proc]; ++block)
+                {
+                    std::ostringstream varname_stream;
+                    varname_stream << proc_path << "level_" << ln << "_block_" << block << "/"
+                                   << d_var_names[ln][v];
+                    std::string varname = varname_stream.str();
+                    char* varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = plot_data.vartypes_per_proc[ln][proc][block];
+
+                    std::string& block_name = plot_data.block_names_per_proc[ln][proc][block];
+
+                    std::ostringstream stream;
+                    stream << block_name << "/" << d_var_names[ln][v];
+                    std::string var_name = stream.str();
+
+                    DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+
+                for (int mb = 0; mb < plot_data.nmbs_per_proc[ln][proc]; ++mb)
+                {
+                    const int nblocks = plot_data.mb_nblocks_per_proc[ln][proc][mb];
+                    char** varnames = new char*[nblocks];
+
+                    for (int block = 0; block < nblocks; ++block)
+                    {
+                        std::ostringstream varname_stream;
+                        varname_stream << proc_path << "level_" << ln << "_mb_" << mb << "_block_" << block
+                                       << d_var_names[ln][v];
+                        varnames[block] = strdup(varname_stream.str().c_str());
+                    }
+
+                    std::string& mb_name = plot_data.mb_names_per_proc[ln][proc][mb];
+
+                    std::ostringstream stream;
+                    stream << mb_name << "/" << d_var_names[ln][v];
+                    std::string var_name = stream.str();
+
+                    DBPutMultivar(dbfile,
+                                  var_name.c_str(),
+                                  nblocks,
+                                  varnames,
+                                  &plot_data.multivartypes_per_proc[ln][proc][mb][0],
+                                  optlist);
+
+                    for (int block = 0; block < nblocks; ++block)
+                    {
+                        free(varnames[block]);
+                    }
+                    delete[] varnames;
+                }
+
+                for (int mesh = 0; mesh < plot_data.nucd_meshes_per_proc[ln][proc]; ++mesh)
+                {
+                    std::ostringstream varname_stream;
+                    varname_stream << proc_path << "level_" << ln << "_mesh_" << mesh << "/"
+                                   << d_var_names[ln][v];
+                    std::string varname = varname_stream.str();
+                    char* varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = DB_UCDVAR;
+
+                    std::string& mesh_name = plot_data.ucd_mesh_names_per_proc[ln][proc][mesh];
+
+                    std::ostringstream stream;
+                    stream << mesh_name << "/" << d_var_names[ln][v];
+                    std::string var_name = stream.str();
+
+                    DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+            }
+        }
+    }
+
+    DBFreeOptlist(optlist);
+    DBClose(dbfile);
+
+    // Create or update the dumps file on the root MPI process.
+    static bool summary_file_opened = false;
+    std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
+    sprintf(temp_buf, "%06d", plot_data.time_step_number);
+    std::string file =
+        plot_data.current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+    if (!summary_file_opened)
+    {
+        summary_file_opened = true;
+        std::ofstream sfile(path.c_str(), std::ios::out);
+        sfile << file << std::endl;
+        sfile.close();
+    }
+    else
+    {
+        std::ofstream sfile(path.c_str(), std::ios::app);
+        sfile << file << std::endl;
+        sfile.close();
+    }
+#else
+    NULL_USE(plot_data);
+#endif // if defined(IBTK_HAVE_SILO)
+    return;
+} // writeSummaryPlotData
+
+void*
+LSiloDataWriter::writePlotDataAsync(void* writer_ptr)
+{
+    // Errors are recorded and raised on the main thread by
+    // waitForPendingOutput(); the helper thread must not abort the program.
+    LSiloDataWriter* const writer = static_cast<LSiloDataWriter*>(writer_ptr);
+    PlotData& plot_data = *writer->d_pending_plot_data;
+    try
+    {
+        writer->writeLocalPlotData(plot_data);
+        if (plot_data.write_summary) writer->writeSummaryPlotData(plot_data);
+    }
+    catch (const std::exception& e)
+    {
+        plot_data.error_message = e.what();
+    }
+    catch (...)
+    {
+        plot_data.error_message = "  unrecognized exception generated while writing Silo files\n";
+    }
+    return NULL;
+} // writePlotDataAsync
+
 void
 LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
 {
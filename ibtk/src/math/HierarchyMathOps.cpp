@@ -46,6 +46,7 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellDataFactory.h"
 #include "CellVariable.h"
 #include "CoarseFineBoundary.h"
 #include "CoarsenAlgorithm.h"
@@ -142,6 +143,31 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Collect the local patches of a level so that they can be distributed among
+// threads.  Each patch is processed by exactly one thread, and the patch
+// operations only write data on their own patch, so the results do not depend
+// on the number of threads.
+//
+// The reference counts of SAMRAI::tbox::Pointer are not atomic.  The patch
+// pointers are therefore copied here, on the calling thread, and inside the
+// threaded loops only pointers to the patch, its geometry, and its patch data
+// are copied.  These objects are owned by a single patch, so no reference
+// count is modified by more than one thread.  The threaded loops must not
+// allocate or release patch data.
+inline void
+getLevelPatches(std::vector<Pointer<Patch<NDIM> > >& patches, const Pointer<PatchLevel<NDIM> > level)
+{
+    patches.clear();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patches.push_back(level->getPatch(p()));
+    }
+    return;
+} // getLevelPatches
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 HierarchyMathOps::HierarchyMathOps(const std::string& name,
@@ -183,7 +209,8 @@ HierarchyMathOps::HierarchyMathOps(const std::string& name,
       d_using_wgt_cc(false),
       d_using_wgt_fc(false),
       d_using_wgt_sc(false),
-      d_volume(0.0)
+      d_volume(0.0),
+      d_use_threaded_patch_loops(true)
 {
     // Setup scratch variables.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -296,6 +323,13 @@ HierarchyMathOps::~HierarchyMathOps()
     return;
 } // ~HierarchyMathOps
 
+void
+HierarchyMathOps::setUseThreadedPatchLoops(const bool use_threaded_patch_loops)
+{
+    d_use_threaded_patch_loops = use_threaded_patch_loops;
+    return;
+} // setUseThreadedPatchLoops
+
 void
 HierarchyMathOps::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
@@ -439,15 +473,20 @@ HierarchyMathOps::curl(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     if ((d_coarsest_ln == d_finest_ln) && (d_finest_ln == 0))
     {
         const int ln = d_coarsest_ln;
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -483,9 +522,13 @@ HierarchyMathOps::curl(const int dst_idx,
             {
                 Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+                for (int k = 0; k < static_cast<int>(patches.size()); ++k)
                 {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    const Pointer<Patch<NDIM> >& patch = patches[k];
 
                     Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                     Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
@@ -624,14 +667,19 @@ HierarchyMathOps::curl(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -652,14 +700,19 @@ HierarchyMathOps::curl(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -680,14 +733,19 @@ HierarchyMathOps::curl(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -708,14 +766,19 @@ HierarchyMathOps::curl(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -741,14 +804,19 @@ HierarchyMathOps::curl(const int dst_idx,
 #endif
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -774,14 +842,19 @@ HierarchyMathOps::curl(const int dst_idx,
 #endif
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -817,14 +890,19 @@ HierarchyMathOps::rot(int dst_idx,
 
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -860,14 +938,19 @@ HierarchyMathOps::rot(int dst_idx,
 
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -903,14 +986,19 @@ HierarchyMathOps::rot(int dst_idx,
 
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<EdgeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -941,14 +1029,19 @@ HierarchyMathOps::rot(int dst_idx,
 
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete rot.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -975,15 +1068,20 @@ HierarchyMathOps::div(const int dst_idx,
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     if ((d_coarsest_ln == d_finest_ln) && (d_finest_ln == 0))
     {
         const int ln = d_finest_ln;
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1049,6 +1147,7 @@ HierarchyMathOps::div(const int dst_idx,
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1061,9 +1160,13 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1107,6 +1210,7 @@ HierarchyMathOps::div(const int dst_idx,
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1119,9 +1223,13 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1163,15 +1271,20 @@ HierarchyMathOps::grad(const int dst_idx,
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     if ((d_coarsest_ln == d_finest_ln) && (d_finest_ln == 0))
     {
         const int ln = d_finest_ln;
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1270,6 +1383,7 @@ HierarchyMathOps::grad(const int dst_idx,
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1282,9 +1396,13 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1329,6 +1447,7 @@ HierarchyMathOps::grad(const int dst_idx,
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1341,9 +1460,13 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1563,6 +1686,7 @@ HierarchyMathOps::grad(const int dst_idx,
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1575,9 +1699,13 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1660,6 +1788,7 @@ HierarchyMathOps::grad(const int dst_idx,
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1672,9 +1801,13 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1751,6 +1884,7 @@ HierarchyMathOps::interp(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1762,9 +1896,13 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1799,6 +1937,7 @@ HierarchyMathOps::interp(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1810,9 +1949,13 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1847,6 +1990,7 @@ HierarchyMathOps::interp(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1858,9 +2002,13 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1898,6 +2046,7 @@ HierarchyMathOps::interp(const int dst_idx,
 {
     if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1909,9 +2058,13 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1993,6 +2146,7 @@ HierarchyMathOps::laplace(const int dst_idx,
 #endif
     }
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
     if ((d_coarsest_ln == d_finest_ln) && (alpha_idx == -1) && (!nonaligned_anisotropy))
     {
         // Compute dst = div alpha grad src1 + beta src1 + gamma src2.
@@ -2000,9 +2154,13 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2230,13 +2388,19 @@ HierarchyMathOps::laplace(const int dst_idx,
         }
     }
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
+
     // Compute dst = div grad src1 independently on each level.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2260,9 +2424,13 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
@@ -2318,14 +2486,20 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
         }
     }
 
+    std::vector<Pointer<Patch<NDIM> > > patches;
+
     // Compute dst = alpha div coef ((grad src1) + (grad src1)^T) + beta src1 +
     // gamma src2 independently on each level.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > coef_data = patch->getPatchData(coef_idx);
@@ -2350,9 +2524,13 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
@@ -2372,6 +2550,141 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     return;
 } // vc_laplace
 
+void
+HierarchyMathOps::stokes(const int dst_u_idx,
+                         const Pointer<SideVariable<NDIM, double> > dst_u_var,
+                         const int dst_p_idx,
+                         const Pointer<CellVariable<NDIM, double> > dst_p_var,
+                         const PoissonSpecifications& poisson_spec,
+                         const int src_u_idx,
+                         const Pointer<SideVariable<NDIM, double> > src_u_var,
+                         const int src_p_idx,
+                         const Pointer<CellVariable<NDIM, double> > src_p_var,
+                         const Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+                         const double src_ghost_fill_time,
+                         const double gamma,
+                         const double delta)
+{
+    if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
+
+    const double alpha = poisson_spec.dIsConstant() ? poisson_spec.getDConstant() : 0.0;
+    const double beta = poisson_spec.cIsConstant() ? poisson_spec.getCConstant() : 0.0;
+
+    if (!poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  side-centered Laplacian requires spatially constant scalar-valued "
+                      "diffusivity"
+                   << std::endl);
+    }
+
+    if (!poisson_spec.cIsConstant() && !poisson_spec.cIsZero())
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  side-centered Laplacian requires spatially constant scalar-valued "
+                      "damping factor"
+                   << std::endl);
+    }
+
+    Pointer<SideDataFactory<NDIM, double> > dst_u_factory = dst_u_var->getPatchDataFactory();
+    Pointer<SideDataFactory<NDIM, double> > src_u_factory = src_u_var->getPatchDataFactory();
+    Pointer<CellDataFactory<NDIM, double> > dst_p_factory = dst_p_var->getPatchDataFactory();
+    Pointer<CellDataFactory<NDIM, double> > src_p_factory = src_p_var->getPatchDataFactory();
+    if (dst_u_factory->getDefaultDepth() != 1 || src_u_factory->getDefaultDepth() != 1 ||
+        dst_p_factory->getDefaultDepth() != 1 || src_p_factory->getDefaultDepth() != 1)
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  staggered-grid Stokes operator requires scalar-valued data"
+                   << std::endl);
+    }
+
+    // Allocate temporary data to synchronize the coarse-fine interface.
+    for (int ln = d_coarsest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_os_idx);
+    }
+
+    std::vector<Pointer<Patch<NDIM> > > patches;
+
+    // Compute the operator from the finest level to the coarsest so that each
+    // level is synchronized with the next finer level before it is used.
+    for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
+        {
+            const Pointer<Patch<NDIM> >& patch = patches[k];
+
+            Pointer<SideData<NDIM, double> > dst_u_data = patch->getPatchData(dst_u_idx);
+            Pointer<CellData<NDIM, double> > dst_p_data = patch->getPatchData(dst_p_idx);
+            Pointer<SideData<NDIM, double> > src_u_data = patch->getPatchData(src_u_idx);
+            Pointer<CellData<NDIM, double> > src_p_data = patch->getPatchData(src_p_idx);
+
+            d_patch_math_ops.stokes(dst_u_data, dst_p_data, alpha, beta, gamma, delta, src_u_data, src_p_data, patch);
+        }
+
+        if (ln == d_finest_ln) continue;
+
+        // Synchronize the coarse-fine interface of dst_u and then of src_u.
+        // The momentum equation is evaluated using the unsynchronized values
+        // of src_u, as in laplace(), whereas the divergence is evaluated using
+        // the synchronized values, as in div().
+        Pointer<PatchLevel<NDIM> > finer_level = d_hierarchy->getPatchLevel(ln + 1);
+        getLevelPatches(patches, finer_level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
+        {
+            const Pointer<Patch<NDIM> >& patch = patches[k];
+            Pointer<SideData<NDIM, double> > dst_u_data = patch->getPatchData(dst_u_idx);
+            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+            os_data->copy(*dst_u_data);
+        }
+        xeqScheduleOutersideRestriction(dst_u_idx, d_os_idx, ln);
+
+        getLevelPatches(patches, finer_level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
+        {
+            const Pointer<Patch<NDIM> >& patch = patches[k];
+            Pointer<SideData<NDIM, double> > src_u_data = patch->getPatchData(src_u_idx);
+            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+            os_data->copy(*src_u_data);
+        }
+        xeqScheduleOutersideRestriction(src_u_idx, d_os_idx, ln);
+
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
+        {
+            const Pointer<Patch<NDIM> >& patch = patches[k];
+
+            Pointer<CellData<NDIM, double> > dst_p_data = patch->getPatchData(dst_p_idx);
+            Pointer<SideData<NDIM, double> > src_u_data = patch->getPatchData(src_u_idx);
+
+            d_patch_math_ops.div(dst_p_data, delta, src_u_data, 0.0, Pointer<CellData<NDIM, double> >(), patch);
+        }
+    }
+
+    // Deallocate temporary data.
+    for (int ln = d_coarsest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(d_os_idx);
+    }
+    return;
+} // stokes
+
 void
 HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const Pointer<CellVariable<NDIM, double> > /*dst_var*/,
@@ -2385,13 +2698,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int src1_depth,
                                     const int src2_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2420,13 +2738,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int src2_depth,
                                     const int alpha_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2466,13 +2789,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int alpha_depth,
                                     const int beta_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2510,13 +2838,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int src1_depth,
                                     const int src2_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2545,13 +2878,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int src2_depth,
                                     const int alpha_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2591,13 +2929,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int alpha_depth,
                                     const int beta_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2635,13 +2978,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int src1_depth,
                                     const int src2_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2670,13 +3018,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int src2_depth,
                                     const int alpha_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2716,13 +3069,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int alpha_depth,
                                     const int beta_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2760,13 +3118,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int src1_depth,
                                     const int src2_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2795,13 +3158,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int src2_depth,
                                     const int alpha_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2841,13 +3209,18 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const int alpha_depth,
                                     const int beta_depth)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2878,13 +3251,18 @@ HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
                                   const int src_idx,
                                   const Pointer<CellVariable<NDIM, double> > /*src_var*/)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2901,13 +3279,18 @@ HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
                                   const int src_idx,
                                   const Pointer<CellVariable<NDIM, double> > /*src_var*/)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2924,13 +3307,18 @@ HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
                                    const int src_idx,
                                    const Pointer<CellVariable<NDIM, double> > /*src_var*/)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2947,13 +3335,18 @@ HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
                                   const int src_idx,
                                   const Pointer<NodeVariable<NDIM, double> > /*src_var*/)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2970,13 +3363,18 @@ HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
                                   const int src_idx,
                                   const Pointer<NodeVariable<NDIM, double> > /*src_var*/)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2993,13 +3391,18 @@ HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
                                    const int src_idx,
                                    const Pointer<NodeVariable<NDIM, double> > /*src_var*/)
 {
+    std::vector<Pointer<Patch<NDIM> > > patches;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        getLevelPatches(patches, level);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loops)
+#endif
+        for (int k = 0; k < static_cast<int>(patches.size()); ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = patches[k];
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
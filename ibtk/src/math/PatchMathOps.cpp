@@ -114,6 +114,8 @@
 #define S_TO_C_DIV_ADD_FC IBTK_FC_FUNC(stocdivadd2d, STOCDIVADD2D)
 #define S_TO_C_INTERP_FC IBTK_FC_FUNC(stocinterp2nd2d, STOCINTERP2ND2D)
 
+#define S_TO_S_STOKES_FC IBTK_FC_FUNC(stokes2d, STOKES2D)
+
 #define S_TO_S_VC_LAPLACE_FC IBTK_FC_FUNC(stosvclaplace2d, STOSVCLAPLACE2D)
 
 #define N_TO_S_ROT_FC IBTK_FC_FUNC(ntosrot2d, NTOSROT2D)
@@ -184,6 +186,8 @@
 #define S_TO_C_DIV_ADD_FC IBTK_FC_FUNC(stocdivadd3d, STOCDIVADD3D)
 #define S_TO_C_INTERP_FC IBTK_FC_FUNC(stocinterp2nd3d, STOCINTERP2ND3D)
 
+#define S_TO_S_STOKES_FC IBTK_FC_FUNC(stokes3d, STOKES3D)
+
 #define S_TO_S_CURL_FC IBTK_FC_FUNC(stoscurl3d, STOSCURL3D)
 
 #define S_TO_E_CURL_FC IBTK_FC_FUNC(stoecurl3d, STOECURL3D)
@@ -1121,6 +1125,36 @@ void S_TO_C_CURL_FC(double* W,
 #endif
                     const double* dx);
 
+void S_TO_S_STOKES_FC(double* F0,
+                      double* F1,
+#if (NDIM == 3)
+                      double* F2,
+#endif
+                      const int& F_gcw,
+                      double* D,
+                      const int& D_gcw,
+                      const double& alpha,
+                      const double& beta,
+                      const double& gamma,
+                      const double& delta,
+                      const double* u0,
+                      const double* u1,
+#if (NDIM == 3)
+                      const double* u2,
+#endif
+                      const int& u_gcw,
+                      const double* P,
+                      const int& P_gcw,
+                      const int& ilower0,
+                      const int& iupper0,
+                      const int& ilower1,
+                      const int& iupper1,
+#if (NDIM == 3)
+                      const int& ilower2,
+                      const int& iupper2,
+#endif
+                      const double* dx);
+
 void S_TO_C_DIV_FC(double* D,
                    const int& D_gcw,
                    const double& alpha,
@@ -5294,6 +5328,119 @@ PatchMathOps::vc_laplace(Pointer<SideData<NDIM, double> > dst,
     return;
 } // vc_laplace
 
+void
+PatchMathOps::stokes(Pointer<SideData<NDIM, double> > dst_u,
+                     Pointer<CellData<NDIM, double> > dst_p,
+                     const double alpha,
+                     const double beta,
+                     const double gamma,
+                     const double delta,
+                     const Pointer<SideData<NDIM, double> > src_u,
+                     const Pointer<CellData<NDIM, double> > src_p,
+                     const Pointer<Patch<NDIM> > patch) const
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    double* const F0 = dst_u->getPointer(0);
+    double* const F1 = dst_u->getPointer(1);
+#if (NDIM == 3)
+    double* const F2 = dst_u->getPointer(2);
+#endif
+    const int F_ghosts = (dst_u->getGhostCellWidth()).max();
+
+    double* const D = dst_p->getPointer();
+    const int D_ghosts = (dst_p->getGhostCellWidth()).max();
+
+    const double* const u0 = src_u->getPointer(0);
+    const double* const u1 = src_u->getPointer(1);
+#if (NDIM == 3)
+    const double* const u2 = src_u->getPointer(2);
+#endif
+    const int u_ghosts = (src_u->getGhostCellWidth()).max();
+
+    const double* const P = src_p->getPointer();
+    const int P_ghosts = (src_p->getGhostCellWidth()).max();
+
+    const Box<NDIM>& patch_box = patch->getBox();
+
+#if !defined(NDEBUG)
+    if (F_ghosts != (dst_u->getGhostCellWidth()).min() || D_ghosts != (dst_p->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  dst_u or dst_p does not have uniform ghost cell widths"
+                   << std::endl);
+    }
+
+    if (u_ghosts != (src_u->getGhostCellWidth()).min() || P_ghosts != (src_p->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_u or src_p does not have uniform ghost cell widths"
+                   << std::endl);
+    }
+
+    if (u_ghosts < 1 || P_ghosts < 1)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_u and src_p must have at least one ghost cell"
+                   << std::endl);
+    }
+
+    if (src_u == dst_u)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_u == dst_u."
+                   << std::endl);
+    }
+
+    if (patch_box != dst_u->getBox() || patch_box != dst_p->getBox() || patch_box != src_u->getBox() ||
+        patch_box != src_p->getBox())
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  dst_u, dst_p, src_u, and src_p must all live on the same patch"
+                   << std::endl);
+    }
+
+    if (dst_u->getDepth() != 1 || dst_p->getDepth() != 1 || src_u->getDepth() != 1 || src_p->getDepth() != 1)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  dst_u, dst_p, src_u, and src_p must be scalar-valued"
+                   << std::endl);
+    }
+#endif
+
+    S_TO_S_STOKES_FC(F0,
+                     F1,
+#if (NDIM == 3)
+                     F2,
+#endif
+                     F_ghosts,
+                     D,
+                     D_ghosts,
+                     alpha,
+                     beta,
+                     gamma,
+                     delta,
+                     u0,
+                     u1,
+#if (NDIM == 3)
+                     u2,
+#endif
+                     u_ghosts,
+                     P,
+                     P_ghosts,
+                     patch_box.lower(0),
+                     patch_box.upper(0),
+                     patch_box.lower(1),
+                     patch_box.upper(1),
+#if (NDIM == 3)
+                     patch_box.lower(2),
+                     patch_box.upper(2),
+#endif
+                     dx);
+    return;
+} // stokes
+
 void
 PatchMathOps::pointwiseMultiply(Pointer<CellData<NDIM, double> > dst,
                                 const double alpha,
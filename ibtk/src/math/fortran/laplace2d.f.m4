@@ -1462,3 +1462,101 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Computes the action of the staggered-grid Stokes operator
+c
+c        F = alpha div grad u + beta u + gamma grad P
+c        D = delta div u
+c
+c     in a single sweep over the patch, where u = (u0,u1) and F =
+c     (F0,F1) are side centered and P and D are cell centered.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine stokes2d(
+     &     F0,F1,F_gcw,
+     &     D,D_gcw,
+     &     alpha,beta,gamma,delta,
+     &     u0,u1,u_gcw,
+     &     P,P_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER F_gcw,D_gcw,u_gcw,P_gcw
+
+      REAL alpha,beta,gamma,delta
+
+      REAL u0(SIDE2d0(ilower,iupper,u_gcw))
+      REAL u1(SIDE2d1(ilower,iupper,u_gcw))
+
+      REAL P(CELL2d(ilower,iupper,P_gcw))
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL F0(SIDE2d0(ilower,iupper,F_gcw))
+      REAL F1(SIDE2d1(ilower,iupper,F_gcw))
+
+      REAL D(CELL2d(ilower,iupper,D_gcw))
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1
+      REAL    gfac0,gfac1
+      REAL    dfac0,dfac1
+c
+c     Each cell updates the sides on its lower faces along with its
+c     divergence.  The uppermost sides in each direction are updated
+c     at the end of the corresponding sweep.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+
+      gfac0 = gamma/dx(0)
+      gfac1 = gamma/dx(1)
+
+      dfac0 = delta/dx(0)
+      dfac1 = delta/dx(1)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            F0(i0,i1) =
+     &           fac0*(u0(i0-1,i1)+u0(i0+1,i1)-2.d0*u0(i0,i1)) +
+     &           fac1*(u0(i0,i1-1)+u0(i0,i1+1)-2.d0*u0(i0,i1)) +
+     &           beta*u0(i0,i1) + gfac0*(P(i0,i1)-P(i0-1,i1))
+            F1(i0,i1) =
+     &           fac0*(u1(i0-1,i1)+u1(i0+1,i1)-2.d0*u1(i0,i1)) +
+     &           fac1*(u1(i0,i1-1)+u1(i0,i1+1)-2.d0*u1(i0,i1)) +
+     &           beta*u1(i0,i1) + gfac1*(P(i0,i1)-P(i0,i1-1))
+            D(i0,i1) =
+     &           dfac0*(u0(i0+1,i1)-u0(i0,i1)) +
+     &           dfac1*(u1(i0,i1+1)-u1(i0,i1))
+         enddo
+         i0 = iupper0+1
+         F0(i0,i1) =
+     &        fac0*(u0(i0-1,i1)+u0(i0+1,i1)-2.d0*u0(i0,i1)) +
+     &        fac1*(u0(i0,i1-1)+u0(i0,i1+1)-2.d0*u0(i0,i1)) +
+     &        beta*u0(i0,i1) + gfac0*(P(i0,i1)-P(i0-1,i1))
+      enddo
+
+      i1 = iupper1+1
+      do i0 = ilower0,iupper0
+         F1(i0,i1) =
+     &        fac0*(u1(i0-1,i1)+u1(i0+1,i1)-2.d0*u1(i0,i1)) +
+     &        fac1*(u1(i0,i1-1)+u1(i0,i1+1)-2.d0*u1(i0,i1)) +
+     &        beta*u1(i0,i1) + gfac1*(P(i0,i1)-P(i0,i1-1))
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
@@ -1768,3 +1768,154 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Computes the action of the staggered-grid Stokes operator
+c
+c        F = alpha div grad u + beta u + gamma grad P
+c        D = delta div u
+c
+c     in a single sweep over the patch, where u = (u0,u1,u2) and F =
+c     (F0,F1,F2) are side centered and P and D are cell centered.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine stokes3d(
+     &     F0,F1,F2,F_gcw,
+     &     D,D_gcw,
+     &     alpha,beta,gamma,delta,
+     &     u0,u1,u2,u_gcw,
+     &     P,P_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER F_gcw,D_gcw,u_gcw,P_gcw
+
+      REAL alpha,beta,gamma,delta
+
+      REAL u0(SIDE3d0(ilower,iupper,u_gcw))
+      REAL u1(SIDE3d1(ilower,iupper,u_gcw))
+      REAL u2(SIDE3d2(ilower,iupper,u_gcw))
+
+      REAL P(CELL3d(ilower,iupper,P_gcw))
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL F0(SIDE3d0(ilower,iupper,F_gcw))
+      REAL F1(SIDE3d1(ilower,iupper,F_gcw))
+      REAL F2(SIDE3d2(ilower,iupper,F_gcw))
+
+      REAL D(CELL3d(ilower,iupper,D_gcw))
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    fac0,fac1,fac2
+      REAL    gfac0,gfac1,gfac2
+      REAL    dfac0,dfac1,dfac2
+c
+c     Each cell updates the sides on its lower faces along with its
+c     divergence.  The uppermost sides in each direction are updated
+c     at the end of the corresponding sweep.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+
+      gfac0 = gamma/dx(0)
+      gfac1 = gamma/dx(1)
+      gfac2 = gamma/dx(2)
+
+      dfac0 = delta/dx(0)
+      dfac1 = delta/dx(1)
+      dfac2 = delta/dx(2)
+
+      do i2 = ilower2,iupper2
+         do i1 = ilower1,iupper1
+            do i0 = ilower0,iupper0
+               F0(i0,i1,i2) =
+     &              fac0*(u0(i0-1,i1,i2)+u0(i0+1,i1,i2)
+     &                   -2.d0*u0(i0,i1,i2)) +
+     &              fac1*(u0(i0,i1-1,i2)+u0(i0,i1+1,i2)
+     &                   -2.d0*u0(i0,i1,i2)) +
+     &              fac2*(u0(i0,i1,i2-1)+u0(i0,i1,i2+1)
+     &                   -2.d0*u0(i0,i1,i2)) +
+     &              beta*u0(i0,i1,i2) +
+     &              gfac0*(P(i0,i1,i2)-P(i0-1,i1,i2))
+               F1(i0,i1,i2) =
+     &              fac0*(u1(i0-1,i1,i2)+u1(i0+1,i1,i2)
+     &                   -2.d0*u1(i0,i1,i2)) +
+     &              fac1*(u1(i0,i1-1,i2)+u1(i0,i1+1,i2)
+     &                   -2.d0*u1(i0,i1,i2)) +
+     &              fac2*(u1(i0,i1,i2-1)+u1(i0,i1,i2+1)
+     &                   -2.d0*u1(i0,i1,i2)) +
+     &              beta*u1(i0,i1,i2) +
+     &              gfac1*(P(i0,i1,i2)-P(i0,i1-1,i2))
+               F2(i0,i1,i2) =
+     &              fac0*(u2(i0-1,i1,i2)+u2(i0+1,i1,i2)
+     &                   -2.d0*u2(i0,i1,i2)) +
+     &              fac1*(u2(i0,i1-1,i2)+u2(i0,i1+1,i2)
+     &                   -2.d0*u2(i0,i1,i2)) +
+     &              fac2*(u2(i0,i1,i2-1)+u2(i0,i1,i2+1)
+     &                   -2.d0*u2(i0,i1,i2)) +
+     &              beta*u2(i0,i1,i2) +
+     &              gfac2*(P(i0,i1,i2)-P(i0,i1,i2-1))
+               D(i0,i1,i2) =
+     &              dfac0*(u0(i0+1,i1,i2)-u0(i0,i1,i2)) +
+     &              dfac1*(u1(i0,i1+1,i2)-u1(i0,i1,i2)) +
+     &              dfac2*(u2(i0,i1,i2+1)-u2(i0,i1,i2))
+            enddo
+            i0 = iupper0+1
+            F0(i0,i1,i2) =
+     &           fac0*(u0(i0-1,i1,i2)+u0(i0+1,i1,i2)
+     &                -2.d0*u0(i0,i1,i2)) +
+     &           fac1*(u0(i0,i1-1,i2)+u0(i0,i1+1,i2)
+     &                -2.d0*u0(i0,i1,i2)) +
+     &           fac2*(u0(i0,i1,i2-1)+u0(i0,i1,i2+1)
+     &                -2.d0*u0(i0,i1,i2)) +
+     &           beta*u0(i0,i1,i2) +
+     &           gfac0*(P(i0,i1,i2)-P(i0-1,i1,i2))
+         enddo
+         i1 = iupper1+1
+         do i0 = ilower0,iupper0
+            F1(i0,i1,i2) =
+     &           fac0*(u1(i0-1,i1,i2)+u1(i0+1,i1,i2)
+     &                -2.d0*u1(i0,i1,i2)) +
+     &           fac1*(u1(i0,i1-1,i2)+u1(i0,i1+1,i2)
+     &                -2.d0*u1(i0,i1,i2)) +
+     &           fac2*(u1(i0,i1,i2-1)+u1(i0,i1,i2+1)
+     &                -2.d0*u1(i0,i1,i2)) +
+     &           beta*u1(i0,i1,i2) +
+     &           gfac1*(P(i0,i1,i2)-P(i0,i1-1,i2))
+         enddo
+      enddo
+
+      i2 = iupper2+1
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            F2(i0,i1,i2) =
+     &           fac0*(u2(i0-1,i1,i2)+u2(i0+1,i1,i2)
+     &                -2.d0*u2(i0,i1,i2)) +
+     &           fac1*(u2(i0,i1-1,i2)+u2(i0,i1+1,i2)
+     &                -2.d0*u2(i0,i1,i2)) +
+     &           fac2*(u2(i0,i1,i2-1)+u2(i0,i1,i2+1)
+     &                -2.d0*u2(i0,i1,i2)) +
+     &           beta*u2(i0,i1,i2) +
+     &           gfac2*(P(i0,i1,i2)-P(i0,i1,i2-1))
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
@@ -44,6 +44,7 @@
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/GeneralSolver.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PhaseProfiler.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
@@ -123,6 +124,8 @@ FACPreconditioner::setTimeInterval(const double current_time, const double new_t
 bool
 FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f)
 {
+    IBTK_PROFILER_SCOPE("FACPreconditioner::solveSystem");
+
     // Initialize the solver, when necessary.
     const bool deallocate_after_solve = !d_is_initialized;
     if (deallocate_after_solve) initializeSolverState(u, f);
@@ -0,0 +1,601 @@
+// Filename: PETScBlockKrylovSolver.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/PETScBlockKrylovSolver.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "petscksp.h"
+#include "petscmat.h"
+#include "petscpc.h"
+#include "petscsys.h"
+#include "petscvec.h"
+#include "tbox/PIO.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_systems;
+
+// Relative tolerance used to detect (near) linear dependence of new block
+// Krylov basis vectors.
+static const double BREAKDOWN_TOL = 1.0e-12;
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PETScBlockKrylovSolver::PETScBlockKrylovSolver(const std::string& object_name)
+    : d_object_name(object_name),
+      d_petsc_mat(NULL),
+      d_petsc_pc(NULL),
+      d_rel_residual_tol(1.0e-5),
+      d_abs_residual_tol(1.0e-50),
+      d_max_iterations(10000),
+      d_restart(30),
+      d_max_num_basis_vecs(200),
+      d_initial_guess_nonzero(false),
+      d_check_separate_solves(false),
+      d_enable_logging(false),
+      d_current_iterations(0),
+      d_current_applications(0),
+      d_current_residual_norm(0.0)
+{
+    IBTK_DO_ONCE(t_solve_systems =
+                     TimerManager::getManager()->getTimer("IBTK::PETScBlockKrylovSolver::solveSystems()"););
+    return;
+} // PETScBlockKrylovSolver
+
+PETScBlockKrylovSolver::~PETScBlockKrylovSolver()
+{
+    // intentionally blank
+    return;
+} // ~PETScBlockKrylovSolver
+
+void
+PETScBlockKrylovSolver::setFromKSP(KSP petsc_ksp)
+{
+    int ierr;
+
+    // Use the operator and (if any) the preconditioner of the KSP object.
+    Mat petsc_mat;
+    ierr = KSPGetOperators(petsc_ksp, &petsc_mat, NULL);
+    IBTK_CHKERRQ(ierr);
+    setOperator(petsc_mat);
+
+    PC petsc_pc;
+    ierr = KSPGetPC(petsc_ksp, &petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    PetscBool pc_is_none;
+    ierr = PetscObjectTypeCompare(reinterpret_cast<PetscObject>(petsc_pc), PCNONE, &pc_is_none);
+    IBTK_CHKERRQ(ierr);
+    if (pc_is_none)
+    {
+        setPreconditioner(NULL);
+    }
+    else
+    {
+        ierr = PCSetUp(petsc_pc);
+        IBTK_CHKERRQ(ierr);
+        setPreconditioner(petsc_pc);
+    }
+
+    // Use the convergence criteria and restart length of the KSP object.
+    PetscReal rtol, abstol, dtol;
+    PetscInt max_its;
+    ierr = KSPGetTolerances(petsc_ksp, &rtol, &abstol, &dtol, &max_its);
+    IBTK_CHKERRQ(ierr);
+    setTolerances(rtol, abstol, max_its);
+
+    PetscBool ksp_is_gmres, ksp_is_fgmres;
+    ierr = PetscObjectTypeCompare(reinterpret_cast<PetscObject>(petsc_ksp), KSPGMRES, &ksp_is_gmres);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscObjectTypeCompare(reinterpret_cast<PetscObject>(petsc_ksp), KSPFGMRES, &ksp_is_fgmres);
+    IBTK_CHKERRQ(ierr);
+    if (ksp_is_gmres || ksp_is_fgmres)
+    {
+        PetscInt restart;
+        ierr = KSPGMRESGetRestart(petsc_ksp, &restart);
+        IBTK_CHKERRQ(ierr);
+        setRestart(restart);
+    }
+
+    PetscBool initial_guess_nonzero;
+    ierr = KSPGetInitialGuessNonzero(petsc_ksp, &initial_guess_nonzero);
+    IBTK_CHKERRQ(ierr);
+    setInitialGuessNonzero(initial_guess_nonzero == PETSC_TRUE);
+
+    // Use the block solver options set for the KSP object.
+    const char* options_prefix;
+    ierr = KSPGetOptionsPrefix(petsc_ksp, &options_prefix);
+    IBTK_CHKERRQ(ierr);
+    PetscInt max_num_basis_vecs;
+    PetscBool flg;
+    ierr = PetscOptionsGetInt(NULL, options_prefix, "-ksp_block_max_basis_vectors", &max_num_basis_vecs, &flg);
+    IBTK_CHKERRQ(ierr);
+    if (flg) setMaxNumBasisVectors(max_num_basis_vecs);
+    ierr = PetscOptionsHasName(NULL, options_prefix, "-ksp_block_check_separate_solves", &flg);
+    IBTK_CHKERRQ(ierr);
+    if (flg) setCheckSeparateSolves(true);
+    return;
+} // setFromKSP
+
+void
+PETScBlockKrylovSolver::setOperator(Mat petsc_mat)
+{
+    d_petsc_mat = petsc_mat;
+    return;
+} // setOperator
+
+void
+PETScBlockKrylovSolver::setPreconditioner(PC petsc_pc)
+{
+    d_petsc_pc = petsc_pc;
+    return;
+} // setPreconditioner
+
+void
+PETScBlockKrylovSolver::setTolerances(const double rel_residual_tol,
+                                      const double abs_residual_tol,
+                                      const int max_iterations)
+{
+    d_rel_residual_tol = rel_residual_tol;
+    d_abs_residual_tol = abs_residual_tol;
+    d_max_iterations = max_iterations;
+    return;
+} // setTolerances
+
+void
+PETScBlockKrylovSolver::setRestart(const int restart)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(restart > 0);
+#endif
+    d_restart = restart;
+    return;
+} // setRestart
+
+void
+PETScBlockKrylovSolver::setMaxNumBasisVectors(const int max_num_basis_vecs)
+{
+    d_max_num_basis_vecs = max_num_basis_vecs;
+    return;
+} // setMaxNumBasisVectors
+
+void
+PETScBlockKrylovSolver::setCheckSeparateSolves(const bool check_separate_solves)
+{
+    d_check_separate_solves = check_separate_solves;
+    return;
+} // setCheckSeparateSolves
+
+void
+PETScBlockKrylovSolver::setInitialGuessNonzero(const bool initial_guess_nonzero)
+{
+    d_initial_guess_nonzero = initial_guess_nonzero;
+    return;
+} // setInitialGuessNonzero
+
+void
+PETScBlockKrylovSolver::setLoggingEnabled(const bool enable_logging)
+{
+    d_enable_logging = enable_logging;
+    return;
+} // setLoggingEnabled
+
+bool
+PETScBlockKrylovSolver::solveSystems(const std::vector<Vec>& x, const std::vector<Vec>& b)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_petsc_mat);
+    TBOX_ASSERT(x.size() == b.size());
+#endif
+    d_current_iterations = 0;
+    d_current_applications = 0;
+    d_current_residual_norm = 0.0;
+    const int num_systems = static_cast<int>(b.size());
+    if (num_systems == 0) return true;
+
+    IBTK_TIMER_START(t_solve_systems);
+
+    int ierr;
+
+    // Keep the initial guesses when the results are to be checked against
+    // separate solves.
+    const bool check_separate_solves = d_check_separate_solves && num_systems > 1;
+    std::vector<Vec> x0;
+    if (check_separate_solves && d_initial_guess_nonzero)
+    {
+        x0.resize(num_systems);
+        for (int i = 0; i < num_systems; ++i)
+        {
+            ierr = VecDuplicate(x[i], &x0[i]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecCopy(x[i], x0[i]);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Determine the convergence tolerance of each system.
+    std::vector<double> tol(num_systems);
+    for (int i = 0; i < num_systems; ++i)
+    {
+        PetscReal b_norm;
+        ierr = VecNorm(b[i], NORM_2, &b_norm);
+        IBTK_CHKERRQ(ierr);
+        tol[i] = std::max(d_rel_residual_tol * b_norm, d_abs_residual_tol);
+        if (!d_initial_guess_nonzero)
+        {
+            ierr = VecSet(x[i], 0.0);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Allocate the residuals and the block Krylov basis.  Each restart cycle
+    // takes up to d_restart block steps, and each block step adds one basis
+    // vector per system in the block (two if a preconditioner is used).  The
+    // number of steps is reduced when necessary to respect the limit on the
+    // total number of basis vectors.
+    int num_steps = d_restart;
+    if (d_max_num_basis_vecs > 0)
+    {
+        const int num_vecs_per_step = (d_petsc_pc ? 2 : 1) * num_systems;
+        num_steps = std::max(1, std::min(d_restart, (d_max_num_basis_vecs - num_systems) / num_vecs_per_step));
+        if (d_enable_logging && num_steps < d_restart)
+        {
+            plog << d_object_name << "::solveSystems(): restart length reduced from " << d_restart << " to "
+                 << num_steps << " block steps to limit the number of basis vectors to "
+                 << d_max_num_basis_vecs << "\n";
+        }
+    }
+    const int max_num_cols = num_steps * num_systems;
+    const int max_num_basis_vecs = max_num_cols + num_systems;
+    Vec *R, *V, *Z = NULL;
+    ierr = VecDuplicateVecs(b[0], num_systems, &R);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicateVecs(b[0], max_num_basis_vecs, &V);
+    IBTK_CHKERRQ(ierr);
+    if (d_petsc_pc)
+    {
+        ierr = VecDuplicateVecs(b[0], max_num_cols, &Z);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Compute the initial residuals.
+    for (int i = 0; i < num_systems; ++i)
+    {
+        if (d_initial_guess_nonzero)
+        {
+            ierr = MatMult(d_petsc_mat, x[i], R[i]);
+            IBTK_CHKERRQ(ierr);
+            ++d_current_applications;
+            ierr = VecAYPX(R[i], -1.0, b[i]);
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            ierr = VecCopy(b[i], R[i]);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    bool converged = false;
+    std::vector<PetscReal> r_norm(num_systems);
+    std::vector<PetscScalar> h, coefs(max_num_basis_vecs);
+    while (true)
+    {
+        // Determine the systems that have not yet converged.
+        std::vector<int> active;
+        d_current_residual_norm = 0.0;
+        for (int i = 0; i < num_systems; ++i)
+        {
+            ierr = VecNorm(R[i], NORM_2, &r_norm[i]);
+            IBTK_CHKERRQ(ierr);
+            d_current_residual_norm = std::max(d_current_residual_norm, static_cast<double>(r_norm[i]));
+            if (r_norm[i] > tol[i]) active.push_back(i);
+        }
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::solveSystems(): iteration " << d_current_iterations << ": "
+                 << active.size() << " of " << num_systems
+                 << " systems unconverged, max residual norm = " << d_current_residual_norm << "\n";
+        }
+        if (active.empty())
+        {
+            converged = true;
+            break;
+        }
+        if (d_current_iterations >= d_max_iterations) break;
+
+        // Orthonormalize the residuals of the active systems, R = V S.  A
+        // residual that is (nearly) linearly dependent on the preceding ones
+        // does not contribute a new basis vector; it is represented exactly by
+        // its projection coefficients in S.
+        const int num_active = static_cast<int>(active.size());
+        Eigen::MatrixXd S = Eigen::MatrixXd::Zero(num_active, num_active);
+        int p = 0;
+        for (int k = 0; k < num_active; ++k)
+        {
+            const int i = active[k];
+            ierr = VecCopy(R[i], V[p]);
+            IBTK_CHKERRQ(ierr);
+            orthogonalize(V[p], p, V, h);
+            for (int l = 0; l < p; ++l) S(l, k) = h[l];
+            PetscReal v_norm;
+            ierr = VecNorm(V[p], NORM_2, &v_norm);
+            IBTK_CHKERRQ(ierr);
+            if (v_norm <= BREAKDOWN_TOL * r_norm[i]) continue;
+            ierr = VecScale(V[p], 1.0 / v_norm);
+            IBTK_CHKERRQ(ierr);
+            S(p, k) = v_norm;
+            ++p;
+        }
+
+        // Build the block Krylov basis by block Arnoldi, one column at a time,
+        // so that A Z(:,c) = V(:,0:c+p) H(0:c+p,c).  After each block step,
+        // solve the least-squares problem min ||[S; 0] - H Y|| to estimate the
+        // residuals of the systems in the block.
+        Eigen::MatrixXd H = Eigen::MatrixXd::Zero((num_steps + 1) * p, num_steps * p);
+        Eigen::MatrixXd E = Eigen::MatrixXd::Zero((num_steps + 1) * p, num_active);
+        E.topRows(p) = S.topRows(p);
+        Eigen::MatrixXd Y, E_res;
+        int num_basis_vecs = p, num_cols = 0;
+        bool breakdown = false;
+        for (int step = 0; step < num_steps && !breakdown && d_current_iterations < d_max_iterations; ++step)
+        {
+            for (int j = 0; j < p && !breakdown; ++j)
+            {
+                const int c = num_cols++;
+                Vec z = V[c];
+                if (d_petsc_pc)
+                {
+                    ierr = PCApply(d_petsc_pc, V[c], Z[c]);
+                    IBTK_CHKERRQ(ierr);
+                    z = Z[c];
+                }
+                Vec w = V[num_basis_vecs];
+                ierr = MatMult(d_petsc_mat, z, w);
+                IBTK_CHKERRQ(ierr);
+                ++d_current_applications;
+                PetscReal w_norm_init, w_norm;
+                ierr = VecNorm(w, NORM_2, &w_norm_init);
+                IBTK_CHKERRQ(ierr);
+                orthogonalize(w, num_basis_vecs, V, h);
+                for (int l = 0; l < num_basis_vecs; ++l) H(l, c) = h[l];
+                ierr = VecNorm(w, NORM_2, &w_norm);
+                IBTK_CHKERRQ(ierr);
+                if (w_norm <= BREAKDOWN_TOL * w_norm_init)
+                {
+                    breakdown = true;
+                }
+                else
+                {
+                    H(num_basis_vecs, c) = w_norm;
+                    ierr = VecScale(w, 1.0 / w_norm);
+                    IBTK_CHKERRQ(ierr);
+                    ++num_basis_vecs;
+                }
+            }
+            ++d_current_iterations;
+
+            const Eigen::MatrixXd G = H.topLeftCorner(num_basis_vecs, num_cols);
+            Y = G.colPivHouseholderQr().solve(E.topRows(num_basis_vecs));
+            E_res = E.topRows(num_basis_vecs) - G * Y;
+            bool block_converged = true;
+            for (int k = 0; k < num_active && block_converged; ++k)
+            {
+                block_converged = E_res.col(k).norm() <= tol[active[k]];
+            }
+            if (block_converged) break;
+        }
+
+        // Update the solutions of the active systems and recompute their
+        // residuals.  The residuals implied by the least-squares solution
+        // drift from the true residuals as rounding errors accumulate (and
+        // whenever the preconditioner is not a fixed linear operator), so they
+        // are not used to restart the iteration or to declare convergence.
+        Vec* const Z_vecs = d_petsc_pc ? Z : V;
+        for (int k = 0; k < num_active; ++k)
+        {
+            const int i = active[k];
+            for (int l = 0; l < num_cols; ++l) coefs[l] = Y(l, k);
+            ierr = VecMAXPY(x[i], num_cols, &coefs[0], Z_vecs);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatMult(d_petsc_mat, x[i], R[i]);
+            IBTK_CHKERRQ(ierr);
+            ++d_current_applications;
+            ierr = VecAYPX(R[i], -1.0, b[i]);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Deallocate temporary data.
+    ierr = VecDestroyVecs(num_systems, &R);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroyVecs(max_num_basis_vecs, &V);
+    IBTK_CHKERRQ(ierr);
+    if (Z)
+    {
+        ierr = VecDestroyVecs(max_num_cols, &Z);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    IBTK_TIMER_STOP(t_solve_systems);
+
+    // Compare the results to those obtained by solving each system separately.
+    if (check_separate_solves)
+    {
+        checkSeparateSolves(x, x0, b, converged);
+        for (unsigned int i = 0; i < x0.size(); ++i)
+        {
+            ierr = VecDestroy(&x0[i]);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    return converged;
+} // solveSystems
+
+int
+PETScBlockKrylovSolver::getNumIterations() const
+{
+    return d_current_iterations;
+} // getNumIterations
+
+int
+PETScBlockKrylovSolver::getNumOperatorApplications() const
+{
+    return d_current_applications;
+} // getNumOperatorApplications
+
+double
+PETScBlockKrylovSolver::getResidualNorm() const
+{
+    return d_current_residual_norm;
+} // getResidualNorm
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PETScBlockKrylovSolver::orthogonalize(Vec w, const int n, Vec* V, std::vector<PetscScalar>& h)
+{
+    h.assign(n, 0.0);
+    if (n == 0) return;
+    int ierr;
+    std::vector<PetscScalar> dh(n);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        ierr = VecMDot(w, n, V, &dh[0]);
+        IBTK_CHKERRQ(ierr);
+        for (int l = 0; l < n; ++l)
+        {
+            h[l] += dh[l];
+            dh[l] = -dh[l];
+        }
+        ierr = VecMAXPY(w, n, &dh[0], V);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // orthogonalize
+
+void
+PETScBlockKrylovSolver::checkSeparateSolves(const std::vector<Vec>& x,
+                                            const std::vector<Vec>& x0,
+                                            const std::vector<Vec>& b,
+                                            const bool block_converged)
+{
+    int ierr;
+
+    // Solve the systems one at a time with otherwise identical settings.
+    PETScBlockKrylovSolver separate_solver(d_object_name + "::separate_solver");
+    separate_solver.setOperator(d_petsc_mat);
+    separate_solver.setPreconditioner(d_petsc_pc);
+    separate_solver.setTolerances(d_rel_residual_tol, d_abs_residual_tol, d_max_iterations);
+    separate_solver.setRestart(d_restart);
+    separate_solver.setMaxNumBasisVectors(d_max_num_basis_vecs);
+    separate_solver.setInitialGuessNonzero(d_initial_guess_nonzero);
+
+    const int num_systems = static_cast<int>(b.size());
+    bool separate_converged = true;
+    int num_applications = 0;
+    double max_rel_diff = 0.0;
+    Vec x_separate;
+    ierr = VecDuplicate(b[0], &x_separate);
+    IBTK_CHKERRQ(ierr);
+    for (int i = 0; i < num_systems; ++i)
+    {
+        if (d_initial_guess_nonzero)
+        {
+            ierr = VecCopy(x0[i], x_separate);
+            IBTK_CHKERRQ(ierr);
+        }
+        const std::vector<Vec> x_i(1, x_separate), b_i(1, b[i]);
+        separate_converged = separate_solver.solveSystems(x_i, b_i) && separate_converged;
+        num_applications += separate_solver.getNumOperatorApplications();
+
+        // Compute ||x_i - x_i^separate|| / ||x_i^separate||.
+        PetscReal x_norm, diff_norm;
+        ierr = VecNorm(x_separate, NORM_2, &x_norm);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAYPX(x_separate, -1.0, x[i]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecNorm(x_separate, NORM_2, &diff_norm);
+        IBTK_CHKERRQ(ierr);
+        const double rel_diff = x_norm > 0.0 ? diff_norm / x_norm : diff_norm;
+        max_rel_diff = std::max(max_rel_diff, rel_diff);
+        plog << d_object_name << "::checkSeparateSolves(): system " << i
+             << ": relative difference from separate solve = " << rel_diff << "\n";
+    }
+    ierr = VecDestroy(&x_separate);
+    IBTK_CHKERRQ(ierr);
+
+    plog << d_object_name << "::checkSeparateSolves(): " << num_systems << " right-hand sides required "
+         << d_current_applications << " operator applications in the block solve and " << num_applications
+         << " in separate solves\n";
+    if (!block_converged && separate_converged)
+    {
+        TBOX_WARNING(d_object_name << "::checkSeparateSolves():\n"
+                                   << "  block solve did not converge, but the separate solves did" << std::endl);
+    }
+    if (max_rel_diff > std::sqrt(d_rel_residual_tol))
+    {
+        TBOX_WARNING(d_object_name << "::checkSeparateSolves():\n"
+                                   << "  block and separate solutions differ by a relative amount of "
+                                   << max_rel_diff
+                                   << std::endl);
+    }
+    return;
+} // checkSeparateSolves
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -53,6 +53,7 @@
 #include "ibtk/PETScMatLOWrapper.h"
 #include "ibtk/PETScPCLSWrapper.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "ibtk/PhaseProfiler.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
@@ -233,6 +234,7 @@ bool
 PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
 {
     IBTK_TIMER_START(t_solve_system);
+    IBTK_PROFILER_SCOPE("PETScKrylovLinearSolver::solveSystem");
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_A);
@@ -265,6 +267,7 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     // Get iterations count and residual norm.
     ierr = KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
     IBTK_CHKERRQ(ierr);
+    IBTK_PROFILER_COUNT(KRYLOV_ITERATIONS_COUNTER, d_current_iterations);
     ierr = KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
     IBTK_CHKERRQ(ierr);
     d_A->setHomogeneousBc(d_homogeneous_bc);
@@ -34,6 +34,7 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <ostream>
 #include <string>
@@ -41,7 +42,9 @@
 #include <vector>
 
 #include "ArrayData.h"
+#include "ArrayDataBasicOps.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
@@ -56,6 +59,9 @@
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
+#include "RefineAlgorithm.h"
+#include "RefineOperator.h"
+#include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
 #include "SideDataFactory.h"
@@ -70,6 +76,7 @@
 #include "ibtk/CartSideDoubleQuadraticCFInterpolation.h"
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
@@ -96,14 +103,20 @@
 #if (NDIM == 2)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask2d, GSSMOOTHMASK2D)
+#define GS_SMOOTH_BOX_FC IBTK_FC_FUNC(gssmoothbox2d, GSSMOOTHBOX2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
+#define CHEBY_DIRECTION_FC IBTK_FC_FUNC(chebydirection2d, CHEBYDIRECTION2D)
+#define CHEBY_DIRECTION_MASK_FC IBTK_FC_FUNC(chebydirectionmask2d, CHEBYDIRECTIONMASK2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask3d, GSSMOOTHMASK3D)
+#define GS_SMOOTH_BOX_FC IBTK_FC_FUNC(gssmoothbox3d, GSSMOOTHBOX3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
+#define CHEBY_DIRECTION_FC IBTK_FC_FUNC(chebydirection3d, CHEBYDIRECTION3D)
+#define CHEBY_DIRECTION_MASK_FC IBTK_FC_FUNC(chebydirectionmask3d, CHEBYDIRECTIONMASK3D)
 #endif
 
 // Function interfaces
@@ -177,6 +190,88 @@ void RB_GS_SMOOTH_MASK_FC(double* U,
 #endif
                           const double* dx,
                           const int& red_or_black);
+
+void GS_SMOOTH_BOX_FC(double* U,
+                      const int& U_gcw,
+                      const double& alpha,
+                      const double& beta,
+                      const double* F,
+                      const int& F_gcw,
+                      const int& ilower0,
+                      const int& iupper0,
+                      const int& ilower1,
+                      const int& iupper1,
+#if (NDIM == 3)
+                      const int& ilower2,
+                      const int& iupper2,
+#endif
+                      const int& blower0,
+                      const int& bupper0,
+                      const int& blower1,
+                      const int& bupper1,
+#if (NDIM == 3)
+                      const int& blower2,
+                      const int& bupper2,
+#endif
+                      const double* dx);
+
+void CHEBY_DIRECTION_FC(double* D,
+                        const int& D_gcw,
+                        const double* U,
+                        const int& U_gcw,
+                        const double& alpha,
+                        const double& beta,
+                        const double* F,
+                        const int& F_gcw,
+                        const int& ilower0,
+                        const int& iupper0,
+                        const int& ilower1,
+                        const int& iupper1,
+#if (NDIM == 3)
+                        const int& ilower2,
+                        const int& iupper2,
+#endif
+                        const int& blower0,
+                        const int& bupper0,
+                        const int& blower1,
+                        const int& bupper1,
+#if (NDIM == 3)
+                        const int& blower2,
+                        const int& bupper2,
+#endif
+                        const double* dx,
+                        const double& omega_d,
+                        const double& omega_r);
+
+void CHEBY_DIRECTION_MASK_FC(double* D,
+                             const int& D_gcw,
+                             const double* U,
+                             const int& U_gcw,
+                             const double& alpha,
+                             const double& beta,
+                             const double* F,
+                             const int& F_gcw,
+                             const int* mask,
+                             const int& mask_gcw,
+                             const int& ilower0,
+                             const int& iupper0,
+                             const int& ilower1,
+                             const int& iupper1,
+#if (NDIM == 3)
+                             const int& ilower2,
+                             const int& iupper2,
+#endif
+                             const int& blower0,
+                             const int& bupper0,
+                             const int& blower1,
+                             const int& bupper1,
+#if (NDIM == 3)
+                             const int& blower2,
+                             const int& bupper2,
+#endif
+                             const double* dx,
+                             const double& omega_d,
+                             const double& omega_r);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -198,6 +293,10 @@ static const int DEFAULT_DATA_DEPTH = 1;
 // Number of ghosts cells used for each variable quantity.
 static const int SIDEG = 1;
 
+// Default ratio of the lower and upper eigenvalue bounds targeted by the
+// Chebyshev smoother.
+static const double DEFAULT_CHEBYSHEV_EIG_RATIO = 0.1;
+
 // Types of refining and coarsening to perform prior to setting coarse-fine
 // boundary and physical boundary ghost cell values.
 static const std::string DATA_REFINE_TYPE = "NONE";
@@ -217,6 +316,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -225,8 +325,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -256,6 +357,19 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+inline bool
+use_smoother_scratch_data(SmootherType smoother_type, int sweeps_per_ghost_fill)
+{
+    if (smoother_type == CHEBYSHEV || (smoother_type == PATCH_GAUSS_SEIDEL && sweeps_per_ghost_fill > 1))
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+} // use_smoother_scratch_data
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -272,7 +386,20 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
       d_patch_bc_box_overlap(),
-      d_patch_neighbor_overlap()
+      d_patch_neighbor_overlap(),
+      d_sweeps_per_ghost_fill(1),
+      d_chebyshev_eig_ratio(DEFAULT_CHEBYSHEV_EIG_RATIO),
+      d_use_smoother_scratch_data(false),
+      d_chebyshev_eig_bounds(),
+      d_smoother_sol_idx(-1),
+      d_smoother_rhs_idx(-1),
+      d_smoother_dir_idx(-1),
+      d_patch_cf_bdry_boxes(),
+      d_patch_redundant_update_boxes(),
+      d_smoother_fill_algorithms(),
+      d_smoother_initial_fill_algorithms(),
+      d_smoother_fill_schedules(),
+      d_smoother_initial_fill_schedules()
 {
     // Set some default values.
     d_smoother_type = "PATCH_GAUSS_SEIDEL";
@@ -300,6 +427,10 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
             d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("sweeps_per_ghost_fill"))
+            d_sweeps_per_ghost_fill = input_db->getInteger("sweeps_per_ghost_fill");
+        if (input_db->keyExists("chebyshev_eig_ratio"))
+            d_chebyshev_eig_ratio = input_db->getDouble("chebyshev_eig_ratio");
         if (input_db->isDatabase("coarse_solver_db"))
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
@@ -324,6 +455,17 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
         }
     }
 
+    if (d_sweeps_per_ghost_fill < 1)
+    {
+        TBOX_ERROR(d_object_name << "::SCPoissonPointRelaxationFACOperator():\n"
+                                 << "  sweeps_per_ghost_fill must be positive" << std::endl);
+    }
+    if (d_chebyshev_eig_ratio <= 0.0 || d_chebyshev_eig_ratio >= 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::SCPoissonPointRelaxationFACOperator():\n"
+                                 << "  chebyshev_eig_ratio must be in the interval (0,1)" << std::endl);
+    }
+
     // Configure the coarse level solver.
     setCoarseSolverType(d_coarse_solver_type);
 
@@ -339,6 +481,27 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
     IntVector<NDIM> no_ghosts = 0;
     d_mask_idx = var_db->registerVariableAndContext(mask_var, d_context, no_ghosts);
 
+    // Construct variables to store the smoother scratch data.  These variables
+    // have enough ghost cells to perform d_sweeps_per_ghost_fill sweeps per
+    // ghost cell fill.
+    const IntVector<NDIM> smoother_ghosts = d_sweeps_per_ghost_fill;
+    const std::string smoother_var_names[3] = { object_name + "::smoother_sol",
+                                                object_name + "::smoother_rhs",
+                                                object_name + "::smoother_dir" };
+    int* const smoother_idxs[3] = { &d_smoother_sol_idx, &d_smoother_rhs_idx, &d_smoother_dir_idx };
+    for (int k = 0; k < 3; ++k)
+    {
+        Pointer<SideVariable<NDIM, double> > smoother_var =
+            new SideVariable<NDIM, double>(smoother_var_names[k], DEFAULT_DATA_DEPTH);
+        if (var_db->checkVariableExists(smoother_var->getName()))
+        {
+            smoother_var = var_db->getVariable(smoother_var->getName());
+            *smoother_idxs[k] = var_db->mapVariableAndContextToIndex(smoother_var, d_context);
+            var_db->removePatchDataIndex(*smoother_idxs[k]);
+        }
+        *smoother_idxs[k] = var_db->registerVariableAndContext(smoother_var, d_context, smoother_ghosts);
+    }
+
     // Setup Timers.
     IBTK_DO_ONCE(t_smooth_error =
                      TimerManager::getManager()->getTimer("IBTK::SCPoissonPointRelaxationFACOperator::smoothError()");
@@ -408,6 +571,15 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // The Chebyshev smoother and communication-avoiding Gauss-Seidel sweeps
+    // operate on separate scratch data with deeper ghost cell regions.
+    if (use_smoother_scratch_data(smoother_type, d_sweeps_per_ghost_fill))
+    {
+        smoothErrorDeepGhost(error, residual, level_num, num_sweeps, smoother_type == CHEBYSHEV);
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -781,6 +953,22 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
 
+    // Determine whether the smoother scratch data are needed.
+    const SmootherType smoother_type = get_smoother_type(d_smoother_type);
+    const SmootherType coarse_smoother_type = get_smoother_type(d_coarse_solver_type);
+    d_use_smoother_scratch_data = use_smoother_scratch_data(smoother_type, d_sweeps_per_ghost_fill) ||
+                                  use_smoother_scratch_data(coarse_smoother_type, d_sweeps_per_ghost_fill);
+    if (d_use_smoother_scratch_data)
+    {
+        const int smoother_idxs[3] = { d_smoother_sol_idx, d_smoother_rhs_idx, d_smoother_dir_idx };
+        for (int k = 0; k < 3; ++k)
+        {
+            Pointer<SideDataFactory<NDIM, double> > smoother_pdat_fac =
+                var_db->getPatchDescriptor()->getPatchDataFactory(smoother_idxs[k]);
+            smoother_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+        }
+    }
+
     // Setup cached BC data.
     d_bc_helper = new StaggeredPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
@@ -849,6 +1037,12 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         }
     }
 
+    // Setup data used by the Chebyshev and communication-avoiding smoothers.
+    if (d_use_smoother_scratch_data)
+    {
+        initializeSmootherScratchData(coarsest_reset_ln, finest_reset_ln);
+    }
+
     // Get overlap information for re-setting patch boundary conditions during
     // smoothing.
     d_patch_neighbor_overlap.resize(d_finest_ln + 1);
@@ -888,15 +1082,33 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
 } // initializeOperatorStateSpecialized
 
 void
-SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    if (d_use_smoother_scratch_data)
+    {
+        for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(d_smoother_sol_idx)) level->deallocatePatchData(d_smoother_sol_idx);
+            if (level->checkAllocated(d_smoother_rhs_idx)) level->deallocatePatchData(d_smoother_rhs_idx);
+            if (level->checkAllocated(d_smoother_dir_idx)) level->deallocatePatchData(d_smoother_dir_idx);
+        }
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_chebyshev_eig_bounds.clear();
+        d_patch_cf_bdry_boxes.clear();
+        d_patch_redundant_update_boxes.clear();
+        d_smoother_fill_algorithms.clear();
+        d_smoother_initial_fill_algorithms.clear();
+        d_smoother_fill_schedules.clear();
+        d_smoother_initial_fill_schedules.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
@@ -904,6 +1116,511 @@ SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+SCPoissonPointRelaxationFACOperator::initializeSmootherScratchData(const int coarsest_reset_ln,
+                                                                   const int finest_reset_ln)
+{
+    const int sweeps_per_ghost_fill = d_sweeps_per_ghost_fill;
+
+    // Allocate the smoother scratch data.
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_smoother_sol_idx)) level->allocatePatchData(d_smoother_sol_idx);
+        if (!level->checkAllocated(d_smoother_rhs_idx)) level->allocatePatchData(d_smoother_rhs_idx);
+        if (!level->checkAllocated(d_smoother_dir_idx)) level->allocatePatchData(d_smoother_dir_idx);
+    }
+
+    // Estimate the extremal eigenvalues of the Jacobi preconditioned operator
+    // on each level.  Because the operator has constant coefficients, the
+    // Gershgorin disc of each row is the same, and it yields the upper bound.
+    // The lower bound is chosen so that the smoother targets the upper part of
+    // the spectrum.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const double alpha = d_poisson_spec.getDConstant();
+    const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    d_chebyshev_eig_bounds.resize(d_finest_ln + 1);
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& ratio = level->getRatio();
+        double dx_inv_sq_sum = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double dx = dx_coarsest[d] / static_cast<double>(ratio(d));
+            dx_inv_sq_sum += 1.0 / (dx * dx);
+        }
+        const double diag = beta - 2.0 * alpha * dx_inv_sq_sum;
+        const double off_diag = 2.0 * std::abs(alpha) * dx_inv_sq_sum;
+        if (diag == 0.0)
+        {
+            TBOX_ERROR(d_object_name << "::initializeOperatorState():\n"
+                                     << "  operator has a zero diagonal on level number " << ln << std::endl);
+        }
+        const double radius = off_diag / std::abs(diag);
+        const double eig_max = 1.0 + radius;
+        const double eig_min = std::max(1.0 - radius, d_chebyshev_eig_ratio * eig_max);
+        d_chebyshev_eig_bounds[ln] = std::make_pair(eig_min, eig_max);
+    }
+
+    // Determine the coarse-fine interface ghost sides of each patch and the
+    // ghost sides that can be updated redundantly between ghost cell fills.
+    d_patch_cf_bdry_boxes.resize(d_finest_ln + 1);
+    d_patch_redundant_update_boxes.resize(d_finest_ln + 1);
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& level_boxes = level->getBoxes();
+        const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
+        boost::array<BoxList<NDIM>, NDIM> level_side_boxes, domain_side_boxes, domain_bdry_side_boxes;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
+            {
+                level_side_boxes[axis].appendItem(SideGeometry<NDIM>::toSideBox(level_boxes[k], axis));
+            }
+            for (int k = 0; k < domain_boxes.getNumberOfBoxes(); ++k)
+            {
+                const Box<NDIM> domain_side_box = SideGeometry<NDIM>::toSideBox(domain_boxes[k], axis);
+                Box<NDIM> domain_interior_side_box = domain_side_box;
+                domain_interior_side_box.lower()(axis) += 1;
+                domain_interior_side_box.upper()(axis) -= 1;
+                BoxList<NDIM> bdry_side_boxes(domain_side_box);
+                bdry_side_boxes.removeIntersections(domain_interior_side_box);
+                domain_side_boxes[axis].appendItem(domain_side_box);
+                domain_bdry_side_boxes[axis].unionBoxes(bdry_side_boxes);
+            }
+        }
+        const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+        d_patch_cf_bdry_boxes[ln].resize(num_local_patches);
+        d_patch_redundant_update_boxes[ln].resize(num_local_patches);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            d_patch_redundant_update_boxes[ln][patch_counter].resize(sweeps_per_ghost_fill);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                const Box<NDIM> smoother_ghost_box = Box<NDIM>::grow(side_box, sweeps_per_ghost_fill);
+                BoxList<NDIM> nbr_level_side_boxes(level_side_boxes[axis]);
+                nbr_level_side_boxes.intersectBoxes(smoother_ghost_box);
+
+                // Coarse-fine interface ghost sides are the ghost sides that lie
+                // within the physical domain but that are not covered by the
+                // level.
+                BoxList<NDIM>& cf_bdry_boxes = d_patch_cf_bdry_boxes[ln][patch_counter][axis];
+                cf_bdry_boxes = BoxList<NDIM>(Box<NDIM>::grow(side_box, 1));
+                cf_bdry_boxes.removeIntersections(side_box);
+                cf_bdry_boxes.intersectBoxes(domain_side_boxes[axis]);
+                cf_bdry_boxes.removeIntersections(nbr_level_side_boxes);
+
+                // Only the first layer of coarse-fine interface ghost sides is
+                // filled, so sides that are adjacent to deeper coarse-fine
+                // interface ghost sides cannot be updated.  Sides along the
+                // physical boundary are not updated redundantly because they may
+                // be subject to Dirichlet boundary conditions.
+                BoxList<NDIM> invalid_boxes(smoother_ghost_box);
+                invalid_boxes.intersectBoxes(domain_side_boxes[axis]);
+                invalid_boxes.removeIntersections(nbr_level_side_boxes);
+                invalid_boxes.removeIntersections(Box<NDIM>::grow(side_box, 1));
+                invalid_boxes.grow(IntVector<NDIM>(1));
+                invalid_boxes.unionBoxes(domain_bdry_side_boxes[axis]);
+
+                for (int m = 1; m < sweeps_per_ghost_fill; ++m)
+                {
+                    BoxList<NDIM>& update_boxes = d_patch_redundant_update_boxes[ln][patch_counter][m][axis];
+                    update_boxes = nbr_level_side_boxes;
+                    update_boxes.intersectBoxes(Box<NDIM>::grow(side_box, m));
+                    update_boxes.removeIntersections(side_box);
+                    update_boxes.removeIntersections(invalid_boxes);
+                    update_boxes.coalesceBoxes();
+                }
+            }
+        }
+    }
+
+    // Setup the communication schedules used to fill the ghost cells of the
+    // smoother scratch data.  The right-hand side data are only communicated
+    // by the initial fill, and the Chebyshev search direction is only
+    // communicated on levels that use the Chebyshev smoother.
+    d_smoother_fill_algorithms.resize(d_finest_ln + 1);
+    d_smoother_initial_fill_algorithms.resize(d_finest_ln + 1);
+    d_smoother_fill_schedules.resize(d_finest_ln + 1);
+    d_smoother_initial_fill_schedules.resize(d_finest_ln + 1);
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const std::string& smoother_type_string = (ln == d_coarsest_ln ? d_coarse_solver_type : d_smoother_type);
+        const bool fill_dir = get_smoother_type(smoother_type_string) == CHEBYSHEV;
+        d_smoother_fill_algorithms[ln] = new RefineAlgorithm<NDIM>();
+        d_smoother_initial_fill_algorithms[ln] = new RefineAlgorithm<NDIM>();
+        d_smoother_fill_algorithms[ln]->registerRefine(
+            d_smoother_sol_idx, d_smoother_sol_idx, d_smoother_sol_idx, Pointer<RefineOperator<NDIM> >());
+        d_smoother_initial_fill_algorithms[ln]->registerRefine(
+            d_smoother_sol_idx, d_smoother_sol_idx, d_smoother_sol_idx, Pointer<RefineOperator<NDIM> >());
+        d_smoother_initial_fill_algorithms[ln]->registerRefine(
+            d_smoother_rhs_idx, d_smoother_rhs_idx, d_smoother_rhs_idx, Pointer<RefineOperator<NDIM> >());
+        if (fill_dir)
+        {
+            d_smoother_fill_algorithms[ln]->registerRefine(
+                d_smoother_dir_idx, d_smoother_dir_idx, d_smoother_dir_idx, Pointer<RefineOperator<NDIM> >());
+            d_smoother_initial_fill_algorithms[ln]->registerRefine(
+                d_smoother_dir_idx, d_smoother_dir_idx, d_smoother_dir_idx, Pointer<RefineOperator<NDIM> >());
+        }
+        d_smoother_fill_schedules[ln] = d_smoother_fill_algorithms[ln]->createSchedule(level, d_bc_op.getPointer());
+        d_smoother_initial_fill_schedules[ln] =
+            d_smoother_initial_fill_algorithms[ln]->createSchedule(level, d_bc_op.getPointer());
+    }
+    return;
+} // initializeSmootherScratchData
+
+void
+SCPoissonPointRelaxationFACOperator::smoothErrorDeepGhost(SAMRAIVectorReal<NDIM, double>& error,
+                                                          const SAMRAIVectorReal<NDIM, double>& residual,
+                                                          const int level_num,
+                                                          const int num_sweeps,
+                                                          const bool use_chebyshev)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_use_smoother_scratch_data);
+#endif
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    const int error_idx = error.getComponentDescriptorIndex(0);
+    const int scratch_idx = d_scratch_idx;
+    const int sol_idx = d_smoother_sol_idx;
+    const int rhs_idx = d_smoother_rhs_idx;
+    const int dir_idx = d_smoother_dir_idx;
+    const bool has_cf_bdry = level_num > d_coarsest_ln;
+    const IntVector<NDIM> ratio = has_cf_bdry ? level->getRatioToCoarserLevel() : IntVector<NDIM>(1);
+
+    // Copy the error and residual into the smoother scratch data, and cache
+    // coarse-fine interface ghost cell values in the "scratch" data.
+    int patch_counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<SideData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+        Pointer<SideData<NDIM, double> > sol_data = patch->getPatchData(sol_idx);
+        Pointer<SideData<NDIM, double> > rhs_data = patch->getPatchData(rhs_idx);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
+        TBOX_ASSERT(error_data->getDepth() == sol_data->getDepth());
+        TBOX_ASSERT(residual_data->getDepth() == rhs_data->getDepth());
+#endif
+        const Box<NDIM>& patch_box = patch->getBox();
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            if (has_cf_bdry)
+            {
+                Pointer<SideData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                scratch_data->getArrayData(axis).copy(error_data->getArrayData(axis),
+                                                      d_patch_bc_box_overlap[level_num][patch_counter][axis],
+                                                      IntVector<NDIM>(0));
+            }
+            sol_data->getArrayData(axis).copy(
+                error_data->getArrayData(axis), error_data->getArrayData(axis).getBox(), IntVector<NDIM>(0));
+            rhs_data->getArrayData(axis).copy(residual_data->getArrayData(axis),
+                                              SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                              IntVector<NDIM>(0));
+        }
+    }
+
+    // Setup the boundary operators to act on the smoother scratch data.
+    d_cf_bdry_op->setPatchDataIndex(sol_idx);
+    d_bc_op->setPatchDataIndex(sol_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(sol_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+
+    // Setup the Chebyshev recurrence.
+    const double eig_min = d_chebyshev_eig_bounds[level_num].first;
+    const double eig_max = d_chebyshev_eig_bounds[level_num].second;
+    const double theta = 0.5 * (eig_max + eig_min);
+    const double delta = 0.5 * (eig_max - eig_min);
+    const double sigma = theta / delta;
+    double rho = 1.0 / sigma;
+
+    // Smooth the error by the specified number of sweeps.  The first sweep uses
+    // the ghost cell values provided with the error.  Subsequent sweeps are
+    // performed in groups of up to d_sweeps_per_ghost_fill sweeps per ghost
+    // cell fill.  Within each group, the ghost sides that are needed by later
+    // sweeps of the group are updated redundantly.
+    const double& alpha = d_poisson_spec.getDConstant();
+    const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    ArrayDataBasicOps<NDIM, double> array_ops;
+    bool initial_fill = true;
+    int isweep = 0;
+    while (isweep < num_sweeps)
+    {
+        int num_group_sweeps = 1;
+        if (isweep > 0)
+        {
+            fillSmootherGhostCells(level_num, initial_fill);
+            initial_fill = false;
+            num_group_sweeps = std::min(d_sweeps_per_ghost_fill, num_sweeps - isweep);
+        }
+        for (int group_sweep = 0; group_sweep < num_group_sweeps; ++group_sweep, ++isweep)
+        {
+            // Determine the coefficients of the Chebyshev recurrence.
+            double omega_d = 0.0;
+            double omega_r = 1.0 / theta;
+            if (isweep > 0)
+            {
+                const double rho_new = 1.0 / (2.0 * sigma - rho);
+                omega_d = rho_new * rho;
+                omega_r = 2.0 * rho_new / delta;
+                rho = rho_new;
+            }
+
+            // The redundantly updated region shrinks by one side per sweep.
+            const int num_remaining_sweeps = num_group_sweeps - group_sweep - 1;
+            patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > sol_data = patch->getPatchData(sol_idx);
+                Pointer<SideData<NDIM, double> > rhs_data = patch->getPatchData(rhs_idx);
+                Pointer<SideData<NDIM, double> > dir_data = patch->getPatchData(dir_idx);
+                Pointer<SideData<NDIM, int> > mask_data = patch->getPatchData(d_mask_idx);
+                const Box<NDIM>& patch_box = patch->getBox();
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const dx = pgeom->getDx();
+
+                // Reset the coarse-fine interface and physical boundary ghost
+                // cell values.  These operations do not require communication.
+                if (has_cf_bdry)
+                {
+                    Pointer<SideData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        sol_data->getArrayData(axis).copy(scratch_data->getArrayData(axis),
+                                                          d_patch_cf_bdry_boxes[level_num][patch_counter][axis],
+                                                          IntVector<NDIM>(0));
+                    }
+                    d_cf_bdry_op->computeNormalExtension(*patch, ratio, d_gcw);
+                }
+                if (group_sweep > 0)
+                {
+                    d_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, sol_data->getGhostCellWidth());
+                }
+
+                // Enforce any Dirichlet boundary conditions.
+                const bool patch_has_dirichlet_bdry = d_bc_helper->patchTouchesDirichletBoundary(patch);
+                if (patch_has_dirichlet_bdry)
+                {
+                    d_bc_helper->copyDataAtDirichletBoundaries(sol_data, rhs_data, patch);
+                }
+
+                const int U_ghosts = (sol_data->getGhostCellWidth()).max();
+                const int F_ghosts = (rhs_data->getGhostCellWidth()).max();
+                const int D_ghosts = (dir_data->getGhostCellWidth()).max();
+                const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                    const bool use_mask =
+                        patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis);
+
+                    // Determine the boxes to update.  Only the patch box may
+                    // contain Dirichlet boundary locations.
+                    BoxList<NDIM> update_boxes(side_patch_box);
+                    if (num_remaining_sweeps > 0)
+                    {
+                        update_boxes.unionBoxes(
+                            d_patch_redundant_update_boxes[level_num][patch_counter][num_remaining_sweeps][axis]);
+                    }
+
+                    // Smooth the error for each data depth.
+                    for (int depth = 0; depth < sol_data->getDepth(); ++depth)
+                    {
+                        double* const U = sol_data->getPointer(axis, depth);
+                        const double* const F = rhs_data->getPointer(axis, depth);
+                        double* const D = dir_data->getPointer(axis, depth);
+                        const int* const mask = mask_data->getPointer(axis, depth);
+                        for (BoxList<NDIM>::Iterator b(update_boxes); b; b++)
+                        {
+                            const Box<NDIM>& update_box = b();
+                            const bool mask_box = use_mask && update_box == side_patch_box;
+                            if (use_chebyshev && mask_box)
+                            {
+                                CHEBY_DIRECTION_MASK_FC(D,
+                                                        D_ghosts,
+                                                        U,
+                                                        U_ghosts,
+                                                        alpha,
+                                                        beta,
+                                                        F,
+                                                        F_ghosts,
+                                                        mask,
+                                                        mask_ghosts,
+                                                        side_patch_box.lower(0),
+                                                        side_patch_box.upper(0),
+                                                        side_patch_box.lower(1),
+                                                        side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                        side_patch_box.lower(2),
+                                                        side_patch_box.upper(2),
+#endif
+                                                        update_box.lower(0),
+                                                        update_box.upper(0),
+                                                        update_box.lower(1),
+                                                        update_box.upper(1),
+#if (NDIM == 3)
+                                                        update_box.lower(2),
+                                                        update_box.upper(2),
+#endif
+                                                        dx,
+                                                        omega_d,
+                                                        omega_r);
+                            }
+                            else if (use_chebyshev)
+                            {
+                                CHEBY_DIRECTION_FC(D,
+                                                   D_ghosts,
+                                                   U,
+                                                   U_ghosts,
+                                                   alpha,
+                                                   beta,
+                                                   F,
+                                                   F_ghosts,
+                                                   side_patch_box.lower(0),
+                                                   side_patch_box.upper(0),
+                                                   side_patch_box.lower(1),
+                                                   side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                   side_patch_box.lower(2),
+                                                   side_patch_box.upper(2),
+#endif
+                                                   update_box.lower(0),
+                                                   update_box.upper(0),
+                                                   update_box.lower(1),
+                                                   update_box.upper(1),
+#if (NDIM == 3)
+                                                   update_box.lower(2),
+                                                   update_box.upper(2),
+#endif
+                                                   dx,
+                                                   omega_d,
+                                                   omega_r);
+                            }
+                            else if (mask_box)
+                            {
+                                GS_SMOOTH_MASK_FC(U,
+                                                  U_ghosts,
+                                                  alpha,
+                                                  beta,
+                                                  F,
+                                                  F_ghosts,
+                                                  mask,
+                                                  mask_ghosts,
+                                                  side_patch_box.lower(0),
+                                                  side_patch_box.upper(0),
+                                                  side_patch_box.lower(1),
+                                                  side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                  side_patch_box.lower(2),
+                                                  side_patch_box.upper(2),
+#endif
+                                                  dx);
+                            }
+                            else
+                            {
+                                GS_SMOOTH_BOX_FC(U,
+                                                 U_ghosts,
+                                                 alpha,
+                                                 beta,
+                                                 F,
+                                                 F_ghosts,
+                                                 side_patch_box.lower(0),
+                                                 side_patch_box.upper(0),
+                                                 side_patch_box.lower(1),
+                                                 side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                 side_patch_box.lower(2),
+                                                 side_patch_box.upper(2),
+#endif
+                                                 update_box.lower(0),
+                                                 update_box.upper(0),
+                                                 update_box.lower(1),
+                                                 update_box.upper(1),
+#if (NDIM == 3)
+                                                 update_box.lower(2),
+                                                 update_box.upper(2),
+#endif
+                                                 dx);
+                            }
+                        }
+                    }
+
+                    // The Chebyshev update is applied only after the search
+                    // direction has been computed on all of the boxes.
+                    if (use_chebyshev)
+                    {
+                        for (BoxList<NDIM>::Iterator b(update_boxes); b; b++)
+                        {
+                            array_ops.add(sol_data->getArrayData(axis),
+                                          sol_data->getArrayData(axis),
+                                          dir_data->getArrayData(axis),
+                                          b());
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Copy the smoothed error out of the smoother scratch data.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<SideData<NDIM, double> > sol_data = patch->getPatchData(sol_idx);
+        const Box<NDIM>& patch_box = patch->getBox();
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            error_data->getArrayData(axis).copy(sol_data->getArrayData(axis),
+                                                SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                                IntVector<NDIM>(0));
+        }
+    }
+
+    for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+
+    // Synchronize data along patch boundaries.
+    xeqScheduleDataSynch(error_idx, level_num);
+    return;
+} // smoothErrorDeepGhost
+
+void
+SCPoissonPointRelaxationFACOperator::fillSmootherGhostCells(const int level_num, const bool initial_fill)
+{
+    if (initial_fill)
+    {
+        d_smoother_initial_fill_schedules[level_num]->fillData(d_solution_time);
+    }
+    else
+    {
+        d_smoother_fill_schedules[level_num]->fillData(d_solution_time);
+    }
+    return;
+} // fillSmootherGhostCells
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
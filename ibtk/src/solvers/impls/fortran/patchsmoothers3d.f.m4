@@ -337,3 +337,279 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
+c     beta U restricted to the index box [blower,bupper].
+c
+c     NOTE: The box [blower,bupper] may extend into the ghost cell region
+c     of the patch data, provided that the ghost cell width of U is large
+c     enough to contain the stencil of each updated degree of freedom.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine gssmoothbox3d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     blower0,bupper0,
+     &     blower1,bupper1,
+     &     blower2,bupper2,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER blower0,bupper0
+      INTEGER blower1,bupper1
+      INTEGER blower2,bupper2
+      INTEGER U_gcw,F_gcw
+
+      REAL alpha,beta
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &     ilower1-F_gcw:iupper1+F_gcw,
+     &     ilower2-F_gcw:iupper2+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &     ilower1-U_gcw:iupper1+U_gcw,
+     &     ilower2-U_gcw:iupper2+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    fac0,fac1,fac2,fac
+c
+c     Perform a single Gauss-Seidel sweep.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*beta)
+
+      do i2 = blower2,bupper2
+         do i1 = blower1,bupper1
+            do i0 = blower0,bupper0
+               U(i0,i1,i2) = fac*(
+     &              fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
+     &              fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
+     &              fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
+     &              F(i0,i1,i2))
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Update the Jacobi-preconditioned Chebyshev search direction
+c
+c        D := omega_d D + omega_r diag(A)^{-1} (F - A U)
+c
+c     for A U = alpha div grad U + beta U on the index box
+c     [blower,bupper].  When omega_d is zero, D is overwritten so that it
+c     need not be initialized.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine chebydirection3d(
+     &     D,D_gcw,
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     blower0,bupper0,
+     &     blower1,bupper1,
+     &     blower2,bupper2,
+     &     dx,
+     &     omega_d,omega_r)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER blower0,bupper0
+      INTEGER blower1,bupper1
+      INTEGER blower2,bupper2
+      INTEGER D_gcw,U_gcw,F_gcw
+
+      REAL alpha,beta
+      REAL omega_d,omega_r
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &     ilower1-U_gcw:iupper1+U_gcw,
+     &     ilower2-U_gcw:iupper2+U_gcw)
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &     ilower1-F_gcw:iupper1+F_gcw,
+     &     ilower2-F_gcw:iupper2+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL D(ilower0-D_gcw:iupper0+D_gcw,
+     &     ilower1-D_gcw:iupper1+D_gcw,
+     &     ilower2-D_gcw:iupper2+D_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    fac0,fac1,fac2,fac,r
+c
+c     Compute the scaled residual and update the search direction.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      fac = omega_r/(beta-2.d0*(fac0+fac1+fac2))
+
+      if (omega_d .eq. 0.d0) then
+         do i2 = blower2,bupper2
+            do i1 = blower1,bupper1
+               do i0 = blower0,bupper0
+                  r = F(i0,i1,i2) - beta*U(i0,i1,i2) -
+     &                 fac0*(U(i0-1,i1,i2)-2.d0*U(i0,i1,i2)+
+     &                       U(i0+1,i1,i2)) -
+     &                 fac1*(U(i0,i1-1,i2)-2.d0*U(i0,i1,i2)+
+     &                       U(i0,i1+1,i2)) -
+     &                 fac2*(U(i0,i1,i2-1)-2.d0*U(i0,i1,i2)+
+     &                       U(i0,i1,i2+1))
+                  D(i0,i1,i2) = fac*r
+               enddo
+            enddo
+         enddo
+      else
+         do i2 = blower2,bupper2
+            do i1 = blower1,bupper1
+               do i0 = blower0,bupper0
+                  r = F(i0,i1,i2) - beta*U(i0,i1,i2) -
+     &                 fac0*(U(i0-1,i1,i2)-2.d0*U(i0,i1,i2)+
+     &                       U(i0+1,i1,i2)) -
+     &                 fac1*(U(i0,i1-1,i2)-2.d0*U(i0,i1,i2)+
+     &                       U(i0,i1+1,i2)) -
+     &                 fac2*(U(i0,i1,i2-1)-2.d0*U(i0,i1,i2)+
+     &                       U(i0,i1,i2+1))
+                  D(i0,i1,i2) = omega_d*D(i0,i1,i2) + fac*r
+               enddo
+            enddo
+         enddo
+      endif
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Update the Jacobi-preconditioned Chebyshev search direction with
+c     masking of certain degrees of freedom.
+c
+c     NOTE: The search direction D is set to zero at masked degrees of
+c     freedom, so that the solution U is unmodified there.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine chebydirectionmask3d(
+     &     D,D_gcw,
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     mask,mask_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     blower0,bupper0,
+     &     blower1,bupper1,
+     &     blower2,bupper2,
+     &     dx,
+     &     omega_d,omega_r)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER blower0,bupper0
+      INTEGER blower1,bupper1
+      INTEGER blower2,bupper2
+      INTEGER D_gcw,U_gcw,F_gcw,mask_gcw
+
+      REAL alpha,beta
+      REAL omega_d,omega_r
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &     ilower1-U_gcw:iupper1+U_gcw,
+     &     ilower2-U_gcw:iupper2+U_gcw)
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &     ilower1-F_gcw:iupper1+F_gcw,
+     &     ilower2-F_gcw:iupper2+F_gcw)
+
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &     ilower1-mask_gcw:iupper1+mask_gcw,
+     &     ilower2-mask_gcw:iupper2+mask_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL D(ilower0-D_gcw:iupper0+D_gcw,
+     &     ilower1-D_gcw:iupper1+D_gcw,
+     &     ilower2-D_gcw:iupper2+D_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    fac0,fac1,fac2,fac,r
+c
+c     Compute the scaled residual and update the search direction.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      fac = omega_r/(beta-2.d0*(fac0+fac1+fac2))
+
+      do i2 = blower2,bupper2
+         do i1 = blower1,bupper1
+            do i0 = blower0,bupper0
+               if (mask(i0,i1,i2) .eq. 0) then
+                  r = F(i0,i1,i2) - beta*U(i0,i1,i2) -
+     &                 fac0*(U(i0-1,i1,i2)-2.d0*U(i0,i1,i2)+
+     &                       U(i0+1,i1,i2)) -
+     &                 fac1*(U(i0,i1-1,i2)-2.d0*U(i0,i1,i2)+
+     &                       U(i0,i1+1,i2)) -
+     &                 fac2*(U(i0,i1,i2-1)-2.d0*U(i0,i1,i2)+
+     &                       U(i0,i1,i2+1))
+                  if (omega_d .eq. 0.d0) then
+                     D(i0,i1,i2) = fac*r
+                  else
+                     D(i0,i1,i2) = omega_d*D(i0,i1,i2) + fac*r
+                  endif
+               else
+                  D(i0,i1,i2) = 0.d0
+               endif
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
@@ -42,6 +42,7 @@
 #include "VisItDataWriter.h"
 #include "ibtk/AppInitializer.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/PhaseProfiler.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -78,7 +79,9 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
       d_restart_dump_dirname(""),
       d_data_dump_interval(0),
       d_data_dump_dirname(""),
-      d_timer_dump_interval(0)
+      d_timer_dump_interval(0),
+      d_profiler_dump_interval(0),
+      d_profiler_dump_dirname("")
 {
     if (argc == 1)
     {
@@ -249,6 +252,15 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         if (d_viz_writers[i] == "Silo")
         {
             d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+            if (main_db->keyExists("silo_number_procs_per_file"))
+                d_silo_data_writer->setNumberOfProcessorsPerFile(main_db->getInteger("silo_number_procs_per_file"));
+            if (main_db->keyExists("silo_async_output") && main_db->getBool("silo_async_output"))
+            {
+                int max_buffer_mb = 256;
+                if (main_db->keyExists("silo_async_output_max_buffer_mb"))
+                    max_buffer_mb = main_db->getInteger("silo_async_output_max_buffer_mb");
+                d_silo_data_writer->setAsynchronousOutput(true, static_cast<size_t>(max_buffer_mb) * 1024 * 1024);
+            }
         }
 
         if (d_viz_writers[i] == "ExodusII")
@@ -392,6 +404,33 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
         TimerManager::createManager(timer_manager_db);
     }
+
+    // Configure profiler options.
+    if (main_db->keyExists("profiler_dump_interval"))
+    {
+        d_profiler_dump_interval = main_db->getInteger("profiler_dump_interval");
+    }
+
+    if (d_profiler_dump_interval > 0)
+    {
+        if (main_db->keyExists("profiler_dump_dirname"))
+        {
+            d_profiler_dump_dirname = main_db->getString("profiler_dump_dirname");
+        }
+        if (d_profiler_dump_dirname.empty())
+        {
+            pout << "WARNING: AppInitializer::AppInitializer(): profiler_dump_interval > 0, but "
+                    "`profiler_dump_dirname' is not specified in input file\n"
+                 << "using default value `.'\n";
+            d_profiler_dump_dirname = ".";
+        }
+        Pointer<Database> profiler_db = new NullDatabase();
+        if (d_input_db->isDatabase("PhaseProfiler"))
+        {
+            profiler_db = d_input_db->getDatabase("PhaseProfiler");
+        }
+        PhaseProfiler::getProfiler()->enable(profiler_db);
+    }
     return;
 } // AppInitializer
 
@@ -563,6 +602,24 @@ AppInitializer::getTimerDumpInterval() const
     return d_timer_dump_interval;
 } // getTimerDumpInterval
 
+bool
+AppInitializer::dumpProfilerData() const
+{
+    return d_profiler_dump_interval > 0;
+} // dumpProfilerData
+
+int
+AppInitializer::getProfilerDumpInterval() const
+{
+    return d_profiler_dump_interval;
+} // getProfilerDumpInterval
+
+std::string
+AppInitializer::getProfilerDumpDirectory() const
+{
+    return d_profiler_dump_dirname;
+} // getProfilerDumpDirectory
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -0,0 +1,313 @@
+// Filename: BoundingBoxTree.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "IBTK_config.h"
+#include "ibtk/BoundingBoxTree.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Maximum number of boxes stored in a leaf node.
+static const int MAX_LEAF_SIZE = 8;
+
+// Orders box indices by the centroid of the boxes along a coordinate axis.
+class CentroidComparator
+{
+public:
+    CentroidComparator(const std::vector<std::pair<Point, Point> >& bboxes, const unsigned int axis)
+        : d_bboxes(bboxes), d_axis(axis)
+    {
+        return;
+    } // CentroidComparator
+
+    bool operator()(const unsigned int a, const unsigned int b) const
+    {
+        return (d_bboxes[a].first[d_axis] + d_bboxes[a].second[d_axis]) <
+               (d_bboxes[b].first[d_axis] + d_bboxes[b].second[d_axis]);
+    } // operator()
+
+private:
+    const std::vector<std::pair<Point, Point> >& d_bboxes;
+    const unsigned int d_axis;
+};
+
+// Determines whether the box [lower,upper] intersects the closed region
+// [x_lower,x_upper].
+inline bool
+intersects(const double* const lower, const double* const upper, const Point& x_lower, const Point& x_upper)
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (lower[d] > x_upper[d] || upper[d] < x_lower[d]) return false;
+    }
+    return true;
+} // intersects
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+BoundingBoxTree::BoundingBoxTree()
+    : d_nodes(), d_box_ids(), d_sorted_box_ids(), d_sorted_box_bounds(), d_build_extent(0.0)
+{
+    // intentionally blank
+    return;
+} // BoundingBoxTree
+
+BoundingBoxTree::~BoundingBoxTree()
+{
+    // intentionally blank
+    return;
+} // ~BoundingBoxTree
+
+void
+BoundingBoxTree::build(const std::vector<std::pair<Point, Point> >& bboxes, const std::vector<unsigned int>& box_ids)
+{
+    clear();
+    if (box_ids.empty()) return;
+    d_box_ids = box_ids;
+    d_sorted_box_ids = box_ids;
+    d_nodes.reserve(2 * (box_ids.size() / MAX_LEAF_SIZE + 1));
+    buildSubtree(bboxes, 0, static_cast<int>(d_sorted_box_ids.size()));
+    storeBoxBounds(bboxes);
+    d_build_extent = computeTotalExtent();
+    return;
+} // build
+
+double
+BoundingBoxTree::refit(const std::vector<std::pair<Point, Point> >& bboxes)
+{
+    if (d_nodes.empty()) return 1.0;
+    storeBoxBounds(bboxes);
+
+    // Children are always stored after their parents, so the nodes may be
+    // updated in reverse order.
+    for (int k = static_cast<int>(d_nodes.size()) - 1; k >= 0; --k)
+    {
+        Node& node = d_nodes[k];
+        if (node.left < 0)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                node.lower[d] = std::numeric_limits<double>::max();
+                node.upper[d] = -std::numeric_limits<double>::max();
+            }
+            for (int i = node.begin; i < node.end; ++i)
+            {
+                const double* const box_lower = &d_sorted_box_bounds[2 * NDIM * i];
+                const double* const box_upper = box_lower + NDIM;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    node.lower[d] = std::min(node.lower[d], box_lower[d]);
+                    node.upper[d] = std::max(node.upper[d], box_upper[d]);
+                }
+            }
+        }
+        else
+        {
+            const Node& left = d_nodes[node.left];
+            const Node& right = d_nodes[node.right];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                node.lower[d] = std::min(left.lower[d], right.lower[d]);
+                node.upper[d] = std::max(left.upper[d], right.upper[d]);
+            }
+        }
+    }
+    const double extent = computeTotalExtent();
+    return d_build_extent > 0.0 ? extent / d_build_extent : 1.0;
+} // refit
+
+void
+BoundingBoxTree::clear()
+{
+    d_nodes.clear();
+    d_box_ids.clear();
+    d_sorted_box_ids.clear();
+    d_sorted_box_bounds.clear();
+    d_build_extent = 0.0;
+    return;
+} // clear
+
+bool
+BoundingBoxTree::empty() const
+{
+    return d_nodes.empty();
+} // empty
+
+const std::vector<unsigned int>&
+BoundingBoxTree::getBoxIDs() const
+{
+    return d_box_ids;
+} // getBoxIDs
+
+void
+BoundingBoxTree::collectIntersectingBoxes(std::vector<unsigned int>& box_ids,
+                                          const Point& x_lower,
+                                          const Point& x_upper) const
+{
+    if (d_nodes.empty()) return;
+    std::vector<int> stack(1, 0);
+    while (!stack.empty())
+    {
+        const Node& node = d_nodes[stack.back()];
+        stack.pop_back();
+        if (!intersects(node.lower, node.upper, x_lower, x_upper)) continue;
+        if (node.left < 0)
+        {
+            for (int i = node.begin; i < node.end; ++i)
+            {
+                const double* const box_lower = &d_sorted_box_bounds[2 * NDIM * i];
+                const double* const box_upper = box_lower + NDIM;
+                if (intersects(box_lower, box_upper, x_lower, x_upper)) box_ids.push_back(d_sorted_box_ids[i]);
+            }
+        }
+        else
+        {
+            stack.push_back(node.right);
+            stack.push_back(node.left);
+        }
+    }
+    return;
+} // collectIntersectingBoxes
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+int
+BoundingBoxTree::buildSubtree(const std::vector<std::pair<Point, Point> >& bboxes, const int begin, const int end)
+{
+    const int node_idx = static_cast<int>(d_nodes.size());
+    d_nodes.push_back(Node());
+    Node node;
+    node.begin = begin;
+    node.end = end;
+    node.left = -1;
+    node.right = -1;
+
+    // Compute the bounds of the boxes and of their centroids.
+    double centroid_lower[NDIM], centroid_upper[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        node.lower[d] = std::numeric_limits<double>::max();
+        node.upper[d] = -std::numeric_limits<double>::max();
+        centroid_lower[d] = std::numeric_limits<double>::max();
+        centroid_upper[d] = -std::numeric_limits<double>::max();
+    }
+    for (int i = begin; i < end; ++i)
+    {
+        const std::pair<Point, Point>& bbox = bboxes[d_sorted_box_ids[i]];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            node.lower[d] = std::min(node.lower[d], bbox.first[d]);
+            node.upper[d] = std::max(node.upper[d], bbox.second[d]);
+            const double centroid = 0.5 * (bbox.first[d] + bbox.second[d]);
+            centroid_lower[d] = std::min(centroid_lower[d], centroid);
+            centroid_upper[d] = std::max(centroid_upper[d], centroid);
+        }
+    }
+
+    // Split the boxes at the median centroid along the axis of largest
+    // centroid extent.
+    if (end - begin > MAX_LEAF_SIZE)
+    {
+        unsigned int axis = 0;
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            if (centroid_upper[d] - centroid_lower[d] > centroid_upper[axis] - centroid_lower[axis]) axis = d;
+        }
+        const int mid = begin + (end - begin) / 2;
+        std::nth_element(d_sorted_box_ids.begin() + begin,
+                         d_sorted_box_ids.begin() + mid,
+                         d_sorted_box_ids.begin() + end,
+                         CentroidComparator(bboxes, axis));
+        node.left = buildSubtree(bboxes, begin, mid);
+        node.right = buildSubtree(bboxes, mid, end);
+    }
+    d_nodes[node_idx] = node;
+    return node_idx;
+} // buildSubtree
+
+void
+BoundingBoxTree::storeBoxBounds(const std::vector<std::pair<Point, Point> >& bboxes)
+{
+    d_sorted_box_bounds.resize(2 * NDIM * d_sorted_box_ids.size());
+    for (unsigned int i = 0; i < d_sorted_box_ids.size(); ++i)
+    {
+        const std::pair<Point, Point>& bbox = bboxes[d_sorted_box_ids[i]];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_sorted_box_bounds[2 * NDIM * i + d] = bbox.first[d];
+            d_sorted_box_bounds[2 * NDIM * i + NDIM + d] = bbox.second[d];
+        }
+    }
+    return;
+} // storeBoxBounds
+
+double
+BoundingBoxTree::computeTotalExtent() const
+{
+    // The extents of the nodes are normalized by the extent of the root node,
+    // so that the measure is invariant under uniform scaling of the boxes.
+    double extent = 0.0, root_extent = 0.0;
+    for (std::vector<Node>::const_iterator it = d_nodes.begin(); it != d_nodes.end(); ++it)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            extent += it->upper[d] - it->lower[d];
+        }
+    }
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        root_extent += d_nodes[0].upper[d] - d_nodes[0].lower[d];
+    }
+    return root_extent > 0.0 ? extent / root_extent : 0.0;
+} // computeTotalExtent
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
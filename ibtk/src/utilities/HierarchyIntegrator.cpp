@@ -77,7 +77,9 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PhaseProfiler.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -288,6 +290,8 @@ HierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hie
 void
 HierarchyIntegrator::advanceHierarchy(double dt)
 {
+    IBTK_PROFILER_SCOPE("HierarchyIntegrator::advanceHierarchy");
+
     const double dt_min = getMinimumTimeStepSize();
     const double dt_max = getMaximumTimeStepSize();
     if (dt < dt_min || dt > dt_max)
@@ -328,6 +332,7 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
+        IBTK_PROFILER_SCOPE("regridHierarchy");
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
         d_regridding_hierarchy = true;
@@ -339,11 +344,15 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // Determine the number of cycles and the time step size.
     d_current_num_cycles = getNumberOfCycles();
     d_current_dt = new_time - current_time;
+    IBTK_PROFILER_COUNT(CELLS_COUNTER, WorkloadCostModel::computeNumberOfLocalCells(d_hierarchy));
 
     // Execute the preprocessing method of the parent integrator, and
     // recursively execute all preprocessing callbacks registered with the
     // parent and child integrators.
-    preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    {
+        IBTK_PROFILER_SCOPE("preprocessIntegrateHierarchy");
+        preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    }
 
     // Perform one or more cycles.  In each cycle, execute the integration
     // method of the parent integrator, and recursively execute all integration
@@ -357,6 +366,7 @@ HierarchyIntegrator::advanceHierarchy(double dt)
                 plog << d_object_name << "::advanceHierarchy(): executing cycle " << cycle_num + 1 << " of "
                      << d_current_num_cycles << "\n";
         }
+        IBTK_PROFILER_SCOPE("integrateHierarchy");
         integrateHierarchy(current_time, new_time, cycle_num);
     }
 
@@ -364,7 +374,10 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // recursively execute all postprocessing callbacks registered with the
     // parent and child integrators.
     static const bool skip_synchronize_new_state_data = true;
-    postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    {
+        IBTK_PROFILER_SCOPE("postprocessIntegrateHierarchy");
+        postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    }
 
     // Ensure that the current values of num_cycles, cycle_num, and dt are
     // reset.
@@ -382,7 +395,10 @@ HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Synchronize the updated data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): synchronizing updated data\n";
-    synchronizeHierarchyData(NEW_DATA);
+    {
+        IBTK_PROFILER_SCOPE("synchronizeHierarchyData");
+        synchronizeHierarchyData(NEW_DATA);
+    }
 
     // Reset all time dependent data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): resetting time dependent data\n";
@@ -0,0 +1,512 @@
+// Filename: PhaseProfiler.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "IBTK_config.h"
+#include "ibtk/PhaseProfiler.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The MPI process that writes the profile data.
+static const int PROFILER_MPI_ROOT = 0;
+
+// The number of values stored for each scope: the number of calls, the total
+// time, and the counters.
+static const int NUM_SCOPE_VALUES = 2 + PhaseProfiler::NUM_COUNTERS;
+
+// The names of the counters in the output files.
+static const char* const COUNTER_NAMES[PhaseProfiler::NUM_COUNTERS] = { "bytes",
+                                                                        "markers",
+                                                                        "cells",
+                                                                        "krylov_iterations" };
+
+inline std::string
+json_escape(const std::string& str)
+{
+    std::string ret_val;
+    for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+    {
+        if (*it == '"' || *it == '\\') ret_val.push_back('\\');
+        ret_val.push_back(*it);
+    }
+    return ret_val;
+} // json_escape
+
+inline std::string
+make_file_name(const std::string& dirname, const std::string& prefix, const int timestep_num)
+{
+    std::ostringstream file_name;
+    file_name << dirname << "/" << prefix << "." << std::setw(6) << std::setfill('0') << timestep_num << ".json";
+    return file_name.str();
+} // make_file_name
+}
+
+PhaseProfiler* PhaseProfiler::s_profiler_instance = NULL;
+bool PhaseProfiler::s_registered_callback = false;
+unsigned char PhaseProfiler::s_shutdown_priority = 200;
+bool PhaseProfiler::s_enabled = false;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PhaseProfiler*
+PhaseProfiler::getProfiler()
+{
+    if (!s_profiler_instance)
+    {
+        s_profiler_instance = new PhaseProfiler();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeProfiler, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_profiler_instance;
+} // getProfiler
+
+void
+PhaseProfiler::freeProfiler()
+{
+    s_enabled = false;
+    delete s_profiler_instance;
+    s_profiler_instance = NULL;
+    return;
+} // freeProfiler
+
+void
+PhaseProfiler::enable(Pointer<Database> input_db)
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_trace")) d_enable_trace = input_db->getBool("enable_trace");
+        if (input_db->keyExists("max_trace_events")) d_max_trace_events = input_db->getInteger("max_trace_events");
+    }
+    if (d_max_trace_events < 0)
+    {
+        TBOX_ERROR("PhaseProfiler::enable():\n"
+                   << "  max_trace_events must be nonnegative.\n");
+    }
+    SAMRAI_MPI::barrier();
+    d_start_time = MPI_Wtime();
+    s_enabled = true;
+    return;
+} // enable
+
+void
+PhaseProfiler::disable()
+{
+    s_enabled = false;
+    return;
+} // disable
+
+void
+PhaseProfiler::startScope(const char* name)
+{
+    int child = -1;
+    const std::vector<int>& children = d_nodes[d_current_node].children;
+    for (std::vector<int>::const_iterator it = children.begin(); it != children.end(); ++it)
+    {
+        if (d_nodes[*it].name == name)
+        {
+            child = *it;
+            break;
+        }
+    }
+    if (child < 0)
+    {
+        child = static_cast<int>(d_nodes.size());
+        ScopeNode node;
+        node.name = name;
+        node.parent = d_current_node;
+        node.num_calls = 0.0;
+        node.total_time = 0.0;
+        node.start_time = 0.0;
+        std::fill(node.counters, node.counters + NUM_COUNTERS, 0.0);
+        d_nodes.push_back(node);
+        d_nodes[d_current_node].children.push_back(child);
+    }
+    d_current_node = child;
+    d_nodes[child].start_time = MPI_Wtime();
+    return;
+} // startScope
+
+void
+PhaseProfiler::stopScope()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_current_node > 0);
+#endif
+    ScopeNode& node = d_nodes[d_current_node];
+    const double duration = MPI_Wtime() - node.start_time;
+    node.num_calls += 1.0;
+    node.total_time += duration;
+    if (d_enable_trace)
+    {
+        if (static_cast<int>(d_trace_events.size()) < 3 * d_max_trace_events)
+        {
+            d_trace_events.push_back(static_cast<double>(d_current_node));
+            d_trace_events.push_back(node.start_time - d_start_time);
+            d_trace_events.push_back(duration);
+        }
+        else
+        {
+            ++d_num_dropped_trace_events;
+        }
+    }
+    d_current_node = node.parent;
+    return;
+} // stopScope
+
+void
+PhaseProfiler::addToCounter(const Counter counter, const double value)
+{
+    d_nodes[d_current_node].counters[counter] += value;
+    return;
+} // addToCounter
+
+void
+PhaseProfiler::reset()
+{
+    for (std::vector<ScopeNode>::iterator it = d_nodes.begin(); it != d_nodes.end(); ++it)
+    {
+        it->num_calls = 0.0;
+        it->total_time = 0.0;
+        std::fill(it->counters, it->counters + NUM_COUNTERS, 0.0);
+    }
+    d_trace_events.clear();
+    d_num_dropped_trace_events = 0;
+    return;
+} // reset
+
+void
+PhaseProfiler::writeData(const std::string& dirname, const int timestep_num)
+{
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int mpi_nodes = SAMRAI_MPI::getNodes();
+    const double elapsed_time = SAMRAI_MPI::maxReduction(MPI_Wtime() - d_start_time);
+    const int num_dropped_trace_events = SAMRAI_MPI::sumReduction(d_num_dropped_trace_events);
+
+    // Pack the local scope tree.  Node 0 is the root of the tree and is not
+    // communicated.
+    const int num_local_nodes = static_cast<int>(d_nodes.size());
+    std::vector<int> local_int_data;
+    std::vector<char> local_char_data;
+    std::vector<double> local_double_data;
+    for (int k = 1; k < num_local_nodes; ++k)
+    {
+        const ScopeNode& node = d_nodes[k];
+        local_int_data.push_back(node.parent);
+        local_char_data.insert(local_char_data.end(), node.name.begin(), node.name.end());
+        local_char_data.push_back('\0');
+        local_double_data.push_back(node.num_calls);
+        local_double_data.push_back(node.total_time);
+        local_double_data.insert(local_double_data.end(), node.counters, node.counters + NUM_COUNTERS);
+    }
+    if (!d_enable_trace) d_trace_events.clear();
+    local_double_data.insert(local_double_data.end(), d_trace_events.begin(), d_trace_events.end());
+
+    // Gather the data on the root MPI process.
+    int local_data_sizes[3] = { static_cast<int>(local_int_data.size()),
+                                static_cast<int>(local_char_data.size()),
+                                static_cast<int>(local_double_data.size()) };
+    std::vector<int> data_sizes(mpi_rank == PROFILER_MPI_ROOT ? 3 * mpi_nodes : 3);
+    MPI_Gather(local_data_sizes, 3, MPI_INT, &data_sizes[0], 3, MPI_INT, PROFILER_MPI_ROOT, SAMRAI_MPI::commWorld);
+
+    std::vector<int> int_data_sizes(mpi_nodes, 0), int_data_offsets(mpi_nodes + 1, 0);
+    std::vector<int> char_data_sizes(mpi_nodes, 0), char_data_offsets(mpi_nodes + 1, 0);
+    std::vector<int> double_data_sizes(mpi_nodes, 0), double_data_offsets(mpi_nodes + 1, 0);
+    if (mpi_rank == PROFILER_MPI_ROOT)
+    {
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            int_data_sizes[proc] = data_sizes[3 * proc];
+            int_data_offsets[proc + 1] = int_data_offsets[proc] + int_data_sizes[proc];
+            char_data_sizes[proc] = data_sizes[3 * proc + 1];
+            char_data_offsets[proc + 1] = char_data_offsets[proc] + char_data_sizes[proc];
+            double_data_sizes[proc] = data_sizes[3 * proc + 2];
+            double_data_offsets[proc + 1] = double_data_offsets[proc] + double_data_sizes[proc];
+        }
+    }
+    std::vector<int> int_data(std::max(int_data_offsets[mpi_nodes], 1));
+    std::vector<char> char_data(std::max(char_data_offsets[mpi_nodes], 1));
+    std::vector<double> double_data(std::max(double_data_offsets[mpi_nodes], 1));
+    MPI_Gatherv(local_int_data.empty() ? NULL : &local_int_data[0],
+                local_data_sizes[0],
+                MPI_INT,
+                &int_data[0],
+                &int_data_sizes[0],
+                &int_data_offsets[0],
+                MPI_INT,
+                PROFILER_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    MPI_Gatherv(local_char_data.empty() ? NULL : &local_char_data[0],
+                local_data_sizes[1],
+                MPI_CHAR,
+                &char_data[0],
+                &char_data_sizes[0],
+                &char_data_offsets[0],
+                MPI_CHAR,
+                PROFILER_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    MPI_Gatherv(local_double_data.empty() ? NULL : &local_double_data[0],
+                local_data_sizes[2],
+                MPI_DOUBLE,
+                &double_data[0],
+                &double_data_sizes[0],
+                &double_data_offsets[0],
+                MPI_DOUBLE,
+                PROFILER_MPI_ROOT,
+                SAMRAI_MPI::commWorld);
+    d_trace_events.clear();
+    d_num_dropped_trace_events = 0;
+    if (mpi_rank != PROFILER_MPI_ROOT) return;
+
+    // Merge the scope trees of all processes.  Scopes are identified by their
+    // names and the scopes that contain them.
+    std::vector<std::string> names(1, "root");
+    std::vector<int> parents(1, -1);
+    std::vector<std::vector<int> > children(1);
+    std::vector<std::vector<double> > values(1, std::vector<double>(NUM_SCOPE_VALUES * mpi_nodes, 0.0));
+    std::vector<std::vector<int> > local_to_merged(mpi_nodes);
+    for (int proc = 0; proc < mpi_nodes; ++proc)
+    {
+        const int num_nodes = int_data_sizes[proc];
+        std::vector<int>& node_map = local_to_merged[proc];
+        node_map.resize(num_nodes + 1);
+        node_map[0] = 0;
+        const char* name = num_nodes > 0 ? &char_data[char_data_offsets[proc]] : NULL;
+        for (int k = 1; k <= num_nodes; ++k)
+        {
+            const int parent = node_map[int_data[int_data_offsets[proc] + k - 1]];
+            int merged = -1;
+            for (std::vector<int>::const_iterator it = children[parent].begin(); it != children[parent].end(); ++it)
+            {
+                if (names[*it] == name)
+                {
+                    merged = *it;
+                    break;
+                }
+            }
+            if (merged < 0)
+            {
+                merged = static_cast<int>(names.size());
+                names.push_back(name);
+                parents.push_back(parent);
+                children.push_back(std::vector<int>());
+                values.push_back(std::vector<double>(NUM_SCOPE_VALUES * mpi_nodes, 0.0));
+                children[parent].push_back(merged);
+            }
+            node_map[k] = merged;
+            name += std::string(name).size() + 1;
+            const double* const node_values = &double_data[double_data_offsets[proc] + NUM_SCOPE_VALUES * (k - 1)];
+            std::copy(node_values, node_values + NUM_SCOPE_VALUES, &values[merged][NUM_SCOPE_VALUES * proc]);
+        }
+    }
+
+    // Order the merged scopes depth first, and determine their paths.
+    std::vector<int> order, depths(names.size(), 0);
+    std::vector<std::string> paths(names.size());
+    std::vector<int> stack(children[0].rbegin(), children[0].rend());
+    while (!stack.empty())
+    {
+        const int k = stack.back();
+        stack.pop_back();
+        order.push_back(k);
+        depths[k] = parents[k] == 0 ? 0 : depths[parents[k]] + 1;
+        paths[k] = parents[k] == 0 ? names[k] : paths[parents[k]] + "/" + names[k];
+        stack.insert(stack.end(), children[k].rbegin(), children[k].rend());
+    }
+
+    // Write the profile data and a summary of the profile data.
+    Utilities::recursiveMkdir(dirname);
+    const std::string profile_file_name = make_file_name(dirname, "profile", timestep_num);
+    std::ofstream profile_stream(profile_file_name.c_str());
+    profile_stream << std::setprecision(8) << std::scientific;
+    profile_stream << "{\n";
+    profile_stream << "  \"timestep\": " << timestep_num << ",\n";
+    profile_stream << "  \"nprocs\": " << mpi_nodes << ",\n";
+    profile_stream << "  \"elapsed_time\": " << elapsed_time << ",\n";
+    profile_stream << "  \"scopes\": [";
+    std::ostringstream summary;
+    summary << std::setprecision(4) << std::scientific;
+    summary << std::left << std::setw(60) << "scope" << std::right << std::setw(10) << "calls" << std::setw(12)
+            << "min" << std::setw(12) << "mean" << std::setw(12) << "max" << std::setw(10) << "imbal"
+            << "\n";
+    for (unsigned int i = 0; i < order.size(); ++i)
+    {
+        const int k = order[i];
+        double calls_min = 0.0, calls_max = 0.0, time_min = 0.0, time_max = 0.0, time_sum = 0.0;
+        double counter_sum[NUM_COUNTERS], counter_max[NUM_COUNTERS];
+        std::fill(counter_sum, counter_sum + NUM_COUNTERS, 0.0);
+        std::fill(counter_max, counter_max + NUM_COUNTERS, 0.0);
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            const double* const v = &values[k][NUM_SCOPE_VALUES * proc];
+            calls_min = proc == 0 ? v[0] : std::min(calls_min, v[0]);
+            calls_max = proc == 0 ? v[0] : std::max(calls_max, v[0]);
+            time_min = proc == 0 ? v[1] : std::min(time_min, v[1]);
+            time_max = proc == 0 ? v[1] : std::max(time_max, v[1]);
+            time_sum += v[1];
+            for (int c = 0; c < NUM_COUNTERS; ++c)
+            {
+                counter_sum[c] += v[2 + c];
+                counter_max[c] = proc == 0 ? v[2 + c] : std::max(counter_max[c], v[2 + c]);
+            }
+        }
+        const double time_mean = time_sum / static_cast<double>(mpi_nodes);
+        const double imbalance = time_mean > 0.0 ? time_max / time_mean : 1.0;
+
+        profile_stream << (i == 0 ? "\n" : ",\n");
+        profile_stream << "    {\n";
+        profile_stream << "      \"name\": \"" << json_escape(names[k]) << "\",\n";
+        profile_stream << "      \"path\": \"" << json_escape(paths[k]) << "\",\n";
+        profile_stream << "      \"depth\": " << depths[k] << ",\n";
+        profile_stream << "      \"calls_min\": " << static_cast<long>(calls_min) << ",\n";
+        profile_stream << "      \"calls_max\": " << static_cast<long>(calls_max) << ",\n";
+        profile_stream << "      \"time_min\": " << time_min << ",\n";
+        profile_stream << "      \"time_mean\": " << time_mean << ",\n";
+        profile_stream << "      \"time_max\": " << time_max << ",\n";
+        profile_stream << "      \"imbalance\": " << imbalance;
+        for (int c = 0; c < NUM_COUNTERS; ++c)
+        {
+            if (counter_max[c] == 0.0) continue;
+            profile_stream << ",\n      \"" << COUNTER_NAMES[c] << "_total\": " << counter_sum[c];
+            profile_stream << ",\n      \"" << COUNTER_NAMES[c] << "_max\": " << counter_max[c];
+        }
+        profile_stream << "\n    }";
+
+        const std::string label = std::string(2 * depths[k], ' ') + names[k];
+        summary << std::left << std::setw(60) << label.substr(0, 59) << std::right << std::setw(10)
+                << static_cast<long>(calls_max) << std::setw(12) << time_min << std::setw(12) << time_mean
+                << std::setw(12) << time_max << std::setw(10) << std::fixed << std::setprecision(2) << imbalance
+                << std::scientific << std::setprecision(4) << "\n";
+    }
+    profile_stream << (order.empty() ? "]\n" : "\n  ]\n");
+    profile_stream << "}\n";
+    plog << "PhaseProfiler::writeData(): profile data after " << elapsed_time << " s on " << mpi_nodes
+         << " processes:\n"
+         << summary.str();
+    plog << "PhaseProfiler::writeData(): profile data written to " << profile_file_name << "\n";
+    if (!d_enable_trace) return;
+
+    // Write the recorded scope instances in the Chrome trace event format, in
+    // which times are specified in microseconds.
+    const std::string trace_file_name = make_file_name(dirname, "trace", timestep_num);
+    std::ofstream trace_stream(trace_file_name.c_str());
+    trace_stream << std::fixed << std::setprecision(3);
+    trace_stream << "{\n";
+    trace_stream << "  \"displayTimeUnit\": \"ms\",\n";
+    trace_stream << "  \"traceEvents\": [";
+    bool first_event = true;
+    for (int proc = 0; proc < mpi_nodes; ++proc)
+    {
+        trace_stream << (first_event ? "\n" : ",\n");
+        trace_stream << "    {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << proc
+                     << ", \"tid\": 0, \"args\": {\"name\": \"rank " << proc << "\"}}";
+        first_event = false;
+        const int trace_offset = double_data_offsets[proc] + NUM_SCOPE_VALUES * int_data_sizes[proc];
+        for (int e = trace_offset; e < double_data_offsets[proc + 1]; e += 3)
+        {
+            const int k = local_to_merged[proc][static_cast<int>(double_data[e])];
+            trace_stream << ",\n    {\"name\": \"" << json_escape(names[k]) << "\", \"cat\": \""
+                         << json_escape(paths[k]) << "\", \"ph\": \"X\", \"pid\": " << proc
+                         << ", \"tid\": 0, \"ts\": " << 1.0e6 * double_data[e + 1]
+                         << ", \"dur\": " << 1.0e6 * double_data[e + 2] << "}";
+        }
+    }
+    trace_stream << "\n  ]\n";
+    trace_stream << "}\n";
+    plog << "PhaseProfiler::writeData(): trace data written to " << trace_file_name << "\n";
+    if (num_dropped_trace_events > 0)
+    {
+        plog << "PhaseProfiler::writeData(): " << num_dropped_trace_events
+             << " scope instances were not recorded; increase max_trace_events to record them\n";
+    }
+    return;
+} // writeData
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+PhaseProfiler::PhaseProfiler()
+    : d_nodes(1),
+      d_current_node(0),
+      d_enable_trace(false),
+      d_max_trace_events(100000),
+      d_trace_events(),
+      d_num_dropped_trace_events(0),
+      d_start_time(MPI_Wtime())
+{
+    ScopeNode& root = d_nodes[0];
+    root.name = "root";
+    root.parent = -1;
+    root.num_calls = 0.0;
+    root.total_time = 0.0;
+    root.start_time = 0.0;
+    std::fill(root.counters, root.counters + NUM_COUNTERS, 0.0);
+    return;
+} // PhaseProfiler
+
+PhaseProfiler::~PhaseProfiler()
+{
+    // intentionally blank
+    return;
+} // ~PhaseProfiler
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
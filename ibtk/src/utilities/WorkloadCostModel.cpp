@@ -0,0 +1,471 @@
+// Filename: WorkloadCostModel.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <string>
+
+#include "Box.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "IBTK_config.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ibtk/WorkloadCostModel.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Relative tolerance used to detect (nearly) collinear Lagrangian workload
+// measures, e.g., when only one type of Lagrangian structure is present.
+static const double COLLINEARITY_TOL = 1.0e-8;
+
+// Compute the relative residual of a least-squares fit from the sum of the
+// squares of the data and the residual sum of squares.
+inline double
+compute_relative_residual(const double btb, const double rss)
+{
+    return btb > 0.0 ? std::sqrt(std::max(rss, 0.0) / btb) : 0.0;
+} // compute_relative_residual
+
+// Names of the timed phases.
+static const char* const PHASE_NAMES[WorkloadCostModel::NUM_PHASES] = { "Eulerian",
+                                                                        "Lagrangian-Eulerian interaction",
+                                                                        "Lagrangian force" };
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+WorkloadCostModel::WorkloadCostModel(const std::string& object_name, Pointer<Database> input_db)
+    : d_object_name(object_name),
+      d_forgetting_factor(0.5),
+      d_min_workload_weight(0.0),
+      d_max_relative_fit_residual(0.25),
+      d_sync_start_time(-1.0),
+      d_sync_depth(0),
+      d_num_steps(0),
+      d_cell_AtA(0.0),
+      d_cell_Atb(0.0),
+      d_has_cost_coefs(false),
+      d_cell_cost(0.0),
+      d_node_cost(0.0),
+      d_qp_cost(0.0)
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("forgetting_factor")) d_forgetting_factor = input_db->getDouble("forgetting_factor");
+        if (input_db->keyExists("min_workload_weight"))
+            d_min_workload_weight = input_db->getDouble("min_workload_weight");
+        if (input_db->keyExists("max_relative_fit_residual"))
+            d_max_relative_fit_residual = input_db->getDouble("max_relative_fit_residual");
+    }
+    if (d_forgetting_factor < 0.0 || d_forgetting_factor > 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::WorkloadCostModel():\n"
+                                 << "  forgetting_factor must be between 0 and 1" << std::endl);
+    }
+    for (int k = 0; k < NUM_PHASES; ++k)
+    {
+        d_phase_start_time[k] = -1.0;
+        d_phase_time[k] = 0.0;
+        d_phase_sync_time[k] = 0.0;
+    }
+    d_lag_AtA[0][0] = d_lag_AtA[0][1] = d_lag_AtA[1][0] = d_lag_AtA[1][1] = 0.0;
+    d_lag_Atb[0] = d_lag_Atb[1] = 0.0;
+    return;
+} // WorkloadCostModel
+
+WorkloadCostModel::~WorkloadCostModel()
+{
+    // intentionally blank
+    return;
+} // ~WorkloadCostModel
+
+void
+WorkloadCostModel::startPhase(const Phase phase)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(phase >= 0 && phase < NUM_PHASES);
+    TBOX_ASSERT(d_phase_start_time[phase] < 0.0);
+    TBOX_ASSERT(d_sync_depth == 0);
+#endif
+    d_phase_start_time[phase] = MPI_Wtime();
+    return;
+} // startPhase
+
+void
+WorkloadCostModel::stopPhase(const Phase phase)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(phase >= 0 && phase < NUM_PHASES);
+    TBOX_ASSERT(d_phase_start_time[phase] >= 0.0);
+#endif
+    d_phase_time[phase] += MPI_Wtime() - d_phase_start_time[phase];
+    d_phase_start_time[phase] = -1.0;
+    return;
+} // stopPhase
+
+void
+WorkloadCostModel::startSynchronization()
+{
+    if (d_sync_depth++ == 0) d_sync_start_time = MPI_Wtime();
+    return;
+} // startSynchronization
+
+void
+WorkloadCostModel::stopSynchronization()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_sync_depth > 0);
+#endif
+    if (--d_sync_depth > 0) return;
+    const double sync_time = MPI_Wtime() - d_sync_start_time;
+    for (int k = 0; k < NUM_PHASES; ++k)
+    {
+        if (d_phase_start_time[k] >= 0.0) d_phase_sync_time[k] += sync_time;
+    }
+    d_sync_start_time = -1.0;
+    return;
+} // stopSynchronization
+
+void
+WorkloadCostModel::completeTimeStep()
+{
+    ++d_num_steps;
+    return;
+} // completeTimeStep
+
+void
+WorkloadCostModel::updateCostCoefficients(const double num_local_cells,
+                                          const double num_local_nodes,
+                                          const double num_local_quad_points)
+{
+    // Nothing is measured before the first time step, and the number of time
+    // steps is the same on each process.
+    if (d_num_steps == 0) return;
+
+    // Determine the average times per time step on this process, excluding the
+    // time spent in synchronizing operations.
+    double t_phase[NUM_PHASES], t_sync[NUM_PHASES];
+    for (int k = 0; k < NUM_PHASES; ++k)
+    {
+        t_sync[k] = d_phase_sync_time[k] / static_cast<double>(d_num_steps);
+        t_phase[k] = std::max(d_phase_time[k] / static_cast<double>(d_num_steps) - t_sync[k], 0.0);
+    }
+    const double t_eul = t_phase[EULERIAN_PHASE];
+    const double t_lag = t_phase[INTERACTION_PHASE] + t_phase[FORCE_PHASE];
+
+    // Sum the contributions of all processes to the normal equations for this
+    // interval, along with the sums of the squares of the measured times that
+    // are used to compute the residuals of the fits.
+    const double c = num_local_cells;
+    const double n = num_local_nodes;
+    const double q = num_local_quad_points;
+    static const int NUM_FIT_SUMS = 9;
+    static const int NUM_SUMS = NUM_FIT_SUMS + 2 * NUM_PHASES + 1;
+    double sums[NUM_SUMS];
+    sums[0] = c * c;
+    sums[1] = c * t_eul;
+    sums[2] = t_eul * t_eul;
+    sums[3] = n * n;
+    sums[4] = n * q;
+    sums[5] = q * q;
+    sums[6] = n * t_lag;
+    sums[7] = q * t_lag;
+    sums[8] = t_lag * t_lag;
+    for (int k = 0; k < NUM_PHASES; ++k)
+    {
+        sums[NUM_FIT_SUMS + k] = t_phase[k];
+        sums[NUM_FIT_SUMS + NUM_PHASES + k] = t_sync[k];
+    }
+    sums[NUM_FIT_SUMS + 2 * NUM_PHASES] = t_eul + t_lag;
+    SAMRAI_MPI::sumReduction(sums, NUM_SUMS);
+
+    // Time steps have been taken, but no phase has been timed on any process,
+    // e.g., because the hierarchy integrator does not bracket the phases of its
+    // time steps.  The static workload weights remain in use.
+    if (sums[NUM_FIT_SUMS + 2 * NUM_PHASES] <= 0.0)
+    {
+        TBOX_WARNING(d_object_name << "::updateCostCoefficients():\n"
+                                   << "  no phase times were recorded over the preceding " << d_num_steps
+                                   << " time steps; the measured workload costs are not used" << std::endl);
+        resetTimers();
+        return;
+    }
+    const double cell_AtA = sums[0], cell_Atb = sums[1], eul_btb = sums[2];
+    double lag_AtA[2][2], lag_Atb[2];
+    lag_AtA[0][0] = sums[3];
+    lag_AtA[0][1] = lag_AtA[1][0] = sums[4];
+    lag_AtA[1][1] = sums[5];
+    lag_Atb[0] = sums[6];
+    lag_Atb[1] = sums[7];
+    const double lag_btb = sums[8];
+
+    // Check that the times measured over this interval are explained by the
+    // local workload by fitting the costs to the samples of this interval
+    // alone.
+    double cell_cost, node_cost, qp_cost;
+    solveNormalEquations(cell_AtA, cell_Atb, lag_AtA, lag_Atb, cell_cost, node_cost, qp_cost);
+    const double eul_residual =
+        compute_relative_residual(eul_btb, eul_btb - 2.0 * cell_cost * cell_Atb + cell_cost * cell_cost * cell_AtA);
+    const double lag_residual = compute_relative_residual(
+        lag_btb,
+        lag_btb - 2.0 * (node_cost * lag_Atb[0] + qp_cost * lag_Atb[1]) + node_cost * node_cost * lag_AtA[0][0] +
+            2.0 * node_cost * qp_cost * lag_AtA[0][1] + qp_cost * qp_cost * lag_AtA[1][1]);
+    const bool accept_samples =
+        eul_residual <= d_max_relative_fit_residual && lag_residual <= d_max_relative_fit_residual;
+
+    // Accumulate the normal equations, discount the contributions of earlier
+    // intervals, and update the fitted costs.
+    if (accept_samples)
+    {
+        d_cell_AtA = d_forgetting_factor * d_cell_AtA + cell_AtA;
+        d_cell_Atb = d_forgetting_factor * d_cell_Atb + cell_Atb;
+        for (int i = 0; i < 2; ++i)
+        {
+            for (int j = 0; j < 2; ++j)
+            {
+                d_lag_AtA[i][j] = d_forgetting_factor * d_lag_AtA[i][j] + lag_AtA[i][j];
+            }
+            d_lag_Atb[i] = d_forgetting_factor * d_lag_Atb[i] + lag_Atb[i];
+        }
+        solveNormalEquations(d_cell_AtA, d_cell_Atb, d_lag_AtA, d_lag_Atb, d_cell_cost, d_node_cost, d_qp_cost);
+        d_has_cost_coefs = d_cell_cost > 0.0;
+    }
+
+    // Report the load imbalance achieved over the preceding time steps.
+    const int nodes = SAMRAI_MPI::getNodes();
+    const double t_max = SAMRAI_MPI::maxReduction(t_eul + t_lag);
+    const double t_avg = sums[NUM_FIT_SUMS + 2 * NUM_PHASES] / static_cast<double>(nodes);
+    plog << d_object_name << "::updateCostCoefficients(): measured over " << d_num_steps << " time steps:\n";
+    for (int k = 0; k < NUM_PHASES; ++k)
+    {
+        plog << "  average time per step in " << PHASE_NAMES[k]
+             << " phase = " << sums[NUM_FIT_SUMS + k] / static_cast<double>(nodes)
+             << " s (excluding " << sums[NUM_FIT_SUMS + NUM_PHASES + k] / static_cast<double>(nodes)
+             << " s in synchronizing operations)\n";
+    }
+    plog << "  achieved load imbalance (max/mean time per step) = " << (t_avg > 0.0 ? t_max / t_avg : 1.0) << "\n";
+    plog << "  relative residuals of the fits: Eulerian = " << eul_residual << ", Lagrangian = " << lag_residual
+         << "\n";
+    if (!accept_samples)
+    {
+        plog << "  the measured times are not explained by the local workload; discarding the samples from this "
+                "interval\n";
+    }
+    if (d_has_cost_coefs)
+    {
+        plog << "  fitted cost per cell = " << d_cell_cost << " s, per Lagrangian node = " << d_node_cost
+             << " s, per quadrature point = " << d_qp_cost << " s\n";
+        plog << "  workload weights: Lagrangian node = " << getLagrangianNodeWorkloadWeight()
+             << ", quadrature point = " << getQuadPointWorkloadWeight() << "\n";
+    }
+
+    resetTimers();
+    return;
+} // updateCostCoefficients
+
+bool
+WorkloadCostModel::hasCostCoefficients() const
+{
+    return d_has_cost_coefs;
+} // hasCostCoefficients
+
+double
+WorkloadCostModel::getCellCost() const
+{
+    return d_cell_cost;
+} // getCellCost
+
+double
+WorkloadCostModel::getLagrangianNodeCost() const
+{
+    return d_node_cost;
+} // getLagrangianNodeCost
+
+double
+WorkloadCostModel::getQuadPointCost() const
+{
+    return d_qp_cost;
+} // getQuadPointCost
+
+double
+WorkloadCostModel::getLagrangianNodeWorkloadWeight() const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_has_cost_coefs);
+#endif
+    return std::max(d_min_workload_weight, d_node_cost / d_cell_cost);
+} // getLagrangianNodeWorkloadWeight
+
+double
+WorkloadCostModel::getQuadPointWorkloadWeight() const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_has_cost_coefs);
+#endif
+    return std::max(d_min_workload_weight, d_qp_cost / d_cell_cost);
+} // getQuadPointWorkloadWeight
+
+double
+WorkloadCostModel::computeNumberOfLocalCells(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    double num_local_cells = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            num_local_cells += static_cast<double>(patch->getBox().size());
+        }
+    }
+    return num_local_cells;
+} // computeNumberOfLocalCells
+
+void
+WorkloadCostModel::reportPredictedImbalance(Pointer<PatchHierarchy<NDIM> > hierarchy, const int workload_idx) const
+{
+    double local_workload = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(workload_idx)) continue;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(workload_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                local_workload += (*workload_data)(CellIndex<NDIM>(b()));
+            }
+        }
+    }
+    const double max_workload = SAMRAI_MPI::maxReduction(local_workload);
+    const double avg_workload = SAMRAI_MPI::sumReduction(local_workload) / static_cast<double>(SAMRAI_MPI::getNodes());
+    plog << d_object_name << "::reportPredictedImbalance(): predicted load imbalance (max/mean workload) = "
+         << (avg_workload > 0.0 ? max_workload / avg_workload : 1.0) << "\n";
+    return;
+} // reportPredictedImbalance
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+WorkloadCostModel::resetTimers()
+{
+    for (int k = 0; k < NUM_PHASES; ++k)
+    {
+        d_phase_time[k] = 0.0;
+        d_phase_sync_time[k] = 0.0;
+    }
+    d_num_steps = 0;
+    return;
+} // resetTimers
+
+void
+WorkloadCostModel::solveNormalEquations(const double cell_AtA,
+                                        const double cell_Atb,
+                                        const double lag_AtA[2][2],
+                                        const double lag_Atb[2],
+                                        double& cell_cost,
+                                        double& node_cost,
+                                        double& qp_cost)
+{
+    // Fit the cost of the Eulerian phase.
+    cell_cost = cell_AtA > 0.0 ? std::max(cell_Atb / cell_AtA, 0.0) : 0.0;
+
+    // Fit the costs of the Lagrangian phases.
+    const double A00 = lag_AtA[0][0], A01 = lag_AtA[0][1], A11 = lag_AtA[1][1];
+    const double b0 = lag_Atb[0], b1 = lag_Atb[1];
+    node_cost = 0.0;
+    qp_cost = 0.0;
+    if (A00 > 0.0 && A11 > 0.0)
+    {
+        const double det = A00 * A11 - A01 * A01;
+        if (det > COLLINEARITY_TOL * A00 * A11)
+        {
+            node_cost = (A11 * b0 - A01 * b1) / det;
+            qp_cost = (A00 * b1 - A01 * b0) / det;
+            if (node_cost < 0.0)
+            {
+                node_cost = 0.0;
+                qp_cost = b1 / A11;
+            }
+            else if (qp_cost < 0.0)
+            {
+                node_cost = b0 / A00;
+                qp_cost = 0.0;
+            }
+        }
+        else
+        {
+            // The numbers of nodes and quadrature points are (nearly)
+            // proportional, so that their costs cannot be distinguished.  Fit a
+            // single cost to their sum.
+            node_cost = qp_cost = (b0 + b1) / (A00 + 2.0 * A01 + A11);
+        }
+    }
+    else if (A00 > 0.0)
+    {
+        node_cost = b0 / A00;
+    }
+    else if (A11 > 0.0)
+    {
+        qp_cost = b1 / A11;
+    }
+    node_cost = std::max(node_cost, 0.0);
+    qp_cost = std::max(qp_cost, 0.0);
+    return;
+} // solveNormalEquations
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
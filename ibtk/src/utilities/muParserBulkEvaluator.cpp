@@ -0,0 +1,271 @@
+// Filename: muParserBulkEvaluator.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "IBTK_config.h"
+#include "Index.h"
+#include "boost/array.hpp"
+#include "ibtk/muParserBulkEvaluator.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "muParser.h"
+#include "muParserDef.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+const int muParserBulkEvaluator::BULK_SIZE;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+muParserBulkEvaluator::muParserBulkEvaluator(mu::Parser* const parser, const size_t max_cached_values)
+    : d_parser(parser),
+      d_time_dependent(false),
+      d_axis_dependent(),
+      d_time_vals(BULK_SIZE, 0.0),
+      d_posn_vals(),
+      d_reduced_vals(),
+      d_cache(),
+      d_num_cached_values(0),
+      d_max_cached_values(max_cached_values)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_parser);
+#endif
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_axis_dependent[d] = false;
+        d_posn_vals[d].resize(BULK_SIZE, 0.0);
+    }
+
+    // Bind the parser variables to the bulk evaluation buffers.  In bulk mode,
+    // muParser reads the value of each variable at point k from the k-th entry
+    // of the array bound to that variable.
+    d_parser->DefineVar("T", &d_time_vals[0]);
+    d_parser->DefineVar("t", &d_time_vals[0]);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        std::ostringstream stream;
+        stream << d;
+        const std::string postfix = stream.str();
+        d_parser->DefineVar("X" + postfix, &d_posn_vals[d][0]);
+        d_parser->DefineVar("x" + postfix, &d_posn_vals[d][0]);
+        d_parser->DefineVar("X_" + postfix, &d_posn_vals[d][0]);
+        d_parser->DefineVar("x_" + postfix, &d_posn_vals[d][0]);
+    }
+
+    // Determine the variables used by the expression.
+    const mu::varmap_type used_vars = d_parser->GetUsedVar();
+    for (mu::varmap_type::const_iterator cit = used_vars.begin(); cit != used_vars.end(); ++cit)
+    {
+        const double* const var_ptr = cit->second;
+        if (var_ptr == &d_time_vals[0]) d_time_dependent = true;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (var_ptr == &d_posn_vals[d][0]) d_axis_dependent[d] = true;
+        }
+    }
+    return;
+} // muParserBulkEvaluator
+
+muParserBulkEvaluator::~muParserBulkEvaluator()
+{
+    // intentionally blank
+    return;
+} // ~muParserBulkEvaluator
+
+bool
+muParserBulkEvaluator::isTimeDependent() const
+{
+    return d_time_dependent;
+} // isTimeDependent
+
+bool
+muParserBulkEvaluator::isConstant() const
+{
+    if (d_time_dependent) return false;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (d_axis_dependent[d]) return false;
+    }
+    return true;
+} // isConstant
+
+bool
+muParserBulkEvaluator::dependsOnAxis(const unsigned int axis) const
+{
+    return d_axis_dependent[axis];
+} // dependsOnAxis
+
+void
+muParserBulkEvaluator::evaluate(std::vector<double>& values,
+                                const Box<NDIM>& box,
+                                const Index<NDIM>& i_lower,
+                                const double* const x_lower,
+                                const double* const dx,
+                                const boost::array<double, NDIM>& offset,
+                                const double time)
+{
+    values.resize(box.size());
+    if (box.empty()) return;
+
+    // Restrict the evaluation to the axes upon which the expression depends.
+    Box<NDIM> reduced_box = box;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (!d_axis_dependent[d]) reduced_box.upper()(d) = reduced_box.lower()(d);
+    }
+    const int num_reduced_vals = reduced_box.size();
+
+    // Look up the values of time-independent expressions in the cache.  The
+    // cache key determines the positions of all of the evaluation points.
+    const std::vector<double>* reduced_vals = NULL;
+    std::vector<double> key;
+    if (!d_time_dependent)
+    {
+        key.reserve(6 * NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            key.push_back(static_cast<double>(reduced_box.lower()(d)));
+            key.push_back(static_cast<double>(reduced_box.upper()(d)));
+            if (d_axis_dependent[d])
+            {
+                key.push_back(static_cast<double>(i_lower(d)));
+                key.push_back(x_lower[d]);
+                key.push_back(dx[d]);
+                key.push_back(offset[d]);
+            }
+        }
+        std::map<std::vector<double>, std::vector<double> >::const_iterator cit = d_cache.find(key);
+        if (cit != d_cache.end()) reduced_vals = &cit->second;
+    }
+
+    // Evaluate the expression at the points of the reduced box, BULK_SIZE
+    // points at a time.
+    if (!reduced_vals)
+    {
+        d_reduced_vals.resize(num_reduced_vals);
+        int k = 0, k_chunk = 0;
+        for (Box<NDIM>::Iterator b(reduced_box); b; b++, ++k)
+        {
+            const Index<NDIM>& i = b();
+            const int k_buf = k - k_chunk;
+            d_time_vals[k_buf] = time;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_posn_vals[d][k_buf] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - i_lower(d)) + offset[d]);
+            }
+            if (k_buf + 1 == BULK_SIZE)
+            {
+                evaluateBuffers(&d_reduced_vals[k_chunk], BULK_SIZE);
+                k_chunk += BULK_SIZE;
+            }
+        }
+        if (k_chunk < num_reduced_vals) evaluateBuffers(&d_reduced_vals[k_chunk], num_reduced_vals - k_chunk);
+        reduced_vals = &d_reduced_vals;
+        if (!d_time_dependent)
+        {
+            if (d_num_cached_values + num_reduced_vals > d_max_cached_values) clearCache();
+            if (static_cast<size_t>(num_reduced_vals) <= d_max_cached_values)
+            {
+                d_cache[key] = d_reduced_vals;
+                d_num_cached_values += num_reduced_vals;
+            }
+        }
+    }
+
+    // Broadcast the values along the axes upon which the expression does not
+    // depend.
+    if (num_reduced_vals == static_cast<int>(values.size()))
+    {
+        values = *reduced_vals;
+        return;
+    }
+    boost::array<int, NDIM> stride;
+    int reduced_stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        stride[d] = d_axis_dependent[d] ? reduced_stride : 0;
+        reduced_stride *= reduced_box.numberCells(d);
+    }
+    int k = 0;
+    for (Box<NDIM>::Iterator b(box); b; b++, ++k)
+    {
+        const Index<NDIM>& i = b();
+        int idx = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            idx += stride[d] * (i(d) - box.lower()(d));
+        }
+        values[k] = (*reduced_vals)[idx];
+    }
+    return;
+} // evaluate
+
+void
+muParserBulkEvaluator::clearCache()
+{
+    d_cache.clear();
+    d_num_cached_values = 0;
+    return;
+} // clearCache
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserBulkEvaluator::evaluateBuffers(double* const values, const int num_values)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_values > 0 && num_values <= BULK_SIZE);
+#endif
+    d_parser->Eval(values, num_values);
+    return;
+} // evaluateBuffers
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -43,22 +43,20 @@
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
-#include "CellIterator.h"
 #include "FaceData.h"
 #include "FaceIndex.h"
-#include "FaceIterator.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
 #include "NodeIndex.h"
-#include "NodeIterator.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "SideData.h"
 #include "SideIndex.h"
-#include "SideIterator.h"
+#include "boost/array.hpp"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/muParserBulkEvaluator.h"
 #include "ibtk/muParserCartGridFunction.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "muParser.h"
@@ -102,8 +100,7 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
       d_constants(),
       d_function_strings(),
       d_parsers(),
-      d_parser_time(),
-      d_parser_posn()
+      d_evaluators()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -275,19 +272,30 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
         {
             it->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        it->DefineVar("T", &d_parser_time);
-        it->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Setup the bulk evaluators, which define the time and position variables
+    // and determine which of these variables are used by each function.
+    for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+    {
+        try
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            it->DefineVar("X" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            d_evaluators.push_back(new muParserBulkEvaluator(&(*it)));
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -295,14 +303,22 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
 
 muParserCartGridFunction::~muParserCartGridFunction()
 {
-    // intentionally blank
+    for (std::vector<muParserBulkEvaluator*>::iterator it = d_evaluators.begin(); it != d_evaluators.end(); ++it)
+    {
+        delete *it;
+    }
     return;
 } // ~muParserCartGridFunction
 
 bool
 muParserCartGridFunction::isTimeDependent() const
 {
-    return true;
+    for (std::vector<muParserBulkEvaluator*>::const_iterator cit = d_evaluators.begin(); cit != d_evaluators.end();
+         ++cit)
+    {
+        if ((*cit)->isTimeDependent()) return true;
+    }
+    return false;
 } // isTimeDependent
 
 void
@@ -313,8 +329,6 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
     const Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -322,7 +336,10 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     const double* const XLower = pgeom->getXLower();
     const double* const dx = pgeom->getDx();
 
-    // Set the data in the patch.
+    // Set the data in the patch.  The functions are evaluated in bulk on the
+    // index box associated with each data centering, in which the position of
+    // index i along axis d is XLower[d] + dx[d]*(i(d) - patch_lower(d) +
+    // offset[d]).
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
 #if !defined(NDEBUG)
     TBOX_ASSERT(data);
@@ -331,223 +348,169 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     Pointer<FaceData<NDIM, double> > fc_data = data;
     Pointer<NodeData<NDIM, double> > nc_data = data;
     Pointer<SideData<NDIM, double> > sc_data = data;
-    if (cc_data)
+    std::vector<double> values;
+    boost::array<double, NDIM> offset;
+    try
     {
+        if (cc_data)
+        {
 #if !defined(NDEBUG)
-        TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
+            TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
-        {
-            const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
+                offset[d] = 0.5;
+            }
+            for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
+            {
+                const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
+                d_evaluators[function_depth]->evaluate(values, patch_box, patch_lower, XLower, dx, offset, data_time);
+                int k = 0;
+                for (Box<NDIM>::Iterator b(patch_box); b; b++, ++k)
                 {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
+                    (*cc_data)(CellIndex<NDIM>(b()), data_depth) = values[k];
                 }
             }
         }
-    }
-    else if (fc_data)
-    {
+        else if (fc_data)
+        {
 #if !defined(NDEBUG)
-        TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == NDIM ||
-                    d_parsers.size() == static_cast<unsigned int>(fc_data->getDepth()) ||
-                    d_parsers.size() == NDIM * static_cast<unsigned int>(fc_data->getDepth()));
+            TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == NDIM ||
+                        d_parsers.size() == static_cast<unsigned int>(fc_data->getDepth()) ||
+                        d_parsers.size() == NDIM * static_cast<unsigned int>(fc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
-        {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int fc_data_depth = fc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == fc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * fc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    int function_depth = -1;
+                    const int parsers_size = static_cast<int>(d_parsers.size());
+                    const int fc_data_depth = fc_data->getDepth();
+                    if (parsers_size == 1)
+                    {
+                        function_depth = 0;
+                    }
+                    else if (parsers_size == NDIM)
+                    {
+                        function_depth = axis;
+                    }
+                    else if (parsers_size == fc_data_depth)
                     {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
+                        function_depth = data_depth;
                     }
-                    try
+                    else if (parsers_size == NDIM * fc_data_depth)
                     {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
+                        function_depth = NDIM * data_depth + axis;
                     }
-                    catch (mu::ParserError& e)
+
+                    // Faces are indexed by the cell indices of the cells on
+                    // their upper sides.
+                    Box<NDIM> face_box = patch_box;
+                    face_box.upper()(axis) += 1;
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
+                        offset[d] = (d == axis ? 0.0 : 0.5);
                     }
-                    catch (...)
+                    d_evaluators[function_depth]->evaluate(
+                        values, face_box, patch_lower, XLower, dx, offset, data_time);
+                    int k = 0;
+                    for (Box<NDIM>::Iterator b(face_box); b; b++, ++k)
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        (*fc_data)(FaceIndex<NDIM>(b(), axis, FaceIndex<NDIM>::Lower), data_depth) = values[k];
                     }
                 }
             }
         }
-    }
-    else if (nc_data)
-    {
+        else if (nc_data)
+        {
 #if !defined(NDEBUG)
-        TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
+            TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
-        {
-            const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+            Box<NDIM> node_box = patch_box;
+            node_box.growUpper(IntVector<NDIM>(1));
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
+                offset[d] = 0.0;
+            }
+            for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
+            {
+                const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
+                d_evaluators[function_depth]->evaluate(values, node_box, patch_lower, XLower, dx, offset, data_time);
+                int k = 0;
+                for (Box<NDIM>::Iterator b(node_box); b; b++, ++k)
                 {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
+                    (*nc_data)(NodeIndex<NDIM>(b(), IntVector<NDIM>(0)), data_depth) = values[k];
                 }
             }
         }
-    }
-    else if (sc_data)
-    {
+        else if (sc_data)
+        {
 #if !defined(NDEBUG)
-        TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == NDIM ||
-                    d_parsers.size() == static_cast<unsigned int>(sc_data->getDepth()) ||
-                    d_parsers.size() == NDIM * static_cast<unsigned int>(sc_data->getDepth()));
+            TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == NDIM ||
+                        d_parsers.size() == static_cast<unsigned int>(sc_data->getDepth()) ||
+                        d_parsers.size() == NDIM * static_cast<unsigned int>(sc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
-        {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int sc_data_depth = sc_data->getDepth();
-                if (parsers_size == 1)
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
                 {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == sc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * sc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    int function_depth = -1;
+                    const int parsers_size = static_cast<int>(d_parsers.size());
+                    const int sc_data_depth = sc_data->getDepth();
+                    if (parsers_size == 1)
+                    {
+                        function_depth = 0;
+                    }
+                    else if (parsers_size == NDIM)
                     {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
+                        function_depth = axis;
                     }
-                    try
+                    else if (parsers_size == sc_data_depth)
                     {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
+                        function_depth = data_depth;
                     }
-                    catch (mu::ParserError& e)
+                    else if (parsers_size == NDIM * sc_data_depth)
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
+                        function_depth = NDIM * data_depth + axis;
                     }
-                    catch (...)
+
+                    Box<NDIM> side_box = patch_box;
+                    side_box.upper()(axis) += 1;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        offset[d] = (d == axis ? 0.0 : 0.5);
+                    }
+                    d_evaluators[function_depth]->evaluate(
+                        values, side_box, patch_lower, XLower, dx, offset, data_time);
+                    int k = 0;
+                    for (Box<NDIM>::Iterator b(side_box); b; b++, ++k)
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        (*sc_data)(SideIndex<NDIM>(b(), axis, SideIndex<NDIM>::Lower), data_depth) = values[k];
                     }
                 }
             }
         }
+        else
+        {
+            TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                       << "  unsupported patch data type encountered."
+                       << std::endl);
+        }
     }
-    else
+    catch (mu::ParserError& e)
     {
         TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                   << "  unsupported patch data type encountered."
-                   << std::endl);
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
     }
     return;
 } // setDataOnPatch
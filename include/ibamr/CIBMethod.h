@@ -35,12 +35,17 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "RobinBcCoefStrategy.h"
 #include "ibamr/CIBStrategy.h"
 #include "ibamr/IBMethod.h"
 #include "ibamr/IBMethod.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
+#include "petscvec.h"
 
 namespace mu
 {
@@ -240,6 +245,14 @@ public:
         double init_data_time,
         bool initial_time);
 
+    /*!
+     * \brief Complete the redistribution of Lagrangian data and discard the
+     * cached Vec/array scatter plans, which depend on the PETSc ordering of
+     * the Lagrangian nodes.
+     */
+    void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                               SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
+
     /*!
     * \brief Interpolate the Eulerian velocity to the curvilinear mesh at the
     * specified time within the current time interval.
@@ -477,6 +490,33 @@ private:
      */
     void setInitialLambda(const int level_number);
 
+    /*!
+     * \brief Scatter plan used to copy data between a distributed Lagrangian
+     * Vec and a raw array stored on a single processor.
+     */
+    struct VecArrayScatterPlan
+    {
+        Vec array_vec;
+        VecScatter ctx;
+        PetscInt vec_local_size;
+    };
+
+    typedef std::pair<std::vector<unsigned>, std::pair<int, int> > VecArrayScatterKey;
+
+    /*!
+     * \brief Get the (cached) scatter plan from the distributed Vec \em b to
+     * the array for the specified structures, data depth, and array rank.
+     */
+    VecArrayScatterPlan& getVecArrayScatterPlan(Vec b,
+                                                const std::vector<unsigned>& struct_ids,
+                                                const int data_depth,
+                                                const int array_rank);
+
+    /*!
+     * \brief Destroy all cached Vec/array scatter plans.
+     */
+    void clearVecArrayScatterPlans();
+
     /*!
      * Functions to set constrained velocities of the structures.
      */
@@ -515,6 +555,13 @@ private:
      */
     std::vector<std::pair<int, int> > d_struct_lag_idx_range;
 
+    /*!
+     * Cached scatter plans used by copyVecToArray() and copyArrayToVec(),
+     * keyed by the structure ids, data depth, and array rank.  The plans are
+     * invalidated whenever the Lagrangian data are redistributed.
+     */
+    std::map<VecArrayScatterKey, VecArrayScatterPlan> d_vec_array_scatter_plans;
+
     /*!
      * The object used to write out data for postprocessing by the visIt
      * visualization tool.
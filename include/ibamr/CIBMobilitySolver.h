@@ -194,6 +194,34 @@ public:
      */
     bool solveBodyMobilitySystem(Vec x, Vec b);
 
+    /*!
+     * \brief Solves the mobility problem for several right-hand sides.
+     *
+     * With the Krylov mobility solver, all systems are solved simultaneously
+     * using a block Krylov method.
+     *
+     * \param x Vecs storing the Lagrange multipliers.
+     *
+     * \param b Vecs storing the desired velocities.
+     *
+     * \return \p true if the solver converged to the specified tolerances for
+     * all systems, \p false otherwise
+     */
+    bool solveMobilitySystems(const std::vector<Vec>& x, const std::vector<Vec>& b);
+
+    /*!
+     * \brief Solves the body mobility problem for several right-hand sides
+     * using a block Krylov method.
+     *
+     * \param x Vecs storing the rigid body velocities
+     *
+     * \param b Vecs storing the net external generalized forces
+     *
+     * \return \p true if the solver converged to the specified tolerances for
+     * all systems, \p false otherwise
+     */
+    bool solveBodyMobilitySystems(const std::vector<Vec>& x, const std::vector<Vec>& b);
+
     /*!
      * \brief Initialize the mobility solver.
      *
@@ -37,6 +37,7 @@
 #include <string>
 #include <vector>
 
+#include "Eigen/Dense"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "petscksp.h"
 #include "tbox/DescribedClass.h"
@@ -119,6 +120,17 @@ namespace IBAMR
  *
  * Here, we employ the Krylov solver to solve the above saddle-point problem. We use
  * Schur complement preconditioner to precondition the iterative solver.
+ *
+ * For free-moving bodies, each application of the preconditioner solves the
+ * body mobility problem \f$ N \vec{U} = \vec{F} \f$ with \f$ N = T M^{-1}
+ * T^{*} \f$, which requires one mobility solve per Krylov iteration, followed
+ * by a further mobility solve.  If the input key \p precompute_body_mobility is
+ * \p TRUE, \f$ M^{-1} T^{*} \f$ is instead computed once per solve by a
+ * single block solve with one right-hand side per free rigid degree of freedom,
+ * and both steps reduce to dense operations.  This is beneficial when the
+ * number of free degrees of freedom is small compared to the number of
+ * preconditioner applications; the memory use grows with one constraint force
+ * vector per free degree of freedom.
  */
 class CIBSaddlePointSolver : public SAMRAI::tbox::DescribedClass
 {
@@ -240,6 +252,19 @@ public:
      */
     bool solveSystem(Vec x, Vec b);
 
+    /*!
+     * \brief Solve the linear systems of equations \f$Ax_i=b_i\f$ for several
+     * right-hand sides using a block Krylov method.
+     *
+     * All systems are advanced within a single block Krylov subspace, so that
+     * each application of the saddle-point operator contributes to every
+     * solution.
+     *
+     * \return \p true if the solver converged to the specified tolerances for
+     * all systems, \p false otherwise
+     */
+    bool solveSystems(const std::vector<Vec>& x, const std::vector<Vec>& b);
+
     /*!
      * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
      *
@@ -320,6 +345,19 @@ private:
      */
     void initializeKSP();
 
+    /*!
+     * \brief Compute \f$ Z = M^{-1} T^{*} \f$ and the body mobility matrix
+     * \f$ N = T Z \f$ for the free rigid degrees of freedom by solving the
+     * mobility problems for all free degrees of freedom simultaneously.  The
+     * vectors \a x and \a b provide the layout of the saddle-point vectors.
+     */
+    void initializeBodyMobility(Vec x, Vec b);
+
+    /*!
+     * \brief Free the data allocated by initializeBodyMobility().
+     */
+    void deallocateBodyMobility();
+
     /*!
      * \brief Reset the values of the convergence tolerances for the PETSc KSP
      * object.
@@ -392,6 +430,12 @@ private:
     double d_scale_interp, d_scale_spread, d_reg_mob_factor;
     bool d_normalize_spread_force;
 
+    // Precomputed mobility solutions Z = M^-1 T* and the factored body
+    // mobility matrix N = T Z for the free rigid degrees of freedom.
+    bool d_precompute_body_mobility;
+    std::vector<Vec> d_body_mob_vecs;
+    Eigen::PartialPivLU<Eigen::MatrixXd> d_body_mob_lu;
+
     // Velocity BCs and cached communication operators for interpolation operation.
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_u_bc_coefs;
@@ -467,6 +467,22 @@ public:
      */
     const Eigen::Vector3d& getNewBodyCenterOfMass(const unsigned int part);
 
+    /*!
+     * \brief Get body center of mass at the initial time.
+     */
+    const Eigen::Vector3d& getInitialBodyCenterOfMass(const unsigned int part);
+
+    /*!
+     * \brief Get body center of mass at the midpoint of the timestep.
+     */
+    const Eigen::Vector3d& getHalfBodyCenterOfMass(const unsigned int part);
+
+    /*!
+     * \brief Get the quaternion describing the body orientation (relative to
+     * its initial orientation) at the midpoint of the timestep.
+     */
+    const Eigen::Quaterniond& getHalfBodyQuaternion(const unsigned int part);
+
     /*!
      * \brief Construct dense mobility matrix for the prototypical structures
      * identified by their indices.
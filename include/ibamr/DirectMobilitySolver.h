@@ -38,6 +38,7 @@
 #include <string>
 #include <vector>
 
+#include "IntVector.h"
 #include "ibamr/ibamr_enums.h"
 #include "petscmat.h"
 #include "petscvec.h"
@@ -65,6 +66,18 @@ namespace IBAMR
 /*!
  * \brief Class DirectMobilitySolver solves the mobility and body-mobility
  * sub-problem by employing direct solvers.
+ *
+ * The dense mobility matrices are factorized in the reference (initial) frame
+ * of the prototypical structures.  When the structures associated with a
+ * matrix move rigidly with respect to that frame, the stored factorizations
+ * are reused by rotating the right-hand side into the reference frame and the
+ * solution back out of it.  If \p recompute_mob_mat_perstep is set to \p TRUE,
+ * a matrix is reconstructed and refactorized only when the relative
+ * configuration of its structures deviates from a rigid motion of the
+ * reference configuration by more than \p mob_mat_reuse_tol (measured
+ * relative to the grid spacing for center of mass offsets and in the
+ * Frobenius norm for relative rotations).  A negative tolerance disables
+ * factorization reuse.
  */
 class DirectMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -231,17 +244,28 @@ private:
     /*!
      * \brief Factorize mobility matrix using direct solvers.
      */
-    void factorizeMobilityMatrix();
+    void factorizeMobilityMatrix(const std::string& mat_name);
 
     /*!
      * \brief Construct body mobility matrix as N = K^T inv(M) K.
      */
-    void constructBodyMobilityMatrix();
+    void constructBodyMobilityMatrix(const std::string& mat_name);
 
     /*!
      * \brief Factorize body mobility matrix using direct solvers.
      */
-    void factorizeBodyMobilityMatrix();
+    void factorizeBodyMobilityMatrix(const std::string& mat_name);
+
+    /*!
+     * \brief Determine whether all structures associated with a mobility
+     * matrix are (to within the tolerance \p d_mob_mat_reuse_tol) rigidly
+     * displaced from their reference configuration, in which case the
+     * factorization computed in the reference frame remains valid.
+     */
+    bool isRigidlyDisplaced(const std::string& mat_name,
+                            const double* dx,
+                            const double* domain_extents,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
 
     /*!
      * \brief Factorize dense matrix.
@@ -278,6 +302,7 @@ private:
     std::map<std::string, std::pair<double, double> > d_mat_scale_map;
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<int*, int*> > d_ipiv_map; // permutation matrices for LU
+    std::map<std::string, bool> d_mat_reference_frame_map; // factorization is in the reference frame
 
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
@@ -291,6 +316,7 @@ private:
     // Parameters used in this class.
     double d_f_periodic_corr;
     bool d_recompute_mob_mat;
+    double d_mob_mat_reuse_tol;
     double d_svd_replace_value, d_svd_eps;
 
 }; // DirectMobilitySolver
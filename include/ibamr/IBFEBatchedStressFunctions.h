@@ -0,0 +1,131 @@
+// Filename: IBFEBatchedStressFunctions.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBAMR_IBFEBatchedStressFunctions
+#define included_IBAMR_IBFEBatchedStressFunctions
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+
+#include "ibtk/libmesh_utilities.h"
+
+namespace libMesh
+{
+class Elem;
+} // namespace libMesh
+
+/////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * Material parameters for the batched compressible neo-Hookean stress function
+ *
+ *    PP = mu (FF - FF^{-T}) + lambda log(J) FF^{-T}.
+ */
+struct NeoHookeanStressParams
+{
+    NeoHookeanStressParams(const double mu = 0.0, const double lambda = 0.0) : mu(mu), lambda(lambda)
+    {
+    }
+
+    double mu, lambda;
+};
+
+/*!
+ * Batched compressible neo-Hookean PK1 stress function.  The context pointer
+ * must point to a NeoHookeanStressParams object.
+ */
+void neo_hookean_PK1_stress_batch(double* PP,
+                                  const IBTK::MeshFcnBatchData& batch_data,
+                                  libMesh::Elem* elem,
+                                  double data_time,
+                                  void* ctx);
+
+/*!
+ * Material parameters for the batched compressible Mooney-Rivlin stress
+ * function
+ *
+ *    PP = 2 c1 FF + 2 c2 (I1 FF - FF C) - (2 c1 + 2 (NDIM-1) c2) FF^{-T} + kappa log(J) FF^{-T},
+ *
+ * in which C = FF^T FF and I1 = tr(C).  The stress vanishes in the reference
+ * configuration.
+ */
+struct MooneyRivlinStressParams
+{
+    MooneyRivlinStressParams(const double c1 = 0.0, const double c2 = 0.0, const double kappa = 0.0)
+        : c1(c1), c2(c2), kappa(kappa)
+    {
+    }
+
+    double c1, c2, kappa;
+};
+
+/*!
+ * Batched compressible Mooney-Rivlin PK1 stress function.  The context pointer
+ * must point to a MooneyRivlinStressParams object.
+ */
+void mooney_rivlin_PK1_stress_batch(double* PP,
+                                    const IBTK::MeshFcnBatchData& batch_data,
+                                    libMesh::Elem* elem,
+                                    double data_time,
+                                    void* ctx);
+
+/*!
+ * Context for the batched adaptor of a pointwise PK1 stress function.
+ */
+struct PointwisePK1StressFcnAdaptor
+{
+    PointwisePK1StressFcnAdaptor(IBTK::TensorMeshFcnPtr fcn = NULL, void* const ctx = NULL) : fcn(fcn), ctx(ctx)
+    {
+    }
+
+    IBTK::TensorMeshFcnPtr fcn;
+    void* ctx;
+};
+
+/*!
+ * Batched PK1 stress function that evaluates a pointwise stress function at
+ * each point of the batch.  The context pointer must point to a
+ * PointwisePK1StressFcnAdaptor object.
+ */
+void pointwise_PK1_stress_batch_adaptor(double* PP,
+                                        const IBTK::MeshFcnBatchData& batch_data,
+                                        libMesh::Elem* elem,
+                                        double data_time,
+                                        void* ctx);
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_IBFEBatchedStressFunctions
@@ -212,6 +212,15 @@ public:
      */
     typedef IBTK::TensorMeshFcnPtr PK1StressFcnPtr;
 
+    /*!
+     * Typedef specifying interface for batched PK1 stress tensor function,
+     * which evaluates the stress at all of the quadrature points of an element
+     * (or element side) in a single call.
+     *
+     * \see IBTK::MeshFcnBatchData
+     */
+    typedef IBTK::TensorMeshBatchFcnPtr PK1StressBatchFcnPtr;
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
      */
@@ -221,8 +230,14 @@ public:
                          const std::vector<IBTK::SystemData>& system_data = std::vector<IBTK::SystemData>(),
                          void* const ctx = NULL,
                          const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
-                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
-            : fcn(fcn), system_data(system_data), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER,
+                         PK1StressBatchFcnPtr batch_fcn = NULL)
+            : fcn(fcn),
+              system_data(system_data),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order),
+              batch_fcn(batch_fcn)
         {
         }
 
@@ -231,6 +246,7 @@ public:
         void* ctx;
         libMesh::QuadratureType quad_type;
         libMesh::Order quad_order;
+        PK1StressBatchFcnPtr batch_fcn;
     };
 
     /*!
@@ -241,6 +257,12 @@ public:
      * \note It is possible to register multiple PK1 stress functions with this
      * class.  This is intended to be used to implement selective reduced
      * integration.
+     *
+     * \note If a batched stress function is provided, it is used in place of
+     * the pointwise function when computing the interior force density.
+     * Computations that require the stress only at isolated boundary
+     * quadrature points use the pointwise function when one is provided, and
+     * otherwise evaluate the batched function one point at a time.
      */
     void registerPK1StressFunction(const PK1StressFcnData& data, unsigned int part = 0);
 
@@ -525,6 +547,26 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Set the workload weights of Lagrangian nodes and quadrature points
+     * relative to that of a Cartesian grid cell.
+     */
+    void setWorkloadWeights(double node_weight, double quad_point_weight);
+
+    /*!
+     * Get the numbers of Lagrangian nodes and quadrature points in the local
+     * patches of the patch hierarchy, as determined by the most recent call to
+     * updateWorkloadEstimates().
+     */
+    void getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const;
+
+    /*!
+     * Register a workload cost model that is to be notified of the
+     * synchronizing operations performed by the Lagrangian parts of the time
+     * step.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> workload_cost_model);
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -763,6 +805,14 @@ protected:
      */
     std::string d_libmesh_restart_file_extension;
 
+    /*
+     * Data related to aligning the libMesh partitioning with the Cartesian grid
+     * patch distribution.
+     */
+    bool d_use_patch_aligned_partitioning;
+    double d_patch_aligned_partitioning_max_imbalance;
+    double d_repartitioning_threshold;
+
 private:
     /*!
      * \brief Default constructor.
@@ -812,6 +862,15 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*!
+     * Rebuild the element-patch mappings for each part, first repartitioning
+     * the part's mesh to match the current patch distribution when
+     * patch-aligned partitioning is enabled and the fraction of elements owned
+     * by processors other than the one that owns the corresponding patch
+     * exceeds the repartitioning threshold.
+     */
+    void reinitElementMappings();
 };
 } // namespace IBAMR
 
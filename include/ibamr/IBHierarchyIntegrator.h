@@ -58,6 +58,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/LMarkerSetVariable.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Pointer.h"
 
@@ -248,6 +249,19 @@ protected:
      */
     void putToDatabaseSpecialized(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * Start or stop timing a phase of the time step when measured costs are
+     * used to determine the workload estimates.
+     */
+    void startWorkloadPhase(IBTK::WorkloadCostModel::Phase phase);
+    void stopWorkloadPhase(IBTK::WorkloadCostModel::Phase phase);
+
+    /*!
+     * Indicate that a time step has been completed when measured costs are used
+     * to determine the workload estimates.
+     */
+    void completeWorkloadTimeStep();
+
     /*
      * Boolean value that indicates whether the integrator has been initialized.
      */
@@ -329,6 +343,12 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
 
+    /*
+     * Online model of the measured costs of the Eulerian and Lagrangian parts
+     * of the time step that is used to determine the workload estimates.
+     */
+    SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> d_workload_cost_model;
+
     /*
      * Lagrangian marker data structures.
      */
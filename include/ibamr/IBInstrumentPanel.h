@@ -35,9 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
-#include <functional>
 #include <iosfwd>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -146,6 +144,10 @@ public:
 
     /*!
      * \brief Initialize hierarchy- and configuration-dependent data.
+     *
+     * The meter webs and the interpolation stencils are only rebuilt when the
+     * perimeter nodes have moved or the patch hierarchy has been regridded or
+     * redistributed since the preceding call.
      */
     void initializeHierarchyDependentData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                           IBTK::LDataManager* l_data_manager,
@@ -239,45 +241,55 @@ private:
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
     /*!
-     * \brief Data structures employed to manage mappings between cell indices
-     * and web patch data (i.e., patch centroids and area-weighted normals) and
-     * meter centroid data.
+     * \brief Precomputed interpolation stencils that are used to evaluate the
+     * meter quantities from the patch data of a single local patch.
+     *
+     * Each entry of a stencil contributes coef*u(idx,component) to the value
+     * associated with meter meter_num, in which component is the data depth
+     * for cell-centered data and the axis for side-centered data.  The
+     * stencils are stored as flat arrays so that evaluating the meters amounts
+     * to a sparse dot product with the patch data.
      */
-    struct IndexFortranOrder : public std::binary_function<SAMRAI::hier::Index<NDIM>, SAMRAI::hier::Index<NDIM>, bool>
+    struct MeterStencil
     {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
+        inline void addEntry(const int m, const SAMRAI::hier::Index<NDIM>& i, const int c, const double w)
         {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    ||
-                    (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    ||
-                    (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-                        );
-        } // operator()
+            meter_num.push_back(m);
+            idx.push_back(i);
+            component.push_back(c);
+            coef.push_back(w);
+        } // addEntry
+
+        std::vector<int> meter_num;
+        std::vector<SAMRAI::hier::Index<NDIM> > idx;
+        std::vector<int> component;
+        std::vector<double> coef;
     };
 
-    struct WebPatch
+    struct PatchMeterStencils
     {
-        int meter_num;
-        const IBTK::Vector* X;
-        const IBTK::Vector* dA;
+        int patch_num;
+        MeterStencil cc_flux, sc_flux, mean_pres, point_pres;
     };
 
-    typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder> WebPatchMap;
-    std::vector<WebPatchMap> d_web_patch_map;
-
-    struct WebCentroid
-    {
-        int meter_num;
-        const IBTK::Vector* X;
-    };
+    /*!
+     * \brief The meter stencils of the local patches on each level of the patch
+     * hierarchy and the local contributions to the area of each meter.
+     *
+     * \note Each meter web patch/centroid is assigned to precisely one Cartesian
+     * grid cell in precisely one level, so that the contributions from all
+     * processes may simply be summed.
+     */
+    std::vector<std::vector<PatchMeterStencils> > d_meter_stencils;
+    std::vector<double> d_local_meter_area;
 
-    typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder> WebCentroidMap;
-    std::vector<WebCentroidMap> d_web_centroid_map;
+    /*!
+     * \brief The positions of the perimeter nodes and a description of the
+     * patch hierarchy configuration (the boxes of each level along with their
+     * processor assignments) for which the meter stencils were built.
+     */
+    std::vector<double> d_stencil_X_perimeter;
+    std::vector<int> d_stencil_hierarchy_config;
 
     /*
      * The directory where data is to be dumped and the most recent timestep
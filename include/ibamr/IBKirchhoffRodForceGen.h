@@ -40,7 +40,6 @@
 #include <vector>
 
 #include "ibamr/IBRodForceSpec.h"
-#include "petscmat.h"
 #include "tbox/Database.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
@@ -73,6 +72,13 @@ namespace IBAMR
  * \brief Class IBKirchhoffRodForceGen computes the forces and torques generated
  * by a collection of linear elements based on Kirchhoff rod theory.
  *
+ * The positions and director triads of the "next" node of each rod element
+ * are obtained from ghosted copies of the position and director data whose
+ * ghost nodes are determined when the level data are initialized, and the
+ * forces and torques are accumulated in ghosted vectors that are summed into
+ * the force and torque data via a single reverse ghost update.  The elements
+ * are processed in blocks of consecutive elements.
+ *
  * \note Class IBKirchhoffRodForceGen DOES NOT correct for periodic
  * displacements of IB points.
  */
@@ -147,7 +153,7 @@ private:
      * \name Data maintained separately for each level of the patch hierarchy.
      */
     //\{
-    std::vector<Mat> d_D_next_mats, d_X_next_mats;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_ghost_data, d_D_ghost_data, d_F_ghost_data, d_N_ghost_data;
     std::vector<std::vector<int> > d_petsc_curr_node_idxs, d_petsc_next_node_idxs;
     std::vector<std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> > > d_material_params;
     std::vector<bool> d_is_initialized;
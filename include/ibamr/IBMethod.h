@@ -59,6 +59,7 @@
 namespace IBTK
 {
 class RobinPhysBdryPatchStrategy;
+class WorkloadCostModel;
 } // namespace IBTK
 
 namespace IBTK
@@ -376,6 +377,26 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Set the workload weights of Lagrangian nodes and quadrature points
+     * relative to that of a Cartesian grid cell.
+     */
+    void setWorkloadWeights(double node_weight, double quad_point_weight);
+
+    /*!
+     * Get the numbers of Lagrangian nodes and quadrature points in the local
+     * patches of the patch hierarchy, as determined by the most recent call to
+     * updateWorkloadEstimates().
+     */
+    void getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const;
+
+    /*!
+     * Register a workload cost model that is to be notified of the
+     * synchronizing operations performed by the Lagrangian parts of the time
+     * step.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> workload_cost_model);
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -529,6 +550,7 @@ protected:
     std::string d_interp_kernel_fcn, d_spread_kernel_fcn;
     bool d_error_if_points_leave_domain;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
+    bool d_write_redistributable_restart_data;
 
     /*
      * Lagrangian variables.
@@ -104,6 +104,11 @@ public:
      *
      * \note By default, function default_linear_spring_force() is associated
      * with \a force_fcn_idx 0.
+     *
+     * \note If no derivative function is provided, the derivative of the
+     * spring tension is approximated by centered differences when computing
+     * the force Jacobian, except for built-in force functions, for which the
+     * analytic derivative is used.
      */
     void registerSpringForceFunction(int force_fcn_index,
                                      const SpringForceFcnPtr spring_force_fcn_ptr,
@@ -228,10 +233,33 @@ private:
     };
     std::vector<TargetPointData> d_target_point_data;
 
+    /*
+     * Block sparse (block CSR) layout of the contributions of the local force
+     * specifications to the Lagrangian force Jacobian.  The values of each
+     * block row are stored contiguously in the row-major form expected by
+     * MatSetValuesBlocked(), so that block b occupies entries
+     * vals[block_offsets[b] + i*block_strides[b] + j].  The slot arrays map
+     * each force specification to the blocks that it contributes to.
+     */
+    struct JacobianData
+    {
+        std::vector<int> block_rows, block_row_ptr, block_cols;
+        std::vector<int> block_offsets, block_strides;
+        std::vector<double> vals;
+        std::vector<int> spring_slots, beam_slots, target_point_slots;
+    };
+    std::vector<JacobianData> d_jacobian_data;
+
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_ghost_data, d_F_ghost_data, d_dX_data;
     std::vector<bool> d_is_initialized;
     //\}
 
+    /*!
+     * Build the block sparse layout of the Lagrangian force Jacobian for the
+     * specified level.
+     */
+    void initializeJacobianLevelData(int level_number);
+
     /*!
      * Spring force routines.
      */
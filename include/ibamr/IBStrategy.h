@@ -55,6 +55,7 @@ class RobinPhysBdryPatchStrategy;
 namespace IBTK
 {
 class HierarchyMathOps;
+class WorkloadCostModel;
 } // namespace IBTK
 namespace SAMRAI
 {
@@ -354,6 +355,35 @@ public:
     virtual void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                          int workload_data_idx);
 
+    /*!
+     * Set the workload weights of Lagrangian nodes and quadrature points
+     * relative to that of a Cartesian grid cell that are used by
+     * updateWorkloadEstimates().
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void setWorkloadWeights(double node_weight, double quad_point_weight);
+
+    /*!
+     * Get the numbers of Lagrangian nodes and quadrature points in the local
+     * patches of the patch hierarchy, as determined by the most recent call to
+     * updateWorkloadEstimates().  These counts are used to fit the costs of the
+     * Lagrangian parts of the time step.
+     *
+     * A default implementation is provided that sets both numbers to zero.
+     */
+    virtual void getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const;
+
+    /*!
+     * Register a workload cost model that is to be notified of the
+     * synchronizing operations performed by the Lagrangian parts of the time
+     * step, so that the time spent in those operations is excluded from the
+     * measured costs.
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void registerWorkloadCostModel(SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> workload_cost_model);
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
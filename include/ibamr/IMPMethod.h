@@ -40,6 +40,7 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -53,6 +54,7 @@
 namespace IBTK
 {
 class RobinPhysBdryPatchStrategy;
+class WorkloadCostModel;
 } // namespace IBTK
 
 namespace IBTK
@@ -252,6 +254,26 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Set the workload weights of Lagrangian nodes and quadrature points
+     * relative to that of a Cartesian grid cell.
+     */
+    void setWorkloadWeights(double node_weight, double quad_point_weight);
+
+    /*!
+     * Get the numbers of Lagrangian nodes and quadrature points in the local
+     * patches of the patch hierarchy, as determined by the most recent call to
+     * updateWorkloadEstimates().
+     */
+    void getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const;
+
+    /*!
+     * Register a workload cost model that is to be notified of the
+     * synchronizing operations performed by the Lagrangian parts of the time
+     * step.
+     */
+    void registerWorkloadCostModel(SAMRAI::tbox::Pointer<IBTK::WorkloadCostModel> workload_cost_model);
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -449,6 +471,44 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*!
+     * \brief Tabulated kernel weights for the material points on a single
+     * patch level.
+     *
+     * One entry is stored for each material point visited during a traversal of
+     * the local patches of the level.  Each entry records the local index and
+     * position of the point, along with the lower corners of the kernel
+     * stencils and the separable 1D kernel weights and derivatives along each
+     * axis for each component of the side-centered Eulerian data.
+     */
+    struct TransferWeights
+    {
+        std::vector<int> local_idx;
+        std::vector<double> X;
+        std::vector<int> stencil_lower;
+        std::vector<double> phi, dphi_dx;
+    };
+
+    /*!
+     * Ensure that the tabulated kernel weights stored in the specified entry
+     * correspond to the material point with the specified local index and
+     * position, and recompute them if they do not.
+     */
+    void updateTransferWeights(TransferWeights& weights,
+                               unsigned int entry,
+                               int local_idx,
+                               const double* X,
+                               const SAMRAI::hier::Box<NDIM>& patch_box,
+                               const double* x_lower,
+                               const double* x_upper,
+                               const double* dx);
+
+    /*
+     * Kernel weights shared by interpolateVelocity() and spreadForce(), so
+     * that the weights are evaluated once for each material point position.
+     */
+    std::vector<TransferWeights> d_transfer_weights;
 };
 } // namespace IBAMR
 
@@ -138,6 +138,18 @@ public:
      */
     bool solveSystem(Vec x, Vec b);
 
+    /*!
+     * \brief Solve the linear systems of equations \f$ Nx_i = b_i \f$ for
+     * several right-hand sides using a block Krylov method.
+     *
+     * \param x solution vectors
+     * \param b right-hand-side vectors
+     *
+     * \return \p true if the solver converged to the specified tolerances for
+     * all systems, \p false otherwise
+     */
+    bool solveSystems(const std::vector<Vec>& x, const std::vector<Vec>& b);
+
     /*!
      * \brief Compute hierarchy dependent data required for solving \f$ Nx = b \f$.
      *
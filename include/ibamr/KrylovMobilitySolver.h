@@ -155,6 +155,24 @@ public:
      */
     bool solveSystem(Vec x, Vec b);
 
+    /*!
+     * \brief Solve the linear systems of equations \f$ Mx_i=b_i \f$ for
+     * several right-hand sides using a block Krylov method.
+     *
+     * All systems are advanced within a single block Krylov subspace using the
+     * operator, preconditioner, and tolerances of the PETSc KSP object.  This
+     * is typically much cheaper than solving the systems one at a time, e.g.,
+     * when computing the response of a rigid body to each of its rigid body
+     * modes.
+     *
+     * \param x solution vectors
+     * \param b right-hand-side vectors
+     *
+     * \return \p true if the solver converged to the specified tolerances for
+     * all systems, \p false otherwise
+     */
+    bool solveSystems(const std::vector<Vec>& x, const std::vector<Vec>& b);
+
     /*!
      * \brief Compute hierarchy dependent data required for solving \f$ Mx = b \f$.
      *
@@ -44,6 +44,22 @@ namespace IBAMR
 class MobilityFunctions
 {
 public:
+    /*!
+     * \brief IB kernels for which hydrodynamic radii are tabulated.
+     */
+    enum KernelType
+    {
+        IB_3_KERNEL = 0,
+        IB_4_KERNEL = 1,
+        IB_6_KERNEL = 2
+    };
+
+    /*!
+     * \brief Return the kernel type corresponding to an IB kernel name.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     */
+    static KernelType getKernelType(const char* kernel_name);
+
     /*!
      * \brief Construct the mobility matrix from empirical fits.
      *
@@ -114,6 +130,62 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Construct the mobility matrix from Rotne-Pragner-Yamakawa tensor
+     * using a cache-blocked assembly of the lower block triangle of the
+     * matrix.
+     *
+     * The marker pairs are processed in square tiles of the matrix; within a
+     * tile, the pair separations are computed for a contiguous run of columns
+     * before the tensor components are evaluated, so that the pair evaluations
+     * vectorize.  Each tile fills both its own entries and the corresponding
+     * transposed entries, and tiles are distributed among OpenMP threads when
+     * OpenMP is enabled.  The entries are computed from the same expressions as
+     * in constructRPYMobilityMatrix(), which remains the reference
+     * implementation.  The two agree exactly unless the compiler contracts the
+     * vectorized expressions into fused multiply-adds, in which case they
+     * differ by a few units of roundoff relative to the largest entry.
+     *
+     * \tparam KERNEL IB kernel function.
+     *
+     * \param mu Fluid density.
+     *
+     * \param dx Cartesian grid spacing.
+     *
+     * \param X Array of IB markers' location.
+     *
+     * \param num_nodes Number of Lagrangian markers.
+     *
+     * \param periodic_correction Input parameter for incorporating
+     * periodic domain correction. Set it to zero if not known.
+     *
+     * \param mm Pointer to mobility matrix.
+     */
+    template <KernelType KERNEL>
+    static void constructRPYMobilityMatrixBlocked(const double mu,
+                                                  const double dx,
+                                                  const double* X,
+                                                  const int num_nodes,
+                                                  const double periodic_correction,
+                                                  double* mm);
+
+    /*!
+     * \brief Construct the mobility matrix from Rotne-Pragner-Yamakawa tensor
+     * using the cache-blocked assembly, selecting the kernel by name.
+     *
+     * \param kernel_name IB kernel function.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     *
+     * \see constructRPYMobilityMatrixBlocked()
+     */
+    static void constructRPYMobilityMatrixBlocked(const char* kernel_name,
+                                                  const double mu,
+                                                  const double dx,
+                                                  const double* X,
+                                                  const int num_nodes,
+                                                  const double periodic_correction,
+                                                  double* mm);
 }; // MobilityFunctions
 
 } // namespace IBAMR
@@ -71,6 +71,15 @@ namespace IBAMR
  * produces the signed distance away from an interface.
  *
  *
+ * The relaxation is optionally restricted to an active set of patches.  When
+ * <tt>enable_active_set</tt> is set to <tt>TRUE</tt> in the input database, a
+ * patch is skipped once the maximum change in its values over a single
+ * iteration falls below <tt>abs_tol</tt>, and it is relaxed again once its
+ * ghost cell values, or the values in its cells that are covered by finer
+ * levels, change by more than <tt>abs_tol</tt>.  The global
+ * convergence check, which requires a reduction over all processors, is carried
+ * out every <tt>convergence_check_interval</tt> iterations (default 1).
+ *
  * Reference
  * Min, C., <A HREF="http://www.sciencedirect.com/science/article/pii/S0021999109007189">
  * On reinitializing level set functions</A>
@@ -102,12 +111,20 @@ protected:
 
 private:
     /*!
-     * \brief Do one relaxation step over the hierarchy.
+     * \brief Do one relaxation step over the active patches of the hierarchy
+     * and update the active set.
+     *
+     * \return The local contribution to the squared L2-norm of the change in
+     * the solution.
      */
-    void relax(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
-               int dist_idx,
-               int dist_init_idx,
-               const int iter) const;
+    double relax(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                 int dist_idx,
+                 int dist_iter_idx,
+                 int dist_init_idx,
+                 int wgt_idx,
+                 const int iter,
+                 std::vector<std::vector<bool> >& patch_is_active,
+                 int& num_active_patches) const;
 
     /*!
      * \brief Do one relaxation step over a patch.
@@ -128,6 +145,12 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Active set options.
+     */
+    bool d_enable_active_set;
+    int d_convergence_check_interval;
+
     /*!
      * \brief Copy constructor.
      *
@@ -120,6 +120,17 @@ public:
      */
     virtual void setPhysicalBoundaryHelper(SAMRAI::tbox::Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper);
 
+    /*!
+     * \brief Set whether to compute the action of the operator using the fused
+     * single-sweep kernel provided by IBTK::HierarchyMathOps::stokes() (the
+     * default) or by separate applications of the gradient, Laplace, and
+     * divergence operators.
+     *
+     * \note Both approaches yield the same result.  The unfused approach is
+     * retained mainly for verification.
+     */
+    void setUseFusedApply(bool use_fused_apply);
+
     /*!
      * \name Linear operator functionality.
      */
@@ -211,6 +222,15 @@ public:
     //\}
 
 protected:
+    /*!
+     * \brief Fill ghost cell values for the velocity and pressure components
+     * of the solution vector, storing the velocity in the scratch vector d_x.
+     *
+     * The cached ghost cell filling operator is reconfigured only when the
+     * patch data indices differ from those used in the previous fill.
+     */
+    void fillGhostCellValues(int U_idx, int P_idx);
+
     // Problem specification.
     SAMRAI::solv::PoissonSpecifications d_U_problem_coefs;
     SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_default_U_bc_coef;
@@ -226,6 +246,9 @@ protected:
     std::vector<IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent> d_transaction_comps;
     SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation> d_hier_bdry_fill, d_no_fill;
 
+    // Whether to use the fused implementation of the operator.
+    bool d_use_fused_apply;
+
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_x, d_b;
 
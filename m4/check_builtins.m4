@@ -32,4 +32,106 @@ AC_MSG_RESULT(yes)],[
 have_builtin_prefetch=0
 AC_MSG_RESULT(no)])
 AC_DEFINE_UNQUOTED(HAVE_BUILTIN_PREFETCH,$have_builtin_prefetch,[Boolean value indicating whether the C++ compiler supports the __builtin_prefetch keyword])
-])
\ No newline at end of file
+])
+
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CHECK_PTHREAD],[
+AC_MSG_CHECKING([for the flags required to use POSIX threads])
+have_pthread=no
+for pthread_flags in "-pthread" "-lpthread" "" ; do
+  pthread_save_CXXFLAGS="$CXXFLAGS"
+  pthread_save_LIBS="$LIBS"
+  case "$pthread_flags" in
+    -l*) LIBS="$pthread_flags $LIBS" ;;
+    -*) CXXFLAGS="$CXXFLAGS $pthread_flags" ; LIBS="$pthread_flags $LIBS" ;;
+  esac
+  AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#include <pthread.h>
+extern "C" void* pthread_test_routine(void*) { return 0; }
+]], [[
+    pthread_t thread;
+    if (pthread_create(&thread, 0, pthread_test_routine, 0) != 0) return 1;
+    pthread_join(thread, 0);
+]])],[have_pthread=yes])
+  if test "$have_pthread" = yes ; then
+    break
+  fi
+  CXXFLAGS="$pthread_save_CXXFLAGS"
+  LIBS="$pthread_save_LIBS"
+done
+if test "$have_pthread" = yes ; then
+  if test -z "$pthread_flags" ; then
+    AC_MSG_RESULT([none required])
+  else
+    AC_MSG_RESULT([$pthread_flags])
+  fi
+else
+  AC_MSG_RESULT([not found])
+  AC_MSG_ERROR([could not compile and link a program that uses POSIX threads])
+fi
+])
+
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CHECK_OPENMP],[
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING([--enable-openmp],[compile with OpenMP support (default is no)]),
+  [], [enable_openmp=no])
+if test "$enable_openmp" = yes ; then
+  AC_MSG_CHECKING([for the flags required to use OpenMP])
+  have_openmp=no
+  for openmp_flags in "-fopenmp" "-qopenmp" "-openmp" "-xopenmp" "-mp" ; do
+    openmp_save_CXXFLAGS="$CXXFLAGS"
+    openmp_save_LIBS="$LIBS"
+    CXXFLAGS="$CXXFLAGS $openmp_flags"
+    LIBS="$openmp_flags $LIBS"
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#ifndef _OPENMP
+#error OpenMP is not enabled
+#endif
+#include <omp.h>
+]], [[
+    return omp_get_num_threads() > 0 ? 0 : 1;
+]])],[have_openmp=yes])
+    if test "$have_openmp" = yes ; then
+      break
+    fi
+    CXXFLAGS="$openmp_save_CXXFLAGS"
+    LIBS="$openmp_save_LIBS"
+  done
+  if test "$have_openmp" = yes ; then
+    AC_MSG_RESULT([$openmp_flags])
+  else
+    AC_MSG_RESULT([not found])
+    AC_MSG_ERROR([--enable-openmp was specified, but the compiler does not support OpenMP])
+  fi
+  dnl The Fortran kernels are called concurrently from threaded patch loops.
+  dnl Compiling them with the OpenMP flag places their local variables on the
+  dnl stack, which makes them reentrant.
+  AC_MSG_CHECKING([for the flags required to use OpenMP with the Fortran compiler])
+  AC_LANG_PUSH(Fortran)
+  have_fc_openmp=no
+  for fc_openmp_flags in "-fopenmp" "-qopenmp" "-openmp" "-xopenmp" "-mp" ; do
+    fc_openmp_save_FCFLAGS="$FCFLAGS"
+    FCFLAGS="$FCFLAGS $fc_openmp_flags"
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([], [[
+      integer omp_get_num_threads
+      if (omp_get_num_threads() .lt. 1) stop 1
+]])],[have_fc_openmp=yes])
+    FCFLAGS="$fc_openmp_save_FCFLAGS"
+    if test "$have_fc_openmp" = yes ; then
+      break
+    fi
+  done
+  AC_LANG_POP(Fortran)
+  if test "$have_fc_openmp" = yes ; then
+    AC_MSG_RESULT([$fc_openmp_flags])
+    FCFLAGS="$FCFLAGS $fc_openmp_flags"
+    FFLAGS="$FFLAGS $fc_openmp_flags"
+  else
+    AC_MSG_RESULT([not found])
+    AC_MSG_ERROR([--enable-openmp was specified, but the Fortran compiler does not support OpenMP])
+  fi
+fi
+])
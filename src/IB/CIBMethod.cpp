@@ -74,6 +74,7 @@ CIBMethod::CIBMethod(const std::string& object_name,
 
 CIBMethod::~CIBMethod()
 {
+    clearVecArrayScatterPlans();
     return;
 } // ~CIBMethod
 
@@ -483,6 +484,7 @@ CIBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                        initial_time);
 
     // Set structure index info.
+    clearVecArrayScatterPlans();
     const int struct_ln = getStructuresLevelNumber();
     std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(struct_ln);
     std::sort(structIDs.begin(), structIDs.end());
@@ -580,6 +582,17 @@ CIBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // initializePatchHierarchy
 
+void
+CIBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                 Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
+{
+    IBMethod::endDataRedistribution(hierarchy, gridding_alg);
+
+    // The PETSc ordering of the Lagrangian nodes may have changed.
+    clearVecArrayScatterPlans();
+    return;
+} // endDataRedistribution
+
 void
 CIBMethod::interpolateVelocity(const int u_data_idx,
                                const std::vector<Pointer<CoarsenSchedule<NDIM> > >& u_synch_scheds,
@@ -1218,67 +1231,13 @@ CIBMethod::copyVecToArray(Vec b,
                           const int array_rank)
 {
     if (struct_ids.empty()) return;
-    const unsigned num_structs = static_cast<unsigned>(struct_ids.size());
-
-    // Get the Lagrangian indices of the structures.
-    std::vector<int> map;
-    PetscInt total_nodes = 0;
-    for (unsigned k = 0; k < num_structs; ++k)
-    {
-        total_nodes += getNumberOfNodes(struct_ids[k]);
-    }
-    map.reserve(total_nodes);
-    for (unsigned k = 0; k < num_structs; ++k)
-    {
-        const std::pair<int, int>& lag_idx_range = d_struct_lag_idx_range[struct_ids[k]];
-        const unsigned struct_nodes = getNumberOfNodes(struct_ids[k]);
-        for (unsigned j = 0; j < struct_nodes; ++j)
-        {
-            map.push_back(lag_idx_range.first + j);
-        }
-    }
 
-    // Map the Lagrangian indices into PETSc indices
-    const int struct_ln = getStructuresLevelNumber();
-    d_l_data_manager->mapLagrangianToPETSc(map, struct_ln);
-
-    // Wrap the raw data in a PETSc Vec
-    PetscInt size = total_nodes * data_depth;
-    int rank = SAMRAI_MPI::getRank();
-    PetscInt array_local_size = 0;
-    if (rank == array_rank) array_local_size = size;
-    Vec array_vec;
-    VecCreateMPIWithArray(PETSC_COMM_WORLD, /*blocksize*/ 1, array_local_size, PETSC_DECIDE, array, &array_vec);
-
-    // Create index sets to define global index mapping.
-    std::vector<PetscInt> vec_indices, array_indices;
-    vec_indices.reserve(size);
-    array_indices.reserve(size);
-    for (PetscInt j = 0; j < total_nodes; ++j)
-    {
-        PetscInt petsc_idx = map[j];
-        for (int d = 0; d < data_depth; ++d)
-        {
-            array_indices.push_back(j * data_depth + d);
-            vec_indices.push_back(petsc_idx * data_depth + d);
-        }
-    }
-    IS is_vec;
-    IS is_array;
-    ISCreateGeneral(PETSC_COMM_SELF, size, &vec_indices[0], PETSC_COPY_VALUES, &is_vec);
-    ISCreateGeneral(PETSC_COMM_SELF, size, &array_indices[0], PETSC_COPY_VALUES, &is_array);
-
-    // Scatter values
-    VecScatter ctx;
-    VecScatterCreate(b, is_vec, array_vec, is_array, &ctx);
-    VecScatterBegin(ctx, b, array_vec, INSERT_VALUES, SCATTER_FORWARD);
-    VecScatterEnd(ctx, b, array_vec, INSERT_VALUES, SCATTER_FORWARD);
-
-    // Cleanup temporary objects.
-    VecScatterDestroy(&ctx);
-    ISDestroy(&is_vec);
-    ISDestroy(&is_array);
-    VecDestroy(&array_vec);
+    // Scatter values using the cached plan.
+    VecArrayScatterPlan& plan = getVecArrayScatterPlan(b, struct_ids, data_depth, array_rank);
+    VecPlaceArray(plan.array_vec, array);
+    VecScatterBegin(plan.ctx, b, plan.array_vec, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(plan.ctx, b, plan.array_vec, INSERT_VALUES, SCATTER_FORWARD);
+    VecResetArray(plan.array_vec);
 
     return;
 } // copyVecToArray
@@ -1291,67 +1250,13 @@ CIBMethod::copyArrayToVec(Vec b,
                           const int array_rank)
 {
     if (struct_ids.empty()) return;
-    const unsigned num_structs = static_cast<unsigned>(struct_ids.size());
 
-    // Get the Lagrangian indices of the structures.
-    std::vector<int> map;
-    PetscInt total_nodes = 0;
-    for (unsigned k = 0; k < num_structs; ++k)
-    {
-        total_nodes += getNumberOfNodes(struct_ids[k]);
-    }
-    map.reserve(total_nodes);
-    for (unsigned k = 0; k < num_structs; ++k)
-    {
-        const std::pair<int, int>& lag_idx_range = d_struct_lag_idx_range[struct_ids[k]];
-        const unsigned struct_nodes = getNumberOfNodes(struct_ids[k]);
-        for (unsigned j = 0; j < struct_nodes; ++j)
-        {
-            map.push_back(lag_idx_range.first + j);
-        }
-    }
-
-    // Map the Lagrangian indices into PETSc indices
-    const int struct_ln = getStructuresLevelNumber();
-    d_l_data_manager->mapLagrangianToPETSc(map, struct_ln);
-
-    // Wrap the array in a PETSc Vec
-    PetscInt size = total_nodes * data_depth;
-    int rank = SAMRAI_MPI::getRank();
-    PetscInt array_local_size = 0;
-    if (rank == array_rank) array_local_size = size;
-    Vec array_vec;
-    VecCreateMPIWithArray(PETSC_COMM_WORLD, /*blocksize*/ 1, array_local_size, PETSC_DECIDE, array, &array_vec);
-
-    // Create index sets to define global index mapping.
-    std::vector<PetscInt> vec_indices, array_indices;
-    vec_indices.reserve(size);
-    array_indices.reserve(size);
-    for (PetscInt j = 0; j < total_nodes; ++j)
-    {
-        PetscInt petsc_idx = map[j];
-        for (int d = 0; d < data_depth; ++d)
-        {
-            array_indices.push_back(j * data_depth + d);
-            vec_indices.push_back(petsc_idx * data_depth + d);
-        }
-    }
-    IS is_vec;
-    IS is_array;
-    ISCreateGeneral(PETSC_COMM_SELF, size, &vec_indices[0], PETSC_COPY_VALUES, &is_vec);
-    ISCreateGeneral(PETSC_COMM_SELF, size, &array_indices[0], PETSC_COPY_VALUES, &is_array);
-
-    // Scatter values
-    VecScatter ctx;
-    VecScatterCreate(array_vec, is_array, b, is_vec, &ctx);
-    VecScatterBegin(ctx, array_vec, b, INSERT_VALUES, SCATTER_FORWARD);
-    VecScatterEnd(ctx, array_vec, b, INSERT_VALUES, SCATTER_FORWARD);
-
-    // Destroy temporary objects
-    VecScatterDestroy(&ctx);
-    ISDestroy(&is_vec);
-    ISDestroy(&is_array);
-    VecDestroy(&array_vec);
+    // Scatter values using the reverse of the cached plan.
+    VecArrayScatterPlan& plan = getVecArrayScatterPlan(b, struct_ids, data_depth, array_rank);
+    VecPlaceArray(plan.array_vec, array);
+    VecScatterBegin(plan.ctx, plan.array_vec, b, INSERT_VALUES, SCATTER_REVERSE);
+    VecScatterEnd(plan.ctx, plan.array_vec, b, INSERT_VALUES, SCATTER_REVERSE);
+    VecResetArray(plan.array_vec);
 
     return;
 } // copyArrayToVec
@@ -1418,7 +1323,7 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     {
         if (mat_type == RPY)
         {
-            MobilityFunctions::constructRPYMobilityMatrix(
+            MobilityFunctions::constructRPYMobilityMatrixBlocked(
                 ib_kernel, mu, grid_dx[0], &XW[0], num_nodes, f_periodic_corr, mobility_mat_data);
         }
         else if (mat_type == EMPIRICAL)
@@ -1913,6 +1818,103 @@ CIBMethod::setRegularizationWeight(const int level_number)
     return;
 } // setRegularizationWeight
 
+CIBMethod::VecArrayScatterPlan&
+CIBMethod::getVecArrayScatterPlan(Vec b,
+                                  const std::vector<unsigned>& struct_ids,
+                                  const int data_depth,
+                                  const int array_rank)
+{
+    PetscInt vec_local_size;
+    VecGetLocalSize(b, &vec_local_size);
+
+    // Reuse an existing plan.  Plans are invalidated on all processes whenever
+    // the Lagrangian data are redistributed (see clearVecArrayScatterPlans()),
+    // so that the (collective) decision to create a new plan is the same on
+    // all processes.
+    const VecArrayScatterKey key(struct_ids, std::make_pair(data_depth, array_rank));
+    std::map<VecArrayScatterKey, VecArrayScatterPlan>::iterator it = d_vec_array_scatter_plans.find(key);
+    if (it != d_vec_array_scatter_plans.end())
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(it->second.vec_local_size == vec_local_size);
+#endif
+        return it->second;
+    }
+
+    // Get the Lagrangian indices of the structures.
+    const unsigned num_structs = static_cast<unsigned>(struct_ids.size());
+    std::vector<int> map;
+    PetscInt total_nodes = 0;
+    for (unsigned k = 0; k < num_structs; ++k)
+    {
+        total_nodes += getNumberOfNodes(struct_ids[k]);
+    }
+    map.reserve(total_nodes);
+    for (unsigned k = 0; k < num_structs; ++k)
+    {
+        const std::pair<int, int>& lag_idx_range = d_struct_lag_idx_range[struct_ids[k]];
+        const unsigned struct_nodes = getNumberOfNodes(struct_ids[k]);
+        for (unsigned j = 0; j < struct_nodes; ++j)
+        {
+            map.push_back(lag_idx_range.first + j);
+        }
+    }
+
+    // Map the Lagrangian indices into PETSc indices
+    const int struct_ln = getStructuresLevelNumber();
+    d_l_data_manager->mapLagrangianToPETSc(map, struct_ln);
+
+    // Create a PETSc Vec without storage; the raw array is placed into it
+    // each time the plan is applied.
+    VecArrayScatterPlan plan;
+    plan.vec_local_size = vec_local_size;
+    PetscInt size = total_nodes * data_depth;
+    int rank = SAMRAI_MPI::getRank();
+    PetscInt array_local_size = 0;
+    if (rank == array_rank) array_local_size = size;
+    VecCreateMPIWithArray(PETSC_COMM_WORLD, /*blocksize*/ 1, array_local_size, PETSC_DECIDE, NULL, &plan.array_vec);
+
+    // Create index sets to define global index mapping.
+    std::vector<PetscInt> vec_indices, array_indices;
+    vec_indices.reserve(size);
+    array_indices.reserve(size);
+    for (PetscInt j = 0; j < total_nodes; ++j)
+    {
+        PetscInt petsc_idx = map[j];
+        for (int d = 0; d < data_depth; ++d)
+        {
+            array_indices.push_back(j * data_depth + d);
+            vec_indices.push_back(petsc_idx * data_depth + d);
+        }
+    }
+    IS is_vec;
+    IS is_array;
+    ISCreateGeneral(PETSC_COMM_SELF, size, &vec_indices[0], PETSC_COPY_VALUES, &is_vec);
+    ISCreateGeneral(PETSC_COMM_SELF, size, &array_indices[0], PETSC_COPY_VALUES, &is_array);
+
+    // Create the scatter.  The same context is used in reverse mode to copy
+    // data from the array to the Vec.
+    VecScatterCreate(b, is_vec, plan.array_vec, is_array, &plan.ctx);
+    ISDestroy(&is_vec);
+    ISDestroy(&is_array);
+
+    return d_vec_array_scatter_plans.insert(std::make_pair(key, plan)).first->second;
+} // getVecArrayScatterPlan
+
+void
+CIBMethod::clearVecArrayScatterPlans()
+{
+    for (std::map<VecArrayScatterKey, VecArrayScatterPlan>::iterator it = d_vec_array_scatter_plans.begin();
+         it != d_vec_array_scatter_plans.end();
+         ++it)
+    {
+        VecScatterDestroy(&it->second.ctx);
+        VecDestroy(&it->second.array_vec);
+    }
+    d_vec_array_scatter_plans.clear();
+    return;
+} // clearVecArrayScatterPlans
+
 void
 CIBMethod::setInitialLambda(const int level_number)
 {
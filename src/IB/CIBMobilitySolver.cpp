@@ -417,6 +417,74 @@ CIBMobilitySolver::solveBodyMobilitySystem(Vec x, Vec b)
     return converged;
 } // solveBodyMobilitySystem
 
+bool
+CIBMobilitySolver::solveMobilitySystems(const std::vector<Vec>& x, const std::vector<Vec>& b)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x.size() == b.size());
+#endif
+    if (b.empty()) return true;
+
+    IBAMR_TIMER_START(t_solve_mobility_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x[0], b[0]);
+
+    // Solve for x.
+    bool converged = false;
+    if (d_mobility_solver_type == KRYLOV)
+    {
+        converged = d_krylov_mob_solver->solveSystems(x, b);
+    }
+    else if (d_mobility_solver_type == DIRECT)
+    {
+        // The dense factorizations are reused for each right-hand side.
+        converged = true;
+        const double scale = 1.0 / (d_interp_scale * d_spread_scale);
+        for (unsigned int k = 0; k < b.size(); ++k)
+        {
+            converged = d_direct_mob_solver->solveSystem(x[k], b[k]) && converged;
+            VecScale(x[k], scale);
+        }
+    }
+    else
+    {
+        TBOX_ERROR("This statment should not be reached\n");
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBAMR_TIMER_STOP(t_solve_mobility_system);
+    return converged;
+} // solveMobilitySystems
+
+bool
+CIBMobilitySolver::solveBodyMobilitySystems(const std::vector<Vec>& x, const std::vector<Vec>& b)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x.size() == b.size());
+#endif
+    if (b.empty()) return true;
+
+    IBAMR_TIMER_START(t_solve_body_mobility_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x[0], b[0]);
+
+    // Solve for x.
+    bool converged = d_krylov_freebody_mob_solver->solveSystems(x, b);
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBAMR_TIMER_STOP(t_solve_body_mobility_system);
+
+    return converged;
+} // solveBodyMobilitySystems
+
 ////////////////////////////// PRIVATE ///////////////////////////////////////
 
 void
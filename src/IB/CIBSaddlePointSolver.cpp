@@ -49,6 +49,7 @@
 #include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
+#include "ibtk/PETScBlockKrylovSolver.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/ibtk_utilities.h"
@@ -76,6 +77,7 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 
 // Timers.
 static Timer* t_solve_system;
+static Timer* t_solve_systems;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
 } // anonymous
@@ -105,6 +107,7 @@ CIBSaddlePointSolver::CIBSaddlePointSolver(const std::string& object_name,
     d_scale_spread = 1.0;
     d_reg_mob_factor = 0.0;
     d_normalize_spread_force = false;
+    d_precompute_body_mobility = false;
     d_normalize_pressure = false;
     d_normalize_velocity = false;
     d_current_time = std::numeric_limits<double>::signaling_NaN();
@@ -303,6 +306,7 @@ CIBSaddlePointSolver::CIBSaddlePointSolver(const std::string& object_name,
     }
 
     IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBAMR::CIBSaddlePointSolver::solveSystem()");
+                 t_solve_systems = TimerManager::getManager()->getTimer("IBAMR::CIBSaddlePointSolver::solveSystems()");
                  t_initialize_solver_state =
                      TimerManager::getManager()->getTimer("IBAMR::CIBSaddlePointSolver::initializeSolverState()");
                  t_deallocate_solver_state =
@@ -443,6 +447,9 @@ CIBSaddlePointSolver::solveSystem(Vec x, Vec b)
     d_A->modifyRhsForBcs(d_petsc_b);
     d_A->setHomogeneousBc(true);
 
+    // Set up the body mobility used by the preconditioner.
+    if (d_precompute_body_mobility) initializeBodyMobility(x, b);
+
     // Solve the system.
     KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
@@ -460,6 +467,7 @@ CIBSaddlePointSolver::solveSystem(Vec x, Vec b)
 
     // Invalidate d_petsc_x Vec.
     d_petsc_x = NULL;
+    deallocateBodyMobility();
 
     // Deallocate the solver, when necessary.
     if (deallocate_after_solve) deallocateSolverState();
@@ -468,6 +476,67 @@ CIBSaddlePointSolver::solveSystem(Vec x, Vec b)
     return converged;
 } // solveSystem
 
+bool
+CIBSaddlePointSolver::solveSystems(const std::vector<Vec>& x, const std::vector<Vec>& b)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x.size() == b.size());
+#endif
+    if (b.empty()) return true;
+
+    IBTK_TIMER_START(t_solve_systems);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x[0], b[0]);
+
+    // Modify the RHS vectors for inhomogeneous Bcs.
+    const unsigned int num_systems = static_cast<unsigned int>(b.size());
+    std::vector<Vec> petsc_b(num_systems);
+    d_A->setHomogeneousBc(false);
+    for (unsigned int k = 0; k < num_systems; ++k)
+    {
+        VecDuplicate(b[k], &petsc_b[k]);
+        VecCopy(b[k], petsc_b[k]);
+        d_A->modifyRhsForBcs(petsc_b[k]);
+    }
+    d_A->setHomogeneousBc(true);
+
+    // Set up the body mobility used by the preconditioner.
+    if (d_precompute_body_mobility) initializeBodyMobility(x[0], b[0]);
+
+    // Solve the systems simultaneously using the operator, preconditioner, and
+    // convergence criteria of the PETSc KSP object.
+    IBTK::PETScBlockKrylovSolver block_solver(d_object_name + "::block_solver");
+    block_solver.setFromKSP(d_petsc_ksp);
+    block_solver.setLoggingEnabled(d_enable_logging);
+    const bool converged = block_solver.solveSystems(x, petsc_b);
+    d_current_iterations = block_solver.getNumIterations();
+    d_current_residual_norm = block_solver.getResidualNorm();
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystems(): " << (converged ? "converged" : "diverged") << " for "
+             << num_systems << " right-hand sides in " << d_current_iterations << " block iterations ("
+             << block_solver.getNumOperatorApplications() << " operator applications)\n";
+    }
+
+    deallocateBodyMobility();
+
+    // Impose solution Bcs.
+    d_A->setHomogeneousBc(false);
+    for (unsigned int k = 0; k < num_systems; ++k)
+    {
+        d_A->imposeSolBcs(x[k]);
+        VecDestroy(&petsc_b[k]);
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_systems);
+    return converged;
+} // solveSystems
+
 void
 CIBSaddlePointSolver::initializeSolverState(Vec x, Vec b)
 {
@@ -556,6 +625,7 @@ CIBSaddlePointSolver::deallocateSolverState()
     VecDestroy(&d_petsc_b);
     d_petsc_x = NULL;
     d_petsc_b = NULL;
+    deallocateBodyMobility();
 
     // Destroy the KSP solver.
     destroyKSP();
@@ -593,10 +663,83 @@ CIBSaddlePointSolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("regularize_mob_factor")) d_reg_mob_factor = input_db->getDouble("regularize_mob_factor");
     if (input_db->keyExists("normalize_spread_force"))
         d_normalize_spread_force = input_db->getBool("normalize_spread_force");
+    if (input_db->keyExists("precompute_body_mobility"))
+        d_precompute_body_mobility = input_db->getBool("precompute_body_mobility");
 
     return;
 } // getFromInput
 
+void
+CIBSaddlePointSolver::initializeBodyMobility(Vec x, Vec b)
+{
+    deallocateBodyMobility();
+
+    Vec *vx, *vb;
+    VecNestGetSubVecs(x, NULL, &vx);
+    VecNestGetSubVecs(b, NULL, &vb);
+    PetscInt num_free_dofs = 0;
+    VecGetSize(vx[2], &num_free_dofs);
+    if (!num_free_dofs) return;
+
+    // Set up the right-hand sides T* e_j, in which e_j is the j-th free rigid
+    // degree of freedom.
+    Vec e;
+    VecDuplicate(vx[2], &e);
+    std::vector<Vec> T_e(num_free_dofs);
+    d_body_mob_vecs.resize(num_free_dofs);
+    for (PetscInt j = 0; j < num_free_dofs; ++j)
+    {
+        VecSet(e, 0.0);
+        VecSetValue(e, j, 1.0, INSERT_VALUES);
+        VecAssemblyBegin(e);
+        VecAssemblyEnd(e);
+        VecDuplicate(vb[1], &T_e[j]);
+        VecSet(T_e[j], 0.0);
+        d_cib_strategy->setRigidBodyVelocity(e, T_e[j], /*only_free_dofs*/ true, /*only_imposed_dofs*/ false);
+        VecDuplicate(vx[1], &d_body_mob_vecs[j]);
+        VecSet(d_body_mob_vecs[j], 0.0);
+    }
+
+    // Z = M^-1 T*.  All right-hand sides share the mobility operator, so they
+    // are solved together.
+    d_mob_solver->solveMobilitySystems(d_body_mob_vecs, T_e);
+
+    // N = T Z, which is gathered on each process and factored.
+    Eigen::MatrixXd N(num_free_dofs, num_free_dofs);
+    Vec N_col_all;
+    VecScatter ctx;
+    VecScatterCreateToAll(e, &ctx, &N_col_all);
+    for (PetscInt j = 0; j < num_free_dofs; ++j)
+    {
+        d_cib_strategy->computeNetRigidGeneralizedForce(
+            d_body_mob_vecs[j], e, /*only_free_dofs*/ true, /*only_imposed_dofs*/ false);
+        VecScatterBegin(ctx, e, N_col_all, INSERT_VALUES, SCATTER_FORWARD);
+        VecScatterEnd(ctx, e, N_col_all, INSERT_VALUES, SCATTER_FORWARD);
+        const PetscScalar* N_col;
+        VecGetArrayRead(N_col_all, &N_col);
+        N.col(j) = Eigen::Map<const Eigen::VectorXd>(N_col, num_free_dofs);
+        VecRestoreArrayRead(N_col_all, &N_col);
+        VecDestroy(&T_e[j]);
+    }
+    d_body_mob_lu.compute(N);
+
+    VecScatterDestroy(&ctx);
+    VecDestroy(&N_col_all);
+    VecDestroy(&e);
+    return;
+} // initializeBodyMobility
+
+void
+CIBSaddlePointSolver::deallocateBodyMobility()
+{
+    for (unsigned int j = 0; j < d_body_mob_vecs.size(); ++j)
+    {
+        VecDestroy(&d_body_mob_vecs[j]);
+    }
+    d_body_mob_vecs.clear();
+    return;
+} // deallocateBodyMobility
+
 void
 CIBSaddlePointSolver::initializeKSP()
 {
@@ -1053,22 +1196,57 @@ CIBSaddlePointSolver::PCApply_SaddlePoint(PC pc, Vec x, Vec y)
                                                                 /*only_imposed_dofs*/ false);
         VecAXPY(F_tilde, 1.0, vx[2]);
 
-        // 3c) U_rigid = N^-1(F_tilde)
-        solver->d_mob_solver->solveBodyMobilitySystem(vy[2], F_tilde);
+        if (!solver->d_body_mob_vecs.empty())
+        {
+            // 3c) U_rigid = N^-1(F_tilde), using the precomputed body mobility
+            // matrix.
+            const int num_free_dofs = static_cast<int>(solver->d_body_mob_vecs.size());
+            Vec F_tilde_all;
+            VecScatter ctx;
+            VecScatterCreateToAll(F_tilde, &ctx, &F_tilde_all);
+            VecScatterBegin(ctx, F_tilde, F_tilde_all, INSERT_VALUES, SCATTER_FORWARD);
+            VecScatterEnd(ctx, F_tilde, F_tilde_all, INSERT_VALUES, SCATTER_FORWARD);
+            const PetscScalar* F_tilde_array;
+            VecGetArrayRead(F_tilde_all, &F_tilde_array);
+            const Eigen::VectorXd U_rigid =
+                solver->d_body_mob_lu.solve(Eigen::Map<const Eigen::VectorXd>(F_tilde_array, num_free_dofs));
+            VecRestoreArrayRead(F_tilde_all, &F_tilde_array);
+            PetscInt U_begin, U_end;
+            VecGetOwnershipRange(vy[2], &U_begin, &U_end);
+            PetscScalar* U_array;
+            VecGetArray(vy[2], &U_array);
+            for (PetscInt k = U_begin; k < U_end; ++k) U_array[k - U_begin] = U_rigid[k];
+            VecRestoreArray(vy[2], &U_array);
+            VecScatterDestroy(&ctx);
+            VecDestroy(&F_tilde_all);
+
+            // 3d-4) lambda = M^-1(T*(U_rigid) - U) = (M^-1 T*) U_rigid - M^-1(U)
+            VecScale(Lambda, -1.0);
+            VecMAXPY(Lambda, num_free_dofs, U_rigid.data(), &solver->d_body_mob_vecs[0]);
+        }
+        else
+        {
+            // 3c) U_rigid = N^-1(F_tilde)
+            solver->d_mob_solver->solveBodyMobilitySystem(vy[2], F_tilde);
+
+            // 3d) delU = T*(U_rigid) - U
+            VecSet(delU, 0.0);
+            solver->d_cib_strategy->setRigidBodyVelocity(
+                vy[2], delU, /*only_free_dofs*/ true, /*only_imposed_dofs*/ false);
+            VecAXPY(delU, -1.0, U);
 
-        // 3d) delU = T*(U_rigid) - U
-        VecSet(delU, 0.0);
-        solver->d_cib_strategy->setRigidBodyVelocity(vy[2], delU, /*only_free_dofs*/ true, /*only_imposed_dofs*/ false);
-        VecAXPY(delU, -1.0, U);
+            // 4) lambda  = M^-1(delta_U)
+            solver->d_mob_solver->solveMobilitySystem(Lambda, delU);
+        }
     }
     else
     {
         delU = U;
         VecScale(delU, -1.0);
-    }
 
-    // 4) lambda  = M^-1(delta_U)
-    solver->d_mob_solver->solveMobilitySystem(Lambda, delU);
+        // 4) lambda  = M^-1(delta_U)
+        solver->d_mob_solver->solveMobilitySystem(Lambda, delU);
+    }
 
     // 5) (u,p)   = L^-1(S[lambda]+g, h)
     const int g_data_idx = g_h->getComponentDescriptorIndex(0);
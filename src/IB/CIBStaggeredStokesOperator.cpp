@@ -119,9 +119,6 @@ CIBStaggeredStokesOperator::apply(Vec x, Vec y)
 {
     IBAMR_TIMER_START(t_apply);
 
-    // Allocate scratch data.
-    d_x->allocateVectorData();
-
     const double half_time = 0.5 * (d_new_time + d_current_time);
     Pointer<IBStrategy> ib_method_ops = d_cib_strategy;
 
@@ -156,50 +153,54 @@ CIBStaggeredStokesOperator::apply(Vec x, Vec y)
     Pointer<CellVariable<NDIM, double> > A_P_cc_var = g_f.getComponentVariable(1);
 
     // Simultaneously fill ghost cell values for u and p.
-    typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
-    std::vector<InterpolationTransactionComponent> transaction_comps(2);
-    transaction_comps[0] = InterpolationTransactionComponent(U_scratch_idx,
-                                                             U_idx,
-                                                             DATA_REFINE_TYPE,
-                                                             USE_CF_INTERPOLATION,
-                                                             DATA_COARSEN_TYPE,
-                                                             BDRY_EXTRAP_TYPE,
-                                                             CONSISTENT_TYPE_2_BDRY,
-                                                             d_U_bc_coefs,
-                                                             d_U_fill_pattern);
-    transaction_comps[1] = InterpolationTransactionComponent(P_idx,
-                                                             DATA_REFINE_TYPE,
-                                                             USE_CF_INTERPOLATION,
-                                                             DATA_COARSEN_TYPE,
-                                                             BDRY_EXTRAP_TYPE,
-                                                             CONSISTENT_TYPE_2_BDRY,
-                                                             d_P_bc_coef,
-                                                             d_P_fill_pattern);
-    d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
-    d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
-    StaggeredStokesPhysicalBoundaryHelper::setupBcCoefObjects(
-        d_U_bc_coefs, d_P_bc_coef, U_scratch_idx, P_idx, d_homogeneous_bc);
-    d_hier_bdry_fill->fillData(d_solution_time);
-    StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_U_bc_coefs, d_P_bc_coef);
-    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+    fillGhostCellValues(U_idx, P_idx);
 
     // Compute the action of the operator:
     // A*[u;p;U;L] := [A_u;A_p;A_U;A_L] = [(C*I+D*L)*u + Grad P - gamma*S L; -Div u; T L;
     //                                     -beta*J u + beta*T^{*} U -beta*delta*Reg*L]
 
-    // (a) Momentum equation.
-    d_hier_math_ops->grad(A_U_idx, A_U_sc_var, /*cf_bdry_synch*/ false, 1.0, P_idx, P_cc_var, d_no_fill, half_time);
-    d_hier_math_ops->laplace(A_U_idx,
-                             A_U_sc_var,
-                             d_U_problem_coefs,
+    // (a) Momentum equation and (b) divergence-free constraint.
+    if (d_use_fused_apply)
+    {
+        d_hier_math_ops->stokes(A_U_idx,
+                                A_U_sc_var,
+                                A_P_idx,
+                                A_P_cc_var,
+                                d_U_problem_coefs,
+                                U_scratch_idx,
+                                U_sc_var,
+                                P_idx,
+                                P_cc_var,
+                                d_no_fill,
+                                half_time,
+                                1.0,
+                                -1.0);
+    }
+    else
+    {
+        d_hier_math_ops->grad(
+            A_U_idx, A_U_sc_var, /*cf_bdry_synch*/ false, 1.0, P_idx, P_cc_var, d_no_fill, half_time);
+        d_hier_math_ops->laplace(A_U_idx,
+                                 A_U_sc_var,
+                                 d_U_problem_coefs,
+                                 U_scratch_idx,
+                                 U_sc_var,
+                                 d_no_fill,
+                                 half_time,
+                                 1.0,
+                                 A_U_idx,
+                                 A_U_sc_var);
+        d_hier_math_ops->div(A_P_idx,
+                             A_P_cc_var,
+                             -1.0,
                              U_scratch_idx,
                              U_sc_var,
                              d_no_fill,
                              half_time,
-                             1.0,
-                             A_U_idx,
-                             A_U_sc_var);
+                             /*cf_bdry_synch*/ true);
+    }
 
+    // Spread the constraint force.
     d_cib_strategy->setConstraintForce(L, half_time, -1.0 * d_scale_spread);
     ib_method_ops->spreadForce(A_U_idx, NULL, std::vector<Pointer<RefineSchedule<NDIM> > >(), half_time);
     if (d_normalize_spread_force)
@@ -207,15 +208,6 @@ CIBStaggeredStokesOperator::apply(Vec x, Vec y)
         d_cib_strategy->subtractMeanConstraintForce(L, A_U_idx, -1 * d_scale_spread);
     }
 
-    // (b) Divergence-free constraint.
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         half_time,
-                         /*cf_bdry_synch*/ true);
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
     // (c) Rigid body velocity constraint.
@@ -248,9 +240,6 @@ CIBStaggeredStokesOperator::apply(Vec x, Vec y)
     // Delete temporary vectors.
     VecDestroy(&Vrigid);
 
-    // Deallocate scratch data.
-    d_x->deallocateVectorData();
-
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vx[0], &vx0);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vy[0], &vy0);
 
@@ -269,6 +258,7 @@ CIBStaggeredStokesOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM,
     // Setup solution and rhs vectors.
     d_x = in.cloneVector(in.getName());
     d_b = out.cloneVector(out.getName());
+    d_x->allocateVectorData();
 
     // Setup the interpolation transaction information.
     d_U_fill_pattern = NULL;
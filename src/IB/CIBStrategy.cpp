@@ -801,6 +801,36 @@ CIBStrategy::getNewBodyCenterOfMass(const unsigned int part)
 
 } // getMidPointBodyCenterOfMass
 
+const Eigen::Vector3d&
+CIBStrategy::getInitialBodyCenterOfMass(const unsigned int part)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(part < d_num_rigid_parts);
+#endif
+    return d_center_of_mass_initial[part];
+
+} // getInitialBodyCenterOfMass
+
+const Eigen::Vector3d&
+CIBStrategy::getHalfBodyCenterOfMass(const unsigned int part)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(part < d_num_rigid_parts);
+#endif
+    return d_center_of_mass_half[part];
+
+} // getHalfBodyCenterOfMass
+
+const Eigen::Quaterniond&
+CIBStrategy::getHalfBodyQuaternion(const unsigned int part)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(part < d_num_rigid_parts);
+#endif
+    return d_quaternion_half[part];
+
+} // getHalfBodyQuaternion
+
 void
 CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
                                      MobilityMatrixType /*mat_type*/,
@@ -127,6 +127,7 @@ DirectMobilitySolver::DirectMobilitySolver(const std::string& object_name,
     // Some default values
     d_is_initialized = false;
     d_recompute_mob_mat = false;
+    d_mob_mat_reuse_tol = 1.0e-8;
     d_f_periodic_corr = 0.0;
 
     // Get from input
@@ -365,13 +366,14 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
         const int managing_proc = d_mat_proc_map[mat_name];
         const int mat_size = d_mat_nodes_map[mat_name] * data_depth;
         const int num_structs = static_cast<int>(struct_ids.size());
+        const bool use_reference_frame = d_mat_reference_frame_map[mat_name];
 
         for (int k = 0; k < num_structs; ++k)
         {
             double* rhs = NULL;
             if (rank == managing_proc) rhs = new double[mat_size];
             d_cib_strategy->copyVecToArray(b, rhs, struct_ids[k], data_depth, managing_proc);
-            if (!d_recompute_mob_mat)
+            if (use_reference_frame)
             {
                 d_cib_strategy->rotateArray(rhs,
                                             struct_ids[k],
@@ -380,7 +382,7 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             data_depth);
             }
             if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first, rhs);
-            if (!d_recompute_mob_mat)
+            if (use_reference_frame)
             {
                 d_cib_strategy->rotateArray(rhs,
                                             struct_ids[k],
@@ -421,13 +423,14 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
         const int mat_size = d_mat_parts_map[mat_name] * data_depth;
         const int managing_proc = d_mat_proc_map[mat_name];
         const int num_structs = static_cast<int>(struct_ids.size());
+        const bool use_reference_frame = d_mat_reference_frame_map[mat_name];
 
         for (int k = 0; k < num_structs; ++k)
         {
             double* rhs = NULL;
             if (rank == managing_proc) rhs = new double[mat_size];
             d_cib_strategy->copyFreeDOFsVecToArray(b, rhs, struct_ids[k], managing_proc);
-            if (!d_recompute_mob_mat)
+            if (use_reference_frame)
             {
                 d_cib_strategy->rotateArray(rhs,
                                             struct_ids[k],
@@ -436,7 +439,7 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
                                             data_depth);
             }
             if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].second, rhs);
-            if (!d_recompute_mob_mat)
+            if (use_reference_frame)
             {
                 d_cib_strategy->rotateArray(rhs,
                                             struct_ids[k],
@@ -464,11 +467,12 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
     int rank = SAMRAI_MPI::getRank();
     unsigned managed_mats = static_cast<unsigned>(d_mat_map.size());
 
-    static bool recreate_mobility_matrices = true;
     static std::vector<bool> read_files(managed_mats, false);
-    bool initial_time = !d_recompute_mob_mat;
 
-    if (recreate_mobility_matrices)
+    // Matrices only need to be examined when they have not been factorized
+    // yet or when they are to be recomputed as the structures move.
+    const bool all_mats_factorized = d_mat_reference_frame_map.size() == managed_mats;
+    if (!all_mats_factorized || d_recompute_mob_mat)
     {
         // Get grid-info
         Vec* vx;
@@ -481,6 +485,7 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
         Pointer<PatchLevel<NDIM> > struct_patch_level = patch_hierarchy->getPatchLevel(finest_ln);
         const IntVector<NDIM>& ratio = struct_patch_level->getRatio();
         Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_hierarchy->getGridGeometry();
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
         const double* dx0 = grid_geom->getDx();
         const double* X_upper = grid_geom->getXUpper();
         const double* X_lower = grid_geom->getXLower();
@@ -504,6 +509,21 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             const std::pair<double, double>& scale = d_mat_scale_map[mat_name];
             const int managing_proc = d_mat_proc_map[mat_name];
 
+            // Matrices factorized in the reference frame of the structures
+            // remain valid as long as the structures are rigidly displaced
+            // from their reference configuration; in that case only the
+            // right-hand sides and solutions need to be rotated.  Otherwise,
+            // the matrices are reconstructed for the current configuration.
+            const bool is_factorized = d_mat_reference_frame_map.find(mat_name) != d_mat_reference_frame_map.end();
+            bool use_reference_frame = true;
+            if (d_recompute_mob_mat)
+            {
+                use_reference_frame = d_mob_mat_reuse_tol >= 0.0 &&
+                                      isRigidlyDisplaced(mat_name, dx, domain_extents, periodic_shift);
+            }
+            if (is_factorized && use_reference_frame && d_mat_reference_frame_map[mat_name]) continue;
+            const bool initial_time = use_reference_frame;
+
             if (mat_type == READ_FROM_FILE && !read_files[file_counter])
             {
                 // Get the matrix from file.
@@ -537,14 +557,18 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             // Construct the geometric matrix that maps rigid body velocity to
             // nodal velocity.
             d_cib_strategy->constructGeometricMatrix(mat_name, geometric_mat, struct_ids, initial_time, managing_proc);
+
+            if (rank == managing_proc)
+            {
+                factorizeMobilityMatrix(mat_name);
+                constructBodyMobilityMatrix(mat_name);
+                factorizeBodyMobilityMatrix(mat_name);
+            }
+            d_mat_reference_frame_map[mat_name] = use_reference_frame;
         }
-        factorizeMobilityMatrix();
-        constructBodyMobilityMatrix();
-        factorizeBodyMobilityMatrix();
     }
 
     d_is_initialized = true;
-    recreate_mobility_matrices = d_recompute_mob_mat;
 
     IBAMR_TIMER_STOP(t_initialize_solver_state);
 
@@ -595,98 +619,117 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
+    d_mob_mat_reuse_tol = input_db->getDoubleWithDefault("mob_mat_reuse_tol", d_mob_mat_reuse_tol);
 
     return;
 } // getFromInput
 
 void
-DirectMobilitySolver::factorizeMobilityMatrix()
+DirectMobilitySolver::factorizeMobilityMatrix(const std::string& mat_name)
 {
-    int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
-    {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+    Mat& mat = d_petsc_mat_map[mat_name].first;
+    const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
+    const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
+    double* mat_data = NULL;
+    MatDenseGetArray(mat, &mat_data);
+    factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first, mat_name, "Mobility");
+    MatDenseRestoreArray(mat, &mat_data);
 
-        Mat& mat = d_petsc_mat_map[mat_name].first;
-        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
-        const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
-        double* mat_data = NULL;
-        MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first, mat_name, "Mobility");
-        MatDenseRestoreArray(mat, &mat_data);
-    }
     return;
-
 } // factorizeMobilityMatrix
 
 void
-DirectMobilitySolver::constructBodyMobilityMatrix()
+DirectMobilitySolver::constructBodyMobilityMatrix(const std::string& mat_name)
 {
-    int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
+    const int row_size = d_mat_nodes_map[mat_name] * NDIM;
+    const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
+    const MobilityMatrixInverseType& mobility_inv_type = d_mat_inv_type_map[mat_name].first;
+
+    Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
+    Mat& body_mob_mat = d_petsc_mat_map[mat_name].second;
+    Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
+
+    // Allocate a temporary matrix that holds the Matrix-Matrix product.
+    // Here we are multiplying inverse of mobility matrix with geometric matrix.
+    double* product_mat_data = new double[row_size * col_size];
+    Mat product_mat;
+    MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data, &product_mat);
+    MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
+
+    for (int col = 0; col < col_size; ++col)
     {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+        double* col_data;
+        MatDenseGetArray(product_mat, &col_data);
+        computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, &col_data[col * row_size]);
+        MatDenseRestoreArray(product_mat, &col_data);
+    }
+    MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
 
-        const int row_size = d_mat_nodes_map[mat_name] * NDIM;
-        const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
-        const MobilityMatrixInverseType& mobility_inv_type = d_mat_inv_type_map[mat_name].first;
+    MatDestroy(&product_mat);
+    delete[] product_mat_data;
 
-        Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
-        Mat& body_mob_mat = d_petsc_mat_map[mat_name].second;
-        Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
-
-        // Allocate a temporary matrix that holds the Matrix-Matrix product.
-        // Here we are multiplying inverse of mobility matrix with geometric matrix.
-        double* product_mat_data = new double[row_size * col_size];
-        Mat product_mat;
-        MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data, &product_mat);
-        MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
+    return;
+} // constructBodyMobilityMatrix
 
-        for (int col = 0; col < col_size; ++col)
-        {
-            double* col_data;
-            MatDenseGetArray(product_mat, &col_data);
-            computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, &col_data[col * row_size]);
-            MatDenseRestoreArray(product_mat, &col_data);
-        }
-        MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
+void
+DirectMobilitySolver::factorizeBodyMobilityMatrix(const std::string& mat_name)
+{
+    Mat& mat = d_petsc_mat_map[mat_name].second;
+    const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
+    const int mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
 
-        MatDestroy(&product_mat);
-        delete[] product_mat_data;
-    }
+    double* mat_data = NULL;
+    MatDenseGetArray(mat, &mat_data);
+    factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].second, mat_name, "Body Mobility");
+    MatDenseRestoreArray(mat, &mat_data);
 
     return;
-} // generateBodyFrictionMatrix
+} // factorizeBodyMobilityMatrix
 
-void
-DirectMobilitySolver::factorizeBodyMobilityMatrix()
+bool
+DirectMobilitySolver::isRigidlyDisplaced(const std::string& mat_name,
+                                         const double* dx,
+                                         const double* domain_extents,
+                                         const IntVector<NDIM>& periodic_shift)
 {
-    int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
+    const double dx_min = *std::min_element(dx, dx + NDIM);
+
+    // The factorization is shared by the prototypical structures and all of
+    // the structures registered with the matrix, so each group of structures
+    // must be rigidly displaced.
+    std::vector<std::vector<unsigned> > struct_groups = d_mat_actual_id_map[mat_name];
+    struct_groups.push_back(d_mat_prototype_id_map[mat_name]);
+    for (unsigned k = 0; k < struct_groups.size(); ++k)
     {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
-
-        Mat& mat = d_petsc_mat_map[mat_name].second;
-        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
-        const int mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
+        const std::vector<unsigned>& struct_ids = struct_groups[k];
+        if (struct_ids.size() < 2) continue;
+
+        // Compare the relative orientations and positions of the structures
+        // against those of the first structure of the group.
+        const unsigned base_id = struct_ids[0];
+        const Eigen::Matrix3d R_base = d_cib_strategy->getHalfBodyQuaternion(base_id).toRotationMatrix();
+        const Eigen::Vector3d& X0_base = d_cib_strategy->getInitialBodyCenterOfMass(base_id);
+        const Eigen::Vector3d& X_base = d_cib_strategy->getHalfBodyCenterOfMass(base_id);
+        for (unsigned j = 1; j < struct_ids.size(); ++j)
+        {
+            const unsigned struct_id = struct_ids[j];
+            const Eigen::Matrix3d R = d_cib_strategy->getHalfBodyQuaternion(struct_id).toRotationMatrix();
+            if ((R - R_base).norm() > d_mob_mat_reuse_tol) return false;
 
-        double* mat_data = NULL;
-        MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].second, mat_name, "Body Mobility");
-        MatDenseRestoreArray(mat, &mat_data);
+            const Eigen::Vector3d dX0 = d_cib_strategy->getInitialBodyCenterOfMass(struct_id) - X0_base;
+            Eigen::Vector3d dX = d_cib_strategy->getHalfBodyCenterOfMass(struct_id) - X_base - R_base * dX0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (periodic_shift(d))
+                {
+                    dX[d] -= domain_extents[d] * floor(dX[d] / domain_extents[d] + 0.5);
+                }
+            }
+            if (dX.norm() > d_mob_mat_reuse_tol * dx_min) return false;
+        }
     }
-    return;
-
-} // factorizeBodyMobilityMatrix
+    return true;
+} // isRigidlyDisplaced
 
 void
 DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
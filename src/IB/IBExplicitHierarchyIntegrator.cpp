@@ -60,6 +60,7 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
@@ -165,7 +166,9 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
                                     "use the same number of cycles,\n"
                                  << "  or that the IB solver use only a single cycle.\n");
     }
+    startWorkloadPhase(WorkloadCostModel::EULERIAN_PHASE);
     d_ins_hier_integrator->preprocessIntegrateHierarchy(current_time, new_time, ins_num_cycles);
+    stopWorkloadPhase(WorkloadCostModel::EULERIAN_PHASE);
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
     switch (d_time_stepping_type)
@@ -174,15 +177,19 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
     case BACKWARD_EULER:
     case TRAPEZOIDAL_RULE:
         if (d_enable_logging) plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
+        startWorkloadPhase(WorkloadCostModel::FORCE_PHASE);
         d_ib_method_ops->computeLagrangianForce(current_time);
+        stopWorkloadPhase(WorkloadCostModel::FORCE_PHASE);
         if (d_enable_logging)
             plog << d_object_name << "::preprocessIntegrateHierarchy(): spreading Lagrangian force "
                                      "to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
         d_u_phys_bdry_op->setHomogeneousBc(true);
+        startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), current_time);
+        stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_u_phys_bdry_op->setHomogeneousBc(false);
         if (d_f_current_idx != -1) d_hier_velocity_data_ops->copyData(d_f_current_idx, d_f_idx);
         break;
@@ -238,14 +245,18 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         break;
     case MIDPOINT_RULE:
         if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+        startWorkloadPhase(WorkloadCostModel::FORCE_PHASE);
         d_ib_method_ops->computeLagrangianForce(half_time);
+        stopWorkloadPhase(WorkloadCostModel::FORCE_PHASE);
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
         d_u_phys_bdry_op->setHomogeneousBc(true);
+        startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
+        stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_u_phys_bdry_op->setHomogeneousBc(false);
         break;
     case TRAPEZOIDAL_RULE:
@@ -253,14 +264,18 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         {
             // NOTE: We do not re-compute the force unless it could have changed.
             if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+            startWorkloadPhase(WorkloadCostModel::FORCE_PHASE);
             d_ib_method_ops->computeLagrangianForce(new_time);
+            stopWorkloadPhase(WorkloadCostModel::FORCE_PHASE);
             if (d_enable_logging)
                 plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
             d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
             d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
             d_u_phys_bdry_op->setHomogeneousBc(true);
+            startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
             d_ib_method_ops->spreadForce(
                 d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time);
+            stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
             d_u_phys_bdry_op->setHomogeneousBc(false);
             d_hier_velocity_data_ops->linearSum(d_f_idx, 0.5, d_f_current_idx, 0.5, d_f_idx);
         }
@@ -288,14 +303,17 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         d_hier_pressure_data_ops->setToScalar(d_q_idx, 0.0);
         // NOTE: This does not correctly treat the case in which the structure
         // is close to the physical boundary.
+        startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_ib_method_ops->spreadFluidSource(
             d_q_idx, NULL, getProlongRefineSchedules(d_object_name + "::q"), half_time);
+        stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
     }
 
     // Solve the incompressible Navier-Stokes equations.
     d_ib_method_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
     if (d_enable_logging)
         plog << d_object_name << "::integrateHierarchy(): solving the incompressible Navier-Stokes equations\n";
+    startWorkloadPhase(WorkloadCostModel::EULERIAN_PHASE);
     if (d_current_num_cycles > 1)
     {
         d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
@@ -311,6 +329,7 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
         }
     }
+    stopWorkloadPhase(WorkloadCostModel::EULERIAN_PHASE);
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
 
     // Interpolate the Eulerian velocity to the curvilinear mesh.
@@ -324,10 +343,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                                      "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
         d_u_phys_bdry_op->setHomogeneousBc(false);
+        startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              new_time);
+        stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         break;
     case MIDPOINT_RULE:
         d_hier_velocity_data_ops->linearSum(d_u_idx, 0.5, u_current_idx, 0.5, u_new_idx);
@@ -336,10 +357,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                                      "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
         d_u_phys_bdry_op->setHomogeneousBc(false);
+        startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              half_time);
+        stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         break;
     case TRAPEZOIDAL_RULE:
         d_hier_velocity_data_ops->copyData(d_u_idx, u_new_idx);
@@ -348,10 +371,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                                      "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
         d_u_phys_bdry_op->setHomogeneousBc(false);
+        startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              new_time);
+        stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         break;
     default:
         TBOX_ERROR(
@@ -409,10 +434,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         d_hier_pressure_data_ops->copyData(d_p_idx, p_new_idx);
         d_p_phys_bdry_op->setPatchDataIndex(d_p_idx);
         d_p_phys_bdry_op->setHomogeneousBc(false);
+        startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
         d_ib_method_ops->interpolatePressure(d_p_idx,
                                              getCoarsenSchedules(d_object_name + "::p::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::p"),
                                              half_time);
+        stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
     }
 
     // Execute any registered callbacks.
@@ -443,10 +470,12 @@ IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double curren
                                  "velocity to the Lagrangian mesh\n";
     d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
     d_u_phys_bdry_op->setHomogeneousBc(false);
+    startWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
     d_ib_method_ops->interpolateVelocity(d_u_idx,
                                          getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                          getGhostfillRefineSchedules(d_object_name + "::u"),
                                          new_time);
+    stopWorkloadPhase(WorkloadCostModel::INTERACTION_PHASE);
 
     // Synchronize new state data.
     if (!skip_synchronize_new_state_data)
@@ -489,8 +518,10 @@ IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double curren
 
     // Deallocate the fluid solver.
     const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
+    startWorkloadPhase(WorkloadCostModel::EULERIAN_PHASE);
     d_ins_hier_integrator->postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, ins_num_cycles);
+    stopWorkloadPhase(WorkloadCostModel::EULERIAN_PHASE);
 
     // Deallocate IB data.
     d_ib_method_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
@@ -509,6 +540,9 @@ IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double curren
         }
     }
 
+    // Indicate that the time step has been completed.
+    completeWorkloadTimeStep();
+
     // Execute any registered callbacks.
     executePostprocessIntegrateHierarchyCallbackFcns(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
@@ -0,0 +1,272 @@
+// Filename: IBFEBatchedStressFunctions.cpp
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <cmath>
+#include <vector>
+
+#include "ibamr/IBFEBatchedStressFunctions.h"
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/libmesh_utilities.h"
+#include "libmesh/point.h"
+#include "libmesh/tensor_value.h"
+#include "libmesh/vector_value.h"
+#include "tbox/Utilities.h"
+
+namespace libMesh
+{
+class Elem;
+} // namespace libMesh
+
+using namespace libMesh;
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Compute the inverse transpose FF^{-T} and the determinant J of FF.
+inline double
+inverse_transpose_and_det(double FF_inv_trans[NDIM][NDIM], const double FF[NDIM][NDIM])
+{
+#if (NDIM == 2)
+    const double J = FF[0][0] * FF[1][1] - FF[0][1] * FF[1][0];
+    const double J_inv = 1.0 / J;
+    FF_inv_trans[0][0] = FF[1][1] * J_inv;
+    FF_inv_trans[0][1] = -FF[1][0] * J_inv;
+    FF_inv_trans[1][0] = -FF[0][1] * J_inv;
+    FF_inv_trans[1][1] = FF[0][0] * J_inv;
+#endif
+#if (NDIM == 3)
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        const unsigned int i1 = (i + 1) % NDIM, i2 = (i + 2) % NDIM;
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            const unsigned int j1 = (j + 1) % NDIM, j2 = (j + 2) % NDIM;
+            FF_inv_trans[i][j] = FF[i1][j1] * FF[i2][j2] - FF[i1][j2] * FF[i2][j1];
+        }
+    }
+    const double J = FF[0][0] * FF_inv_trans[0][0] + FF[0][1] * FF_inv_trans[0][1] + FF[0][2] * FF_inv_trans[0][2];
+    const double J_inv = 1.0 / J;
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            FF_inv_trans[i][j] *= J_inv;
+        }
+    }
+#endif
+    return J;
+} // inverse_transpose_and_det
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+neo_hookean_PK1_stress_batch(double* const PP,
+                             const MeshFcnBatchData& batch_data,
+                             Elem* const /*elem*/,
+                             const double /*data_time*/,
+                             void* const ctx)
+{
+    const NeoHookeanStressParams* const params = static_cast<const NeoHookeanStressParams*>(ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(params);
+#endif
+    const double mu = params->mu;
+    const double lambda = params->lambda;
+    const unsigned int n_qp = batch_data.n_qp;
+    const double* const FF_vals = batch_data.FF;
+    double FF[NDIM][NDIM], FF_inv_trans[NDIM][NDIM];
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                FF[i][j] = FF_vals[(i * NDIM + j) * n_qp + qp];
+            }
+        }
+        const double J = inverse_transpose_and_det(FF_inv_trans, FF);
+        const double c = lambda * std::log(J) - mu;
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                PP[(i * NDIM + j) * n_qp + qp] = mu * FF[i][j] + c * FF_inv_trans[i][j];
+            }
+        }
+    }
+    return;
+} // neo_hookean_PK1_stress_batch
+
+void
+mooney_rivlin_PK1_stress_batch(double* const PP,
+                               const MeshFcnBatchData& batch_data,
+                               Elem* const /*elem*/,
+                               const double /*data_time*/,
+                               void* const ctx)
+{
+    const MooneyRivlinStressParams* const params = static_cast<const MooneyRivlinStressParams*>(ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(params);
+#endif
+    const double c1 = params->c1;
+    const double c2 = params->c2;
+    const double kappa = params->kappa;
+    const double p0 = 2.0 * c1 + 2.0 * static_cast<double>(NDIM - 1) * c2;
+    const unsigned int n_qp = batch_data.n_qp;
+    const double* const FF_vals = batch_data.FF;
+    double FF[NDIM][NDIM], FF_inv_trans[NDIM][NDIM], BB[NDIM][NDIM];
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                FF[i][j] = FF_vals[(i * NDIM + j) * n_qp + qp];
+            }
+        }
+        const double J = inverse_transpose_and_det(FF_inv_trans, FF);
+
+        // BB = FF FF^T, so that FF C = BB FF and I1 = tr(BB).
+        double I1 = 0.0;
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                double BB_ij = 0.0;
+                for (unsigned int k = 0; k < NDIM; ++k) BB_ij += FF[i][k] * FF[j][k];
+                BB[i][j] = BB_ij;
+            }
+            I1 += BB[i][i];
+        }
+        const double c = kappa * std::log(J) - p0;
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                double BB_FF_ij = 0.0;
+                for (unsigned int k = 0; k < NDIM; ++k) BB_FF_ij += BB[i][k] * FF[k][j];
+                PP[(i * NDIM + j) * n_qp + qp] =
+                    2.0 * (c1 + c2 * I1) * FF[i][j] - 2.0 * c2 * BB_FF_ij + c * FF_inv_trans[i][j];
+            }
+        }
+    }
+    return;
+} // mooney_rivlin_PK1_stress_batch
+
+void
+pointwise_PK1_stress_batch_adaptor(double* const PP,
+                                   const MeshFcnBatchData& batch_data,
+                                   Elem* const elem,
+                                   const double data_time,
+                                   void* const ctx)
+{
+    const PointwisePK1StressFcnAdaptor* const adaptor = static_cast<const PointwisePK1StressFcnAdaptor*>(ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(adaptor && adaptor->fcn);
+#endif
+    const unsigned int n_qp = batch_data.n_qp;
+    const size_t n_systems = batch_data.system_var_data.size();
+    std::vector<std::vector<double> > var_vals(n_systems);
+    std::vector<std::vector<VectorValue<double> > > grad_var_vals(n_systems);
+    std::vector<const std::vector<double>*> var_data(n_systems);
+    std::vector<const std::vector<VectorValue<double> >*> grad_var_data(n_systems);
+    for (unsigned int l = 0; l < n_systems; ++l)
+    {
+        var_vals[l].resize(batch_data.system_n_vars[l]);
+        grad_var_vals[l].resize(batch_data.system_n_grad_vars[l]);
+        var_data[l] = &var_vals[l];
+        grad_var_data[l] = &grad_var_vals[l];
+    }
+    TensorValue<double> PP_qp, FF;
+    libMesh::Point x, X;
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        FF.zero();
+        x.zero();
+        X.zero();
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            x(i) = batch_data.x[i * n_qp + qp];
+            X(i) = batch_data.X[i * n_qp + qp];
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                FF(i, j) = batch_data.FF[(i * NDIM + j) * n_qp + qp];
+            }
+        }
+        for (unsigned int i = NDIM; i < LIBMESH_DIM; ++i)
+        {
+            FF(i, i) = 1.0;
+        }
+        for (unsigned int l = 0; l < n_systems; ++l)
+        {
+            for (unsigned int v = 0; v < var_vals[l].size(); ++v)
+            {
+                var_vals[l][v] = batch_data.system_var_data[l][v * n_qp + qp];
+            }
+            for (unsigned int v = 0; v < grad_var_vals[l].size(); ++v)
+            {
+                grad_var_vals[l][v].zero();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    grad_var_vals[l][v](d) = batch_data.system_grad_var_data[l][(v * NDIM + d) * n_qp + qp];
+                }
+            }
+        }
+        adaptor->fcn(PP_qp, FF, x, X, elem, var_data, grad_var_data, data_time, adaptor->ctx);
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                PP[(i * NDIM + j) * n_qp + qp] = PP_qp(i, j);
+            }
+        }
+    }
+    return;
+} // pointwise_PK1_stress_batch_adaptor
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
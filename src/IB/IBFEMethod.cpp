@@ -70,10 +70,13 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/FEDataInterpolation.h"
 #include "ibtk/FEDataManager.h"
+#include "ibtk/FEPatchPartitioner.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/PhaseProfiler.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/auto_ptr.h"
@@ -221,6 +224,192 @@ get_x_and_FF(libMesh::VectorValue<double>& x,
     return;
 }
 
+// Structure-of-arrays storage for the quadrature point data that are passed
+// to batched PK1 stress functions.
+class PK1StressBatch
+{
+public:
+    // Collect the data at the quadrature points of the current element (or
+    // element side).
+    void pack(const std::vector<libMesh::Point>& q_point,
+              const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data,
+              const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data,
+              const size_t X_sys_idx,
+              const std::vector<size_t>& system_idxs,
+              const unsigned int n_qp)
+    {
+        resize(n_qp, system_idxs.size());
+        for (unsigned int qp = 0; qp < n_qp; ++qp)
+        {
+            const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+            const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+            for (unsigned int i = 0; i < NDIM; ++i)
+            {
+                d_x[i * n_qp + qp] = x_data[i];
+                d_X[i * n_qp + qp] = q_point[qp](i);
+                for (unsigned int j = 0; j < NDIM; ++j)
+                {
+                    d_FF[(i * NDIM + j) * n_qp + qp] = grad_x_data[i](j);
+                }
+            }
+        }
+        for (unsigned int l = 0; l < system_idxs.size(); ++l)
+        {
+            const size_t sys_idx = system_idxs[l];
+            const unsigned int n_vars = n_qp > 0 ? fe_interp_var_data[0][sys_idx].size() : 0;
+            const unsigned int n_grad_vars = n_qp > 0 ? fe_interp_grad_var_data[0][sys_idx].size() : 0;
+            d_var_vals[l].resize(n_vars * n_qp);
+            d_grad_var_vals[l].resize(n_grad_vars * NDIM * n_qp);
+            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            {
+                const std::vector<double>& var_data = fe_interp_var_data[qp][sys_idx];
+                for (unsigned int v = 0; v < n_vars; ++v)
+                {
+                    d_var_vals[l][v * n_qp + qp] = var_data[v];
+                }
+                const std::vector<VectorValue<double> >& grad_var_data = fe_interp_grad_var_data[qp][sys_idx];
+                for (unsigned int v = 0; v < n_grad_vars; ++v)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        d_grad_var_vals[l][(v * NDIM + d) * n_qp + qp] = grad_var_data[v](d);
+                    }
+                }
+            }
+            d_batch_data.system_n_vars[l] = n_vars;
+            d_batch_data.system_n_grad_vars[l] = n_grad_vars;
+        }
+        setPointers();
+        return;
+    }
+
+    // Collect the data at a single point.
+    void pack(const TensorValue<double>& FF,
+              const libMesh::Point& x,
+              const libMesh::Point& X,
+              const std::vector<const std::vector<double>*>& var_data,
+              const std::vector<const std::vector<VectorValue<double> >*>& grad_var_data)
+    {
+        resize(1, var_data.size());
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            d_x[i] = x(i);
+            d_X[i] = X(i);
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                d_FF[i * NDIM + j] = FF(i, j);
+            }
+        }
+        for (unsigned int l = 0; l < var_data.size(); ++l)
+        {
+            const unsigned int n_vars = var_data[l] ? var_data[l]->size() : 0;
+            const unsigned int n_grad_vars = grad_var_data[l] ? grad_var_data[l]->size() : 0;
+            d_var_vals[l].resize(n_vars);
+            d_grad_var_vals[l].resize(n_grad_vars * NDIM);
+            for (unsigned int v = 0; v < n_vars; ++v)
+            {
+                d_var_vals[l][v] = (*var_data[l])[v];
+            }
+            for (unsigned int v = 0; v < n_grad_vars; ++v)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_grad_var_vals[l][v * NDIM + d] = (*grad_var_data[l])[v](d);
+                }
+            }
+            d_batch_data.system_n_vars[l] = n_vars;
+            d_batch_data.system_n_grad_vars[l] = n_grad_vars;
+        }
+        setPointers();
+        return;
+    }
+
+    // Evaluate the batched stress function at all of the packed points.
+    void evaluate(const IBFEMethod::PK1StressBatchFcnPtr batch_fcn, Elem* const elem, const double data_time, void* ctx)
+    {
+        if (d_batch_data.n_qp == 0) return;
+        batch_fcn(&d_PP[0], d_batch_data, elem, data_time, ctx);
+        return;
+    }
+
+    // Extract the stress tensor at the specified point.
+    void getStress(TensorValue<double>& PP, const unsigned int qp) const
+    {
+        const unsigned int n_qp = d_batch_data.n_qp;
+        PP.zero();
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                PP(i, j) = d_PP[(i * NDIM + j) * n_qp + qp];
+            }
+        }
+        return;
+    }
+
+private:
+    void resize(const unsigned int n_qp, const size_t n_systems)
+    {
+        d_batch_data.n_qp = n_qp;
+        d_FF.resize(NDIM * NDIM * n_qp);
+        d_PP.resize(NDIM * NDIM * n_qp);
+        d_x.resize(NDIM * n_qp);
+        d_X.resize(NDIM * n_qp);
+        d_var_vals.resize(n_systems);
+        d_grad_var_vals.resize(n_systems);
+        d_batch_data.system_n_vars.resize(n_systems);
+        d_batch_data.system_n_grad_vars.resize(n_systems);
+        d_batch_data.system_var_data.resize(n_systems);
+        d_batch_data.system_grad_var_data.resize(n_systems);
+        return;
+    }
+
+    void setPointers()
+    {
+        const bool empty = d_batch_data.n_qp == 0;
+        d_batch_data.FF = empty ? NULL : &d_FF[0];
+        d_batch_data.x = empty ? NULL : &d_x[0];
+        d_batch_data.X = empty ? NULL : &d_X[0];
+        for (unsigned int l = 0; l < d_var_vals.size(); ++l)
+        {
+            d_batch_data.system_var_data[l] = d_var_vals[l].empty() ? NULL : &d_var_vals[l][0];
+            d_batch_data.system_grad_var_data[l] = d_grad_var_vals[l].empty() ? NULL : &d_grad_var_vals[l][0];
+        }
+        return;
+    }
+
+    MeshFcnBatchData d_batch_data;
+    std::vector<double> d_FF, d_PP, d_x, d_X;
+    std::vector<std::vector<double> > d_var_vals, d_grad_var_vals;
+};
+
+// Evaluate a PK1 stress function at a single point, using the batched
+// interface when no pointwise function is available.
+inline void
+evaluate_PK1_stress(TensorValue<double>& PP,
+                    const IBFEMethod::PK1StressFcnData& fcn_data,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& x,
+                    const libMesh::Point& X,
+                    Elem* const elem,
+                    const std::vector<const std::vector<double>*>& var_data,
+                    const std::vector<const std::vector<VectorValue<double> >*>& grad_var_data,
+                    const double data_time,
+                    PK1StressBatch& batch)
+{
+    if (fcn_data.fcn)
+    {
+        fcn_data.fcn(PP, FF, x, X, elem, var_data, grad_var_data, data_time, fcn_data.ctx);
+    }
+    else
+    {
+        batch.pack(FF, x, X, var_data, grad_var_data);
+        batch.evaluate(fcn_data.batch_fcn, elem, data_time, fcn_data.ctx);
+        batch.getStress(PP, 0);
+    }
+    return;
+}
+
 static const Real PENALTY = 1.e10;
 
 void
@@ -671,6 +860,7 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
                                 const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                 const double data_time)
 {
+    IBTK_PROFILER_SCOPE("IBFEMethod::interpolateVelocity");
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
         NumericVector<double>* X_vec = NULL;
@@ -758,6 +948,7 @@ IBFEMethod::trapezoidalStep(const double current_time, const double new_time)
 void
 IBFEMethod::computeLagrangianForce(const double data_time)
 {
+    IBTK_PROFILER_SCOPE("IBFEMethod::computeLagrangianForce");
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     for (unsigned part = 0; part < d_num_parts; ++part)
     {
@@ -776,6 +967,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
                         const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
                         const double data_time)
 {
+    IBTK_PROFILER_SCOPE("IBFEMethod::spreadForce");
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
@@ -1164,10 +1356,7 @@ IBFEMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
     d_gridding_alg = gridding_alg;
 
     // Initialize the FE data manager.
-    for (unsigned int part = 0; part < d_num_parts; ++part)
-    {
-        d_fe_data_managers[part]->reinitElementMappings();
-    }
+    reinitElementMappings();
 
     d_is_initialized = true;
     return;
@@ -1197,6 +1386,38 @@ IBFEMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/
     return;
 } // updateWorkloadEstimates
 
+void
+IBFEMethod::setWorkloadWeights(double /*node_weight*/, const double quad_point_weight)
+{
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        d_fe_data_managers[part]->setQuadPointWorkloadWeight(quad_point_weight);
+    }
+    return;
+} // setWorkloadWeights
+
+void
+IBFEMethod::getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const
+{
+    num_local_nodes = 0.0;
+    num_local_quad_points = 0.0;
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        num_local_quad_points += d_fe_data_managers[part]->getNumberOfLocalQuadPoints();
+    }
+    return;
+} // getLocalWorkloadCounts
+
+void
+IBFEMethod::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        d_fe_data_managers[part]->registerWorkloadCostModel(workload_cost_model);
+    }
+    return;
+} // registerWorkloadCostModel
+
 void IBFEMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                          Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -1209,10 +1430,7 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
 {
     if (d_is_initialized)
     {
-        for (unsigned int part = 0; part < d_num_parts; ++part)
-        {
-            d_fe_data_managers[part]->reinitElementMappings();
-        }
+        reinitElementMappings();
     }
     return;
 } // endDataRedistribution
@@ -1366,6 +1584,7 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
 
     std::vector<std::vector<const std::vector<double>*> > PK1_var_data(num_PK1_fcns);
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
+    PK1StressBatch PK1_batch;
     std::vector<const std::vector<double> *> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> > *> surface_force_grad_var_data, surface_pressure_grad_var_data;
 
@@ -1429,22 +1648,23 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
                         // traction force to the right-hand-side vector.
                         fe.setInterpolatedDataPointers(
                             PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data[k],
-                                                           PK1_grad_var_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
+                        evaluate_PK1_stress(PP,
+                                            d_PK1_stress_fcn_data[part][k],
+                                            FF,
+                                            x,
+                                            X,
+                                            elem,
+                                            PK1_var_data[k],
+                                            PK1_grad_var_data[k],
+                                            data_time,
+                                            PK1_batch);
                         Phi += n * ((PP * FF_trans) * n) / J;
                     }
                 }
@@ -1538,7 +1758,9 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     const size_t num_PK1_fcns = d_PK1_stress_fcn_data[part].size();
     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        const PK1StressFcnData& PK1_stress_fcn_data = d_PK1_stress_fcn_data[part][k];
+        if (!PK1_stress_fcn_data.fcn && !PK1_stress_fcn_data.batch_fcn) continue;
+        const bool use_batch_fcn = PK1_stress_fcn_data.batch_fcn != NULL;
 
         // Extract the FE systems and DOF maps, and setup the FE object.
         System& G_system = equation_systems->get_system(FORCE_SYSTEM_NAME);
@@ -1589,6 +1811,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
 
         std::vector<const std::vector<double>*> PK1_var_data;
         std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+        PK1StressBatch PK1_batch;
 
         // Loop over the elements to compute the right-hand side vector.  This
         // is computed via
@@ -1614,19 +1837,33 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
             fe.interpolate(elem);
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = dphi.size();
+            if (use_batch_fcn)
+            {
+                // Evaluate the stress at all of the quadrature points of the
+                // element at once.
+                PK1_batch.pack(
+                    q_point, fe_interp_var_data, fe_interp_grad_var_data, X_sys_idx, PK1_fcn_system_idxs, n_qp);
+                PK1_batch.evaluate(PK1_stress_fcn_data.batch_fcn, elem, data_time, PK1_stress_fcn_data.ctx);
+            }
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
-                const libMesh::Point& X = q_point[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
-
                 // Compute the value of the first Piola-Kirchhoff stress tensor
                 // at the quadrature point and add the corresponding forces to
                 // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, d_PK1_stress_fcn_data[part][k].ctx);
+                if (use_batch_fcn)
+                {
+                    PK1_batch.getStress(PP, qp);
+                }
+                else
+                {
+                    const libMesh::Point& X = q_point[qp];
+                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                    get_x_and_FF(x, FF, x_data, grad_x_data);
+                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    PK1_stress_fcn_data.fcn(
+                        PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, PK1_stress_fcn_data.ctx);
+                }
                 for (unsigned int k = 0; k < n_basis; ++k)
                 {
                     F_qp = -PP * dphi[k][qp] * JxW[qp];
@@ -1656,6 +1893,16 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
                 fe.interpolate(elem, side);
                 const unsigned int n_qp = qrule_face->n_points();
                 const size_t n_basis = phi_face.size();
+                if (use_batch_fcn)
+                {
+                    PK1_batch.pack(q_point_face,
+                                   fe_interp_var_data,
+                                   fe_interp_grad_var_data,
+                                   X_sys_idx,
+                                   PK1_fcn_system_idxs,
+                                   n_qp);
+                    PK1_batch.evaluate(PK1_stress_fcn_data.batch_fcn, elem, data_time, PK1_stress_fcn_data.ctx);
+                }
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
                     const libMesh::Point& X = q_point_face[qp];
@@ -1669,20 +1916,17 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
                     // Compute the value of the first Piola-Kirchhoff stress
                     // tensor at the quadrature point and add the corresponding
                     // traction force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (use_batch_fcn)
+                    {
+                        PK1_batch.getStress(PP, qp);
+                    }
+                    else
                     {
                         fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data,
-                                                           PK1_grad_var_data,
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
+                        PK1_stress_fcn_data.fcn(
+                            PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, PK1_stress_fcn_data.ctx);
                     }
+                    F += PP * normal_face[qp];
 
                     n = (FF_inv_trans * normal_face[qp]).unit();
 
@@ -2045,6 +2289,7 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
     std::vector<std::vector<const std::vector<double>*> > PK1_var_data(num_PK1_fcns);
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
+    PK1StressBatch PK1_batch;
     std::vector<const std::vector<double> *> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> > *> surface_force_grad_var_data, surface_pressure_grad_var_data;
 
@@ -2122,22 +2367,23 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            evaluate_PK1_stress(PP,
+                                                d_PK1_stress_fcn_data[part][k],
+                                                FF,
+                                                x,
+                                                X,
+                                                elem,
+                                                PK1_var_data[k],
+                                                PK1_grad_var_data[k],
+                                                data_time,
+                                                PK1_batch);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -2297,6 +2543,7 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
     std::vector<std::vector<const std::vector<double>*> > PK1_var_data(num_PK1_fcns);
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
+    PK1StressBatch PK1_batch;
     std::vector<const std::vector<double> *> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> > *> surface_force_grad_var_data, surface_pressure_grad_var_data;
 
@@ -2490,22 +2737,23 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            evaluate_PK1_stress(PP,
+                                                d_PK1_stress_fcn_data[part][k],
+                                                FF,
+                                                x,
+                                                X,
+                                                elem,
+                                                PK1_var_data[k],
+                                                PK1_grad_var_data[k],
+                                                data_time,
+                                                PK1_batch);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -2726,6 +2974,9 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     d_split_tangential_force = false;
     d_use_jump_conditions = false;
     d_use_consistent_mass_matrix = true;
+    d_use_patch_aligned_partitioning = false;
+    d_patch_aligned_partitioning_max_imbalance = 0.1;
+    d_repartitioning_threshold = 0.1;
     d_do_log = false;
 
     d_fe_family.resize(d_num_parts, INVALID_FE);
@@ -2908,6 +3159,13 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
         d_libmesh_restart_file_extension = "xdr";
     }
 
+    // Partitioning settings.
+    if (db->isBool("use_patch_aligned_partitioning"))
+        d_use_patch_aligned_partitioning = db->getBool("use_patch_aligned_partitioning");
+    if (db->isDouble("patch_aligned_partitioning_max_imbalance"))
+        d_patch_aligned_partitioning_max_imbalance = db->getDouble("patch_aligned_partitioning_max_imbalance");
+    if (db->isDouble("repartitioning_threshold")) d_repartitioning_threshold = db->getDouble("repartitioning_threshold");
+
     // Other settings.
     if (db->isInteger("min_ghost_cell_width"))
     {
@@ -2954,6 +3212,29 @@ IBFEMethod::getFromRestart()
     return;
 } // getFromRestart
 
+void
+IBFEMethod::reinitElementMappings()
+{
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        if (d_use_patch_aligned_partitioning)
+        {
+            FEPatchPartitioner partitioner(d_fe_data_managers[part], d_patch_aligned_partitioning_max_imbalance);
+            MeshBase& mesh = d_equation_systems[part]->get_mesh();
+            const double misaligned_fraction = partitioner.computeMisalignedElementFraction(mesh);
+            if (misaligned_fraction > d_repartitioning_threshold)
+            {
+                if (d_do_log)
+                    plog << d_object_name << "::reinitElementMappings(): repartitioning mesh part " << part
+                         << "; fraction of misaligned elements = " << misaligned_fraction << "\n";
+                d_fe_data_managers[part]->repartitionMesh(partitioner);
+            }
+        }
+        d_fe_data_managers[part]->reinitElementMappings();
+    }
+    return;
+} // reinitElementMappings
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
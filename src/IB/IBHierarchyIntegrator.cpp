@@ -74,6 +74,7 @@
 #include "ibtk/LMarkerSetVariable.h"
 #include "ibtk/LMarkerUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -288,6 +289,10 @@ IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM
     d_ib_method_ops->registerEulerianVariables();
     d_ib_method_ops->registerEulerianCommunicationAlgorithms();
 
+    // Have the IB method ops object report the synchronizing operations in the
+    // Lagrangian parts of the time step to the workload cost model.
+    if (d_workload_cost_model) d_ib_method_ops->registerWorkloadCostModel(d_workload_cost_model);
+
     // Create several communications algorithms, used in filling ghost cell data
     // and synchronizing data on the patch hierarchy.
     Pointer<Geometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
@@ -459,6 +464,23 @@ IBHierarchyIntegrator::regridHierarchy()
         if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): updating workload estimates\n";
         d_hier_cc_data_ops->setToScalar(d_workload_idx, 1.0);
         d_ib_method_ops->updateWorkloadEstimates(d_hierarchy, d_workload_idx);
+
+        // Update the fitted costs using the times measured since the last
+        // regrid, and recompute the workload estimates using these costs.
+        if (d_workload_cost_model)
+        {
+            double num_local_nodes, num_local_quad_points;
+            d_ib_method_ops->getLocalWorkloadCounts(num_local_nodes, num_local_quad_points);
+            d_workload_cost_model->updateCostCoefficients(
+                WorkloadCostModel::computeNumberOfLocalCells(d_hierarchy), num_local_nodes, num_local_quad_points);
+            if (d_workload_cost_model->hasCostCoefficients())
+            {
+                d_ib_method_ops->setWorkloadWeights(d_workload_cost_model->getLagrangianNodeWorkloadWeight(),
+                                                    d_workload_cost_model->getQuadPointWorkloadWeight());
+                d_hier_cc_data_ops->setToScalar(d_workload_idx, 1.0);
+                d_ib_method_ops->updateWorkloadEstimates(d_hierarchy, d_workload_idx);
+            }
+        }
     }
 
     // Collect the marker particles to level 0 of the patch hierarchy.
@@ -486,6 +508,13 @@ IBHierarchyIntegrator::regridHierarchy()
         LMarkerUtilities::pruneInvalidMarkers(d_mark_current_idx, d_hierarchy);
     }
 
+    // Report the load imbalance predicted by the workload estimates on the new
+    // patch hierarchy.
+    if (d_load_balancer && d_workload_cost_model)
+    {
+        d_workload_cost_model->reportPredictedImbalance(d_hierarchy, d_workload_idx);
+    }
+
     // Reset the regrid CFL estimate.
     d_regrid_cfl_estimate = 0.0;
     return;
@@ -654,6 +683,27 @@ IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     return;
 } // putToDatabaseSpecialized
 
+void
+IBHierarchyIntegrator::startWorkloadPhase(const WorkloadCostModel::Phase phase)
+{
+    if (d_workload_cost_model) d_workload_cost_model->startPhase(phase);
+    return;
+} // startWorkloadPhase
+
+void
+IBHierarchyIntegrator::stopWorkloadPhase(const WorkloadCostModel::Phase phase)
+{
+    if (d_workload_cost_model) d_workload_cost_model->stopPhase(phase);
+    return;
+} // stopWorkloadPhase
+
+void
+IBHierarchyIntegrator::completeWorkloadTimeStep()
+{
+    if (d_workload_cost_model) d_workload_cost_model->completeTimeStep();
+    return;
+} // completeWorkloadTimeStep
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -677,6 +727,13 @@ IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart
     else if (db->keyExists("timestepping_type"))
         d_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("timestepping_type"));
     if (db->keyExists("marker_file_name")) d_mark_file_name = db->getString("marker_file_name");
+    if (db->keyExists("use_measured_workload_costs") && db->getBool("use_measured_workload_costs"))
+    {
+        d_workload_cost_model =
+            new WorkloadCostModel(d_object_name + "::WorkloadCostModel",
+                                  db->isDatabase("WorkloadCostModel") ? db->getDatabase("WorkloadCostModel") :
+                                                                        Pointer<Database>());
+    }
     return;
 } // getFromInput
 
@@ -165,6 +165,14 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
         if (input_db->keyExists("jacobian_delta_fcn")) d_jac_delta_fcn = input_db->getString("jacobian_delta_fcn");
     }
 
+    // The phases of the implicit time step are not timed separately, so that
+    // the measured workload costs cannot be determined.
+    if (d_workload_cost_model)
+    {
+        TBOX_ERROR(d_object_name << "::IBImplicitStaggeredHierarchyIntegrator():\n"
+                                 << "  use_measured_workload_costs is not supported by this integrator" << std::endl);
+    }
+
     if (d_use_structure_predictor)
     {
         pout << "WARNING: explicit predictor for the structural configuration appears to be nonlinearly unstable!\n";
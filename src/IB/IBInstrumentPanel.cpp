@@ -38,14 +38,13 @@
 #include <algorithm>
 #include <fstream>
 #include <limits>
-#include <map>
 #include <string>
-#include <utility>
 #include <vector>
 
 #include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -57,6 +56,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SideData.h"
 #include "SideIndex.h"
 #include "boost/array.hpp"
@@ -73,6 +73,7 @@
 #include "ibtk/LNode.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscvec.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -318,30 +319,32 @@ build_meter_web(DBfile* dbfile,
 } // build_meter_web
 #endif
 
-double
-linear_interp(const Point& X,
-              const Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const CellData<NDIM, double>& v,
-              const Index<NDIM>& /*patch_lower*/,
-              const Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+// The number of points in a (bi/tri)linear interpolation stencil.
+static const int LINEAR_STENCIL_SIZE = (NDIM == 2 ? 4 : 8);
+
+// Compute the (bi/tri)linear interpolation stencil for cell-centered data at
+// position X, which is located in the cell with index i_cell and center X_cell.
+void
+compute_cc_linear_stencil(const Point& X,
+                          const Index<NDIM>& i_cell,
+                          const Point& X_cell,
+                          const double* const dx,
+                          boost::array<Index<NDIM>, LINEAR_STENCIL_SIZE>& stencil_idx,
+                          boost::array<double, LINEAR_STENCIL_SIZE>& stencil_wgt)
 {
     boost::array<bool, NDIM> is_lower;
     for (unsigned int d = 0; d < NDIM; ++d)
     {
         is_lower[d] = X[d] < X_cell[d];
     }
-    double U = 0.0;
+    int k = 0;
 #if (NDIM == 3)
     for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
     {
 #endif
         for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
         {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
+            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0, ++k)
             {
                 const Point X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
                                      X_cell[1] + static_cast<double>(i_shift1) * dx[1]
@@ -350,7 +353,7 @@ linear_interp(const Point& X,
                                      X_cell[2] + static_cast<double>(i_shift2) * dx[2]
 #endif
                                      );
-                const double wgt =
+                stencil_wgt[k] =
                     (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
                      ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
 #if (NDIM == 3)
@@ -358,156 +361,94 @@ linear_interp(const Point& X,
                      ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
 #endif
                          );
-                const Index<NDIM> i(i_shift0 + i_cell(0),
-                                    i_shift1 + i_cell(1)
+                stencil_idx[k] = Index<NDIM>(i_shift0 + i_cell(0),
+                                             i_shift1 + i_cell(1)
 #if (NDIM == 3)
-                                        ,
-                                    i_shift2 + i_cell(2)
+                                                 ,
+                                             i_shift2 + i_cell(2)
 #endif
-                                        );
-                const CellIndex<NDIM> i_c(i);
-                U += v(i_c) * wgt;
+                                                 );
             }
         }
 #if (NDIM == 3)
     }
 #endif
-    return U;
-} // linear_interp
-
-template <int N>
-Eigen::Matrix<double, N, 1>
-linear_interp(const Point& X,
-              const Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const CellData<NDIM, double>& v,
-              const Index<NDIM>& /*patch_lower*/,
-              const Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+    return;
+} // compute_cc_linear_stencil
+
+// Compute the (bi/tri)linear interpolation stencil for the specified component
+// of side-centered data at position X, which is located in the cell with index
+// i_cell and center X_cell.  The stencil indices are the cell indices
+// associated with the lower sides of the cells.
+void
+compute_sc_linear_stencil(const Point& X,
+                          const Index<NDIM>& i_cell,
+                          const Point& X_cell,
+                          const double* const dx,
+                          const unsigned int axis,
+                          boost::array<Index<NDIM>, LINEAR_STENCIL_SIZE>& stencil_idx,
+                          boost::array<double, LINEAR_STENCIL_SIZE>& stencil_wgt)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == N);
-#endif
     boost::array<bool, NDIM> is_lower;
     for (unsigned int d = 0; d < NDIM; ++d)
     {
-        is_lower[d] = X[d] < X_cell[d];
+        if (d == axis)
+        {
+            is_lower[d] = false;
+        }
+        else
+        {
+            is_lower[d] = X[d] < X_cell[d];
+        }
     }
-    Eigen::Matrix<double, N, 1> U(Eigen::Matrix<double, N, 1>::Zero());
+    int k = 0;
 #if (NDIM == 3)
     for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
     {
 #endif
         for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
         {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
+            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0, ++k)
             {
-                const Point X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                     X_cell[1] + static_cast<double>(i_shift1) * dx[1]
+                const Point X_side(X_cell[0] + (static_cast<double>(i_shift0) + (axis == 0 ? -0.5 : 0.0)) * dx[0],
+                                   X_cell[1] + (static_cast<double>(i_shift1) + (axis == 1 ? -0.5 : 0.0)) * dx[1]
 #if (NDIM == 3)
-                                     ,
-                                     X_cell[2] + static_cast<double>(i_shift2) * dx[2]
+                                   ,
+                                   X_cell[2] + (static_cast<double>(i_shift2) + (axis == 2 ? -0.5 : 0.0)) * dx[2]
 #endif
-                                     );
-                const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
+                                   );
+                stencil_wgt[k] =
+                    (((X[0] < X_side[0] ? X[0] - (X_side[0] - dx[0]) : (X_side[0] + dx[0]) - X[0]) / dx[0]) *
+                     ((X[1] < X_side[1] ? X[1] - (X_side[1] - dx[1]) : (X_side[1] + dx[1]) - X[1]) / dx[1])
 #if (NDIM == 3)
                      *
-                     ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
+                     ((X[2] < X_side[2] ? X[2] - (X_side[2] - dx[2]) : (X_side[2] + dx[2]) - X[2]) / dx[2])
 #endif
                          );
-                const Index<NDIM> i(i_shift0 + i_cell(0),
-                                    i_shift1 + i_cell(1)
+                stencil_idx[k] = Index<NDIM>(i_shift0 + i_cell(0),
+                                             i_shift1 + i_cell(1)
 #if (NDIM == 3)
-                                        ,
-                                    i_shift2 + i_cell(2)
+                                                 ,
+                                             i_shift2 + i_cell(2)
 #endif
-                                        );
-                const CellIndex<NDIM> i_c(i);
-                for (int k = 0; k < N; ++k)
-                {
-                    U[k] += v(i_c, k) * wgt;
-                }
+                                                 );
             }
         }
 #if (NDIM == 3)
     }
 #endif
-    return U;
-} // linear_interp
-
-Vector
-linear_interp(const Point& X,
-              const Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const SideData<NDIM, double>& v,
-              const Index<NDIM>& /*patch_lower*/,
-              const Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+    return;
+} // compute_sc_linear_stencil
+
+// Return the number of the patch of a level that contains the specified cell,
+// or -1 if the cell is not contained in any patch of the level.
+inline int
+find_patch_num(const Pointer<BoxTree<NDIM> >& box_tree, const Index<NDIM>& i)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == 1);
-#endif
-    Vector U(Vector::Zero());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        boost::array<bool, NDIM> is_lower;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            if (d == axis)
-            {
-                is_lower[d] = false;
-            }
-            else
-            {
-                is_lower[d] = X[d] < X_cell[d];
-            }
-        }
-#if (NDIM == 3)
-        for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
-        {
-#endif
-            for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
-            {
-                for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-                {
-                    const Point X_side(X_cell[0] + (static_cast<double>(i_shift0) + (axis == 0 ? -0.5 : 0.0)) * dx[0],
-                                       X_cell[1] + (static_cast<double>(i_shift1) + (axis == 1 ? -0.5 : 0.0)) * dx[1]
-#if (NDIM == 3)
-                                       ,
-                                       X_cell[2] + (static_cast<double>(i_shift2) + (axis == 2 ? -0.5 : 0.0)) * dx[2]
-#endif
-                                       );
-                    const double wgt =
-                        (((X[0] < X_side[0] ? X[0] - (X_side[0] - dx[0]) : (X_side[0] + dx[0]) - X[0]) / dx[0]) *
-                         ((X[1] < X_side[1] ? X[1] - (X_side[1] - dx[1]) : (X_side[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                         *
-                         ((X[2] < X_side[2] ? X[2] - (X_side[2] - dx[2]) : (X_side[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                             );
-                    const Index<NDIM> i(i_shift0 + i_cell(0),
-                                        i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                            ,
-                                        i_shift2 + i_cell(2)
-#endif
-                                            );
-                    const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                    U[axis] += v(i_s) * wgt;
-                }
-            }
-#if (NDIM == 3)
-        }
-#endif
-    }
-    return U;
-} // linear_interp
+    Array<int> indices;
+    box_tree->findOverlapIndices(indices, Box<NDIM>(i, i));
+    return indices.getSize() > 0 ? indices[0] : -1;
+} // find_patch_num
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -528,8 +469,10 @@ IBInstrumentPanel::IBInstrumentPanel(const std::string& object_name, Pointer<Dat
       d_flow_values(),
       d_mean_pres_values(),
       d_point_pres_values(),
-      d_web_patch_map(),
-      d_web_centroid_map(),
+      d_meter_stencils(),
+      d_local_meter_area(),
+      d_stencil_X_perimeter(),
+      d_stencil_hierarchy_config(),
       d_plot_directory_name(NDIM == 2 ? "viz_inst2d" : "viz_inst3d"),
       d_output_log_file(false),
       d_log_file_name(NDIM == 2 ? "inst2d.log" : "inst3d.log"),
@@ -724,6 +667,10 @@ IBInstrumentPanel::initializeHierarchyIndependentData(const Pointer<PatchHierarc
         }
     }
 
+    // Force the meter webs and stencils to be rebuilt.
+    d_stencil_X_perimeter.clear();
+    d_stencil_hierarchy_config.clear();
+
     // Indicate that the hierarchy-independent data has been initialized.
     d_initialized = true;
 
@@ -817,6 +764,35 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         }
     }
 
+    // The meter webs are determined by the positions of the perimeter nodes,
+    // and the interpolation stencils are also determined by the configuration
+    // of the patch hierarchy.  Both are only rebuilt when the perimeter nodes
+    // have moved or the hierarchy has been regridded or redistributed.
+    std::vector<int> hierarchy_config;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+        hierarchy_config.push_back(boxes.getNumberOfBoxes());
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                hierarchy_config.push_back(boxes[k].lower()(d));
+                hierarchy_config.push_back(boxes[k].upper()(d));
+            }
+            hierarchy_config.push_back(processor_mapping.getProcessorAssignment(k));
+        }
+    }
+    if (X_perimeter_flattened == d_stencil_X_perimeter && hierarchy_config == d_stencil_hierarchy_config)
+    {
+        IBAMR_TIMER_STOP(t_initialize_hierarchy_dependent_data);
+        return;
+    }
+    d_stencil_X_perimeter.swap(X_perimeter_flattened);
+    d_stencil_hierarchy_config.swap(hierarchy_config);
+
     // Determine the centroid of each perimeter.
     std::fill(d_X_centroid.begin(), d_X_centroid.end(), Point::Zero());
     for (unsigned int m = 0; m < d_num_meters; ++m)
@@ -868,8 +844,7 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         init_meter_elements(d_X_web[m], d_dA_web[m], d_X_perimeter[m], d_X_centroid[m]);
     }
 
-    // Setup the mappings from cell indices to the web patch and web centroid
-    // data.
+    // Setup the interpolation stencils used to evaluate the meter quantities.
     //
     // NOTE: Each meter web patch/centroid is assigned to precisely one
     // Cartesian grid cell in precisely one level.  In particular, each web
@@ -878,10 +853,13 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     // located.  Similarly, each web centroid is assigned to which ever grid
     // cell is the finest cell that contains the region of physical space in
     // which the web centroid is located.
-    d_web_patch_map.clear();
-    d_web_patch_map.resize(finest_ln + 1);
-    d_web_centroid_map.clear();
-    d_web_centroid_map.resize(finest_ln + 1);
+    const int rank = SAMRAI_MPI::getRank();
+    d_meter_stencils.clear();
+    d_meter_stencils.resize(finest_ln + 1);
+    d_local_meter_area.clear();
+    d_local_meter_area.resize(d_num_meters, 0.0);
+    boost::array<Index<NDIM>, LINEAR_STENCIL_SIZE> stencil_idx;
+    boost::array<double, LINEAR_STENCIL_SIZE> stencil_wgt;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -907,9 +885,20 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
             finer_dx[d] = dx_coarsest[d] / static_cast<double>(finer_ratio(d));
         }
 
+        // Determine the web patches and web centroids that are assigned to
+        // this level, and bin them by the local patch that contains them.
+        Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+        Pointer<BoxTree<NDIM> > finer_box_tree =
+            (ln < finest_ln ? finer_level->getBoxTree() : Pointer<BoxTree<NDIM> >(NULL));
+        const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+        std::vector<int> web_patch_meter_num, web_centroid_meter_num;
+        std::vector<const Point*> web_patch_X, web_centroid_X;
+        std::vector<const Vector*> web_patch_dA;
+        std::vector<Index<NDIM> > web_patch_idx, web_centroid_idx;
+        std::vector<std::vector<int> > patch_web_patches(level->getNumberOfPatches());
+        std::vector<std::vector<int> > patch_web_centroids(level->getNumberOfPatches());
         for (unsigned int l = 0; l < d_num_meters; ++l)
         {
-            // Setup the web patch mapping.
             for (unsigned int m = 0; m < d_X_web[l].shape()[0]; ++m)
             {
                 for (unsigned int n = 0; n < d_X_web[l].shape()[1]; ++n)
@@ -917,40 +906,121 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
                     const Point& X = d_X_web[l][m][n];
                     const Index<NDIM> i = IndexUtilities::getCellIndex(
                         X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
-                    const Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
-                                                                             domainXLower,
-                                                                             domainXUpper,
-                                                                             finer_dx.data(),
-                                                                             finer_domain_box_level_lower,
-                                                                             finer_domain_box_level_upper);
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+                    const int patch_num = find_patch_num(box_tree, i);
+                    if (patch_num < 0 || processor_mapping.getProcessorAssignment(patch_num) != rank) continue;
+                    if (ln < finest_ln)
                     {
-                        WebPatch p;
-                        p.meter_num = l;
-                        p.X = &d_X_web[l][m][n];
-                        p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
+                        const Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
+                                                                                 domainXLower,
+                                                                                 domainXUpper,
+                                                                                 finer_dx.data(),
+                                                                                 finer_domain_box_level_lower,
+                                                                                 finer_domain_box_level_upper);
+                        if (find_patch_num(finer_box_tree, finer_i) >= 0) continue;
                     }
+                    patch_web_patches[patch_num].push_back(static_cast<int>(web_patch_idx.size()));
+                    web_patch_meter_num.push_back(l);
+                    web_patch_X.push_back(&d_X_web[l][m][n]);
+                    web_patch_dA.push_back(&d_dA_web[l][m][n]);
+                    web_patch_idx.push_back(i);
                 }
             }
 
-            // Setup the web centroid mapping.
             const Point& X = d_X_centroid[l];
             const Index<NDIM> i = IndexUtilities::getCellIndex(
                 X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
-            const Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
-                                                                     domainXLower,
-                                                                     domainXUpper,
-                                                                     finer_dx.data(),
-                                                                     finer_domain_box_level_lower,
-                                                                     finer_domain_box_level_upper);
-            if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+            const int patch_num = find_patch_num(box_tree, i);
+            if (patch_num < 0 || processor_mapping.getProcessorAssignment(patch_num) != rank) continue;
+            if (ln < finest_ln)
             {
-                WebCentroid c;
-                c.meter_num = l;
-                c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
+                const Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
+                                                                         domainXLower,
+                                                                         domainXUpper,
+                                                                         finer_dx.data(),
+                                                                         finer_domain_box_level_lower,
+                                                                         finer_domain_box_level_upper);
+                if (find_patch_num(finer_box_tree, finer_i) >= 0) continue;
+            }
+            patch_web_centroids[patch_num].push_back(static_cast<int>(web_centroid_idx.size()));
+            web_centroid_meter_num.push_back(l);
+            web_centroid_X.push_back(&d_X_centroid[l]);
+            web_centroid_idx.push_back(i);
+        }
+
+        // Build the stencils for the web patches and web centroids that are
+        // located in the local patches.
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const std::vector<int>& local_web_patches = patch_web_patches[p()];
+            const std::vector<int>& local_web_centroids = patch_web_centroids[p()];
+            if (local_web_patches.empty() && local_web_centroids.empty()) continue;
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Index<NDIM>& patch_lower = patch_box.lower();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const patch_dx = pgeom->getDx();
+
+            PatchMeterStencils stencils;
+            stencils.patch_num = p();
+            for (std::vector<int>::const_iterator cit = local_web_patches.begin(); cit != local_web_patches.end();
+                 ++cit)
+            {
+                const int k = *cit;
+                const Index<NDIM>& i = web_patch_idx[k];
+                const int meter_num = web_patch_meter_num[k];
+                const Point& X = *web_patch_X[k];
+                const Vector& dA = *web_patch_dA[k];
+                const double dA_norm = dA.norm();
+                Point X_cell;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_cell[d] = x_lower[d] + patch_dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+
+                // Flux of cell-centered velocity data and mean pressure.
+                compute_cc_linear_stencil(X, i, X_cell, patch_dx, stencil_idx, stencil_wgt);
+                for (int s = 0; s < LINEAR_STENCIL_SIZE; ++s)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        stencils.cc_flux.addEntry(meter_num, stencil_idx[s], d, stencil_wgt[s] * dA[d]);
+                    }
+                    stencils.mean_pres.addEntry(meter_num, stencil_idx[s], 0, stencil_wgt[s] * dA_norm);
+                }
+                d_local_meter_area[meter_num] += dA_norm;
+
+                // Flux of side-centered velocity data.
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    compute_sc_linear_stencil(X, i, X_cell, patch_dx, axis, stencil_idx, stencil_wgt);
+                    for (int s = 0; s < LINEAR_STENCIL_SIZE; ++s)
+                    {
+                        stencils.sc_flux.addEntry(meter_num, stencil_idx[s], axis, stencil_wgt[s] * dA[axis]);
+                    }
+                }
+            }
+            for (std::vector<int>::const_iterator cit = local_web_centroids.begin(); cit != local_web_centroids.end();
+                 ++cit)
+            {
+                const int k = *cit;
+                const Index<NDIM>& i = web_centroid_idx[k];
+                Point X_cell;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_cell[d] = x_lower[d] + patch_dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+
+                // Pointwise pressure.
+                compute_cc_linear_stencil(*web_centroid_X[k], i, X_cell, patch_dx, stencil_idx, stencil_wgt);
+                for (int s = 0; s < LINEAR_STENCIL_SIZE; ++s)
+                {
+                    stencils.point_pres.addEntry(web_centroid_meter_num[k], stencil_idx[s], 0, stencil_wgt[s]);
+                }
+            }
+            if (!stencils.mean_pres.meter_num.empty() || !stencils.point_pres.meter_num.empty())
+            {
+                d_meter_stencils[ln].push_back(stencils);
             }
         }
     }
@@ -995,137 +1065,88 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
                                  << std::endl);
     }
 
-    // Reset the instrument values.
-    std::fill(d_flow_values.begin(), d_flow_values.end(), 0.0);
-    std::fill(d_mean_pres_values.begin(), d_mean_pres_values.end(), 0.0);
-    std::fill(d_point_pres_values.begin(), d_point_pres_values.end(), 0.0);
-    std::vector<double> A(d_num_meters, 0.0);
+    // All meter quantities are accumulated in a single buffer so that they can
+    // be synchronized across all processes via a single reduction.  The buffer
+    // contains the flow rates, the unnormalized mean pressures, the pointwise
+    // pressures, and the areas of the meters, followed by the velocities of
+    // the perimeter nodes.
+    int num_perimeter_nodes = 0;
+    for (unsigned int m = 0; m < d_num_meters; ++m)
+    {
+        num_perimeter_nodes += d_num_perimeter_nodes[m];
+    }
+    std::vector<double> meter_data(4 * d_num_meters + NDIM * num_perimeter_nodes, 0.0);
+    double* const flow_values = &meter_data[0];
+    double* const mean_pres_values = &meter_data[d_num_meters];
+    double* const point_pres_values = &meter_data[2 * d_num_meters];
+    double* const A = &meter_data[3 * d_num_meters];
+    double* const U_perimeter_flattened = &meter_data[4 * d_num_meters];
 
     // Compute the local contributions to the flux of U through the flow meter,
     // the average value of P in the flow meter, and the pointwise value of P at
-    // the centroid of the meter.
+    // the centroid of the meter using the precomputed meter stencils.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        for (std::vector<PatchMeterStencils>::const_iterator it = d_meter_stencils[ln].begin();
+             it != d_meter_stencils[ln].end();
+             ++it)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const Index<NDIM>& patch_lower = patch_box.lower();
-            const Index<NDIM>& patch_upper = patch_box.upper();
-
-            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const x_lower = pgeom->getXLower();
-            const double* const x_upper = pgeom->getXUpper();
-            const double* const dx = pgeom->getDx();
-
+            const PatchMeterStencils& stencils = *it;
+            Pointer<Patch<NDIM> > patch = level->getPatch(stencils.patch_num);
             Pointer<CellData<NDIM, double> > U_cc_data = patch->getPatchData(U_data_idx);
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
-
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            if (U_cc_data)
             {
-                const Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
+#if !defined(NDEBUG)
+                TBOX_ASSERT(U_cc_data->getDepth() == NDIM);
+#endif
+                const MeterStencil& stencil = stencils.cc_flux;
+                for (unsigned int k = 0; k < stencil.meter_num.size(); ++k)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+                    flow_values[stencil.meter_num[k]] +=
+                        stencil.coef[k] * (*U_cc_data)(CellIndex<NDIM>(stencil.idx[k]), stencil.component[k]);
+                }
+            }
+            if (U_sc_data)
+            {
+#if !defined(NDEBUG)
+                TBOX_ASSERT(U_sc_data->getDepth() == 1);
 #endif
-                                           );
-                    if (U_cc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
-                    }
+                const MeterStencil& stencil = stencils.sc_flux;
+                for (unsigned int k = 0; k < stencil.meter_num.size(); ++k)
+                {
+                    flow_values[stencil.meter_num[k]] +=
+                        stencil.coef[k] *
+                        (*U_sc_data)(SideIndex<NDIM>(stencil.idx[k], stencil.component[k], SideIndex<NDIM>::Lower));
                 }
-
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+            }
+            if (P_cc_data)
+            {
+                const MeterStencil& mean_stencil = stencils.mean_pres;
+                for (unsigned int k = 0; k < mean_stencil.meter_num.size(); ++k)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                                           );
-                    if (P_cc_data)
-                    {
-                        for (WebCentroidMap::const_iterator it = centroid_range.first; it != centroid_range.second;
-                             ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
-                    }
+                    mean_pres_values[mean_stencil.meter_num[k]] +=
+                        mean_stencil.coef[k] * (*P_cc_data)(CellIndex<NDIM>(mean_stencil.idx[k]));
+                }
+                const MeterStencil& point_stencil = stencils.point_pres;
+                for (unsigned int k = 0; k < point_stencil.meter_num.size(); ++k)
+                {
+                    point_pres_values[point_stencil.meter_num[k]] +=
+                        point_stencil.coef[k] * (*P_cc_data)(CellIndex<NDIM>(point_stencil.idx[k]));
                 }
             }
         }
     }
-
-    // Synchronize the values across all processes.
-    SAMRAI_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_mean_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_point_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&A[0], d_num_meters);
-
-    // Normalize the mean pressure.
-    for (unsigned int m = 0; m < d_num_meters; ++m)
-    {
-        d_mean_pres_values[m] /= A[m];
-    }
+    std::copy(d_local_meter_area.begin(), d_local_meter_area.end(), A);
 
     // Loop over all local nodes to determine the velocities of the local
     // perimeter nodes.
-    std::vector<boost::multi_array<Vector, 1> > U_perimeter(d_num_meters);
-    for (unsigned int m = 0; m < d_num_meters; ++m)
+    std::vector<int> perimeter_offset(d_num_meters, 0);
+    for (unsigned int m = 1; m < d_num_meters; ++m)
     {
-        U_perimeter[m].resize(boost::extents[d_num_perimeter_nodes[m]]);
-        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n)
-        {
-            U_perimeter[m][n] = Vector::Zero();
-        }
+        perimeter_offset[m] = perimeter_offset[m - 1] + d_num_perimeter_nodes[m - 1];
     }
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -1151,7 +1172,7 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
                     const double* const U = &U_arr[NDIM * petsc_idx];
                     const int m = spec->getMeterIndex();
                     const int n = spec->getNodeIndex();
-                    std::copy(U, U + NDIM, U_perimeter[m][n].data());
+                    std::copy(U, U + NDIM, &U_perimeter_flattened[NDIM * (perimeter_offset[m] + n)]);
                 }
             }
 
@@ -1161,19 +1182,23 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         }
     }
 
-    // Set the velocities of all perimeter nodes on all processes.
-    std::vector<double> U_perimeter_flattened;
+    // Synchronize the values across all processes.
+    SAMRAI_MPI::sumReduction(&meter_data[0], static_cast<int>(meter_data.size()));
+    std::copy(flow_values, flow_values + d_num_meters, d_flow_values.begin());
+    std::copy(mean_pres_values, mean_pres_values + d_num_meters, d_mean_pres_values.begin());
+    std::copy(point_pres_values, point_pres_values + d_num_meters, d_point_pres_values.begin());
+
+    // Normalize the mean pressure.
     for (unsigned int m = 0; m < d_num_meters; ++m)
     {
-        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n)
-        {
-            U_perimeter_flattened.insert(
-                U_perimeter_flattened.end(), U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM);
-        }
+        d_mean_pres_values[m] /= A[m];
     }
-    SAMRAI_MPI::sumReduction(&U_perimeter_flattened[0], static_cast<int>(U_perimeter_flattened.size()));
+
+    // Set the velocities of all perimeter nodes on all processes.
+    std::vector<boost::multi_array<Vector, 1> > U_perimeter(d_num_meters);
     for (unsigned int m = 0, k = 0; m < d_num_meters; ++m)
     {
+        U_perimeter[m].resize(boost::extents[d_num_perimeter_nodes[m]]);
         for (int n = 0; n < d_num_perimeter_nodes[m]; ++n, ++k)
         {
             std::copy(
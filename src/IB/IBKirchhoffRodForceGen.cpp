@@ -34,7 +34,11 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <ostream>
+#include <set>
+#include <sstream>
 #include <vector>
 
 #include "Eigen/Geometry"
@@ -51,8 +55,9 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/WorkloadCostModel.h"
+#include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
-#include "petscmat.h"
 #include "petscsys.h"
 #include "petscvec.h"
 #include "tbox/Database.h"
@@ -73,13 +78,102 @@ namespace
 // Timers.
 static Timer* t_compute_lagrangian_force_and_torque;
 static Timer* t_initialize_level_data;
+
+// Number of rod elements processed together in computeLagrangianForceAndTorque().
+static const int BLOCKSIZE = 16;
+
+// Rotations whose unit quaternions have scalar parts smaller than this value
+// (i.e., rotations by angles larger than 120 degrees) are not treated in closed
+// form by compute_half_step_triads().
+static const double MIN_QUATERNION_SCALAR = 0.5;
+
+// Compute the director triads at the midpoints of a block of rod elements,
+// D_half = sqrt(D_next*D^T)*D.  The triads are stored as structures of arrays,
+// so that, e.g., D[i+3*j][k] is entry (i,j) of the triad of element k.
+//
+// The square root of the rotation R = D_next*D^T is evaluated in closed form:
+// if q = (w,v) is the unit quaternion of R with w >= 0, then sqrt(R) is the
+// rotation with quaternion (1+w,v)/sqrt(2*(1+w)), which rotates about the same
+// axis by half the angle.  The vector part v is recovered from the
+// antisymmetric part of R, which loses accuracy as the rotation angle
+// approaches 180 degrees, so that elements whose triads differ by a rotation by
+// more than 120 degrees instead use the general matrix square root.  The loop
+// over the elements of the block is free of branches and data-dependent
+// indexing so that it can be vectorized.  (With GCC, this also requires
+// -fno-math-errno, which is implied by -ffast-math.)
+void
+compute_half_step_triads(double (*EIGEN_RESTRICT D_half)[BLOCKSIZE],
+                         const double D[9][BLOCKSIZE],
+                         const double D_next[9][BLOCKSIZE],
+                         const int block_size)
+{
+    for (int k = 0; k < block_size; ++k)
+    {
+        // R = D_next*D^T.  Only the diagonal entries and the antisymmetric part
+        // of R are needed.
+#define R_ENTRY(i, j) (D_next[i][k] * D[j][k] + D_next[i + 3][k] * D[j + 3][k] + D_next[i + 6][k] * D[j + 6][k])
+        const double R_trace = R_ENTRY(0, 0) + R_ENTRY(1, 1) + R_ENTRY(2, 2);
+        const double R_21_12 = R_ENTRY(2, 1) - R_ENTRY(1, 2);
+        const double R_02_20 = R_ENTRY(0, 2) - R_ENTRY(2, 0);
+        const double R_10_01 = R_ENTRY(1, 0) - R_ENTRY(0, 1);
+#undef R_ENTRY
+
+        // The unit quaternion (w,v) of R and the unit quaternion (qw,qv) of
+        // sqrt(R).
+        const double w = 0.5 * std::sqrt(std::max(1.0 + R_trace, 0.0));
+        const double v_scale = 0.25 / std::max(w, MIN_QUATERNION_SCALAR);
+        const double q_scale = 1.0 / std::sqrt(2.0 * (1.0 + w));
+        const double qw = (1.0 + w) * q_scale;
+        const double qx = R_21_12 * v_scale * q_scale;
+        const double qy = R_02_20 * v_scale * q_scale;
+        const double qz = R_10_01 * v_scale * q_scale;
+
+        // D_half = sqrt(R)*D.
+        const double S_00 = 1.0 - 2.0 * (qy * qy + qz * qz);
+        const double S_01 = 2.0 * (qx * qy - qz * qw);
+        const double S_02 = 2.0 * (qx * qz + qy * qw);
+        const double S_10 = 2.0 * (qx * qy + qz * qw);
+        const double S_11 = 1.0 - 2.0 * (qx * qx + qz * qz);
+        const double S_12 = 2.0 * (qy * qz - qx * qw);
+        const double S_20 = 2.0 * (qx * qz - qy * qw);
+        const double S_21 = 2.0 * (qy * qz + qx * qw);
+        const double S_22 = 1.0 - 2.0 * (qx * qx + qy * qy);
+        for (int j = 0; j < 3; ++j)
+        {
+            D_half[3 * j][k] = S_00 * D[3 * j][k] + S_01 * D[3 * j + 1][k] + S_02 * D[3 * j + 2][k];
+            D_half[3 * j + 1][k] = S_10 * D[3 * j][k] + S_11 * D[3 * j + 1][k] + S_12 * D[3 * j + 2][k];
+            D_half[3 * j + 2][k] = S_20 * D[3 * j][k] + S_21 * D[3 * j + 1][k] + S_22 * D[3 * j + 2][k];
+        }
+    }
+
+    // Fall back on the general matrix square root for large rotations.
+    for (int k = 0; k < block_size; ++k)
+    {
+        Matrix3d D_k, D_next_k;
+        for (int l = 0; l < 9; ++l)
+        {
+            D_k.data()[l] = D[l][k];
+            D_next_k.data()[l] = D_next[l][k];
+        }
+        const Matrix3d R = D_next_k * D_k.transpose();
+        if (0.5 * std::sqrt(std::max(1.0 + R.trace(), 0.0)) >= MIN_QUATERNION_SCALAR) continue;
+        const Matrix3d D_half_k = R.sqrt() * D_k;
+        for (int l = 0; l < 9; ++l)
+        {
+            D_half[l][k] = D_half_k.data()[l];
+        }
+    }
+    return;
+} // compute_half_step_triads
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBKirchhoffRodForceGen::IBKirchhoffRodForceGen(Pointer<Database> input_db)
-    : d_D_next_mats(),
-      d_X_next_mats(),
+    : d_X_ghost_data(),
+      d_D_ghost_data(),
+      d_F_ghost_data(),
+      d_N_ghost_data(),
       d_petsc_curr_node_idxs(),
       d_petsc_next_node_idxs(),
       d_material_params(),
@@ -98,23 +192,7 @@ IBKirchhoffRodForceGen::IBKirchhoffRodForceGen(Pointer<Database> input_db)
 
 IBKirchhoffRodForceGen::~IBKirchhoffRodForceGen()
 {
-    int ierr;
-    for (std::vector<Mat>::iterator it = d_D_next_mats.begin(); it != d_D_next_mats.end(); ++it)
-    {
-        if (*it)
-        {
-            ierr = MatDestroy(&*it);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-    for (std::vector<Mat>::iterator it = d_X_next_mats.begin(); it != d_X_next_mats.end(); ++it)
-    {
-        if (*it)
-        {
-            ierr = MatDestroy(&*it);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
+    // intentionally blank
     return;
 } // ~IBKirchhoffRodForceGen
 
@@ -132,8 +210,6 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
 #if !defined(NDEBUG)
     TBOX_ASSERT(hierarchy);
 #endif
-    int ierr;
-
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
 
     // Resize the vectors corresponding to data individually maintained for
@@ -141,30 +217,20 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
     const int level_num = level->getLevelNumber();
     const int new_size = std::max(level_num + 1, static_cast<int>(d_is_initialized.size()));
 
-    d_D_next_mats.resize(new_size);
-    d_X_next_mats.resize(new_size);
+    d_X_ghost_data.resize(new_size);
+    d_D_ghost_data.resize(new_size);
+    d_F_ghost_data.resize(new_size);
+    d_N_ghost_data.resize(new_size);
     d_petsc_curr_node_idxs.resize(new_size);
     d_petsc_next_node_idxs.resize(new_size);
     d_material_params.resize(new_size);
     d_is_initialized.resize(new_size, false);
 
-    Mat& D_next_mat = d_D_next_mats[level_num];
-    Mat& X_next_mat = d_X_next_mats[level_num];
     std::vector<int>& petsc_curr_node_idxs = d_petsc_curr_node_idxs[level_num];
     std::vector<int>& petsc_next_node_idxs = d_petsc_next_node_idxs[level_num];
     std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> >& material_params =
         d_material_params[level_num];
 
-    if (D_next_mat)
-    {
-        ierr = MatDestroy(&D_next_mat);
-        IBTK_CHKERRQ(ierr);
-    }
-    if (X_next_mat)
-    {
-        ierr = MatDestroy(&X_next_mat);
-        IBTK_CHKERRQ(ierr);
-    }
     petsc_curr_node_idxs.clear();
     petsc_next_node_idxs.clear();
     material_params.clear();
@@ -206,120 +272,65 @@ IBKirchhoffRodForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> >
     l_data_manager->mapLagrangianToPETSc(petsc_curr_node_idxs, level_num);
     l_data_manager->mapLagrangianToPETSc(petsc_next_node_idxs, level_num);
 
-    // Determine the global node offset and the number of local nodes.
+    // Determine the ghost nodes required to compute the rod forces and torques.
     const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_num);
     const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_num);
-
-    // Determine the non-zero structure for the matrices.
-    const int local_sz = static_cast<int>(petsc_curr_node_idxs.size());
-
-    std::vector<int> next_d_nz(local_sz, 1), next_o_nz(local_sz, 0);
-    for (int k = 0; k < local_sz; ++k)
+    std::set<int> nonlocal_petsc_idx_set;
+    for (std::vector<int>::const_iterator cit = petsc_next_node_idxs.begin(); cit != petsc_next_node_idxs.end();
+         ++cit)
     {
-        const int& next_idx = petsc_next_node_idxs[k];
-        if (next_idx >= global_node_offset && next_idx < global_node_offset + num_local_nodes)
+        const int idx = *cit;
+        if (idx < global_node_offset || idx >= global_node_offset + num_local_nodes)
         {
-            ++next_d_nz[k]; // a "local"    next index
-        }
-        else
-        {
-            ++next_o_nz[k]; // a "nonlocal" next index
+            nonlocal_petsc_idx_set.insert(idx);
         }
     }
+    const std::vector<int> nonlocal_petsc_idxs(nonlocal_petsc_idx_set.begin(), nonlocal_petsc_idx_set.end());
 
-    // Create new MPI block AIJ matrices and set the values of the non-zero
-    // entries.
+    // Put the cached PETSc node indices into local form, in which the ghost
+    // nodes are numbered consecutively following the local nodes.
+    for (std::vector<int>::iterator it = petsc_curr_node_idxs.begin(); it != petsc_curr_node_idxs.end(); ++it)
     {
-        ierr = MatCreateBAIJ(PETSC_COMM_WORLD,
-                             3 * 3,
-                             3 * 3 * local_sz,
-                             3 * 3 * num_local_nodes,
-                             PETSC_DETERMINE,
-                             PETSC_DETERMINE,
-                             0,
-                             local_sz ? &next_d_nz[0] : NULL,
-                             0,
-                             local_sz ? &next_o_nz[0] : NULL,
-                             &D_next_mat);
-        IBTK_CHKERRQ(ierr);
-
-        Eigen::Matrix<double, 3 * 3, 3 * 3, Eigen::RowMajor> curr_vals(
-            Eigen::Matrix<double, 3 * 3, 3 * 3, Eigen::RowMajor>::Zero());
-        Eigen::Matrix<double, 3 * 3, 3 * 3, Eigen::RowMajor> next_vals(
-            Eigen::Matrix<double, 3 * 3, 3 * 3, Eigen::RowMajor>::Zero());
-        for (unsigned int d = 0; d < 3 * 3; ++d)
+        int& idx = *it;
+#if !defined(NDEBUG)
+        TBOX_ASSERT(idx >= global_node_offset && idx < global_node_offset + num_local_nodes);
+#endif
+        idx -= global_node_offset;
+    }
+    for (std::vector<int>::iterator it = petsc_next_node_idxs.begin(); it != petsc_next_node_idxs.end(); ++it)
+    {
+        int& idx = *it;
+        if (idx >= global_node_offset && idx < global_node_offset + num_local_nodes)
         {
-            curr_vals(d, d) = 0.0;
-            next_vals(d, d) = +1.0;
+            idx -= global_node_offset;
         }
-
-        int i_offset;
-
-        ierr = MatGetOwnershipRange(D_next_mat, &i_offset, NULL);
-        IBTK_CHKERRQ(ierr);
-        i_offset /= 3 * 3;
-
-        for (int k = 0; k < local_sz; ++k)
+        else
         {
-            int i = i_offset + k;
-            int j_curr = petsc_curr_node_idxs[k];
-            int j_next = petsc_next_node_idxs[k];
-            ierr = MatSetValuesBlocked(D_next_mat, 1, &i, 1, &j_curr, curr_vals.data(), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(D_next_mat, 1, &i, 1, &j_next, next_vals.data(), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            const std::vector<int>::const_iterator posn =
+                std::lower_bound(nonlocal_petsc_idxs.begin(), nonlocal_petsc_idxs.end(), idx);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(posn != nonlocal_petsc_idxs.end() && idx == *posn);
+#endif
+            idx = num_local_nodes + static_cast<int>(std::distance(nonlocal_petsc_idxs.begin(), posn));
         }
     }
 
-    {
-        ierr = MatCreateBAIJ(PETSC_COMM_WORLD,
-                             NDIM,
-                             NDIM * local_sz,
-                             NDIM * num_local_nodes,
-                             PETSC_DETERMINE,
-                             PETSC_DETERMINE,
-                             0,
-                             local_sz ? &next_d_nz[0] : NULL,
-                             0,
-                             local_sz ? &next_o_nz[0] : NULL,
-                             &X_next_mat);
-        IBTK_CHKERRQ(ierr);
+    // Create the ghosted data used to compute the rod forces and torques.
+    std::ostringstream X_name_stream;
+    X_name_stream << "IBKirchhoffRodForceGen::X_ghost_" << level_num;
+    d_X_ghost_data[level_num] = new LData(X_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
 
-        Matrix curr_vals(Matrix::Zero());
-        Matrix next_vals(Matrix::Zero());
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            curr_vals(d, d) = 0.0;
-            next_vals(d, d) = +1.0;
-        }
+    std::ostringstream D_name_stream;
+    D_name_stream << "IBKirchhoffRodForceGen::D_ghost_" << level_num;
+    d_D_ghost_data[level_num] = new LData(D_name_stream.str(), num_local_nodes, 3 * 3, nonlocal_petsc_idxs);
 
-        int i_offset;
+    std::ostringstream F_name_stream;
+    F_name_stream << "IBKirchhoffRodForceGen::F_ghost_" << level_num;
+    d_F_ghost_data[level_num] = new LData(F_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
 
-        ierr = MatGetOwnershipRange(X_next_mat, &i_offset, NULL);
-        IBTK_CHKERRQ(ierr);
-        i_offset /= NDIM;
-
-        for (int k = 0; k < local_sz; ++k)
-        {
-            int i = i_offset + k;
-            int j_curr = petsc_curr_node_idxs[k];
-            int j_next = petsc_next_node_idxs[k];
-            ierr = MatSetValuesBlocked(X_next_mat, 1, &i, 1, &j_curr, curr_vals.data(), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(X_next_mat, 1, &i, 1, &j_next, next_vals.data(), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-
-    // Assemble the matrices.
-    ierr = MatAssemblyBegin(D_next_mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyBegin(X_next_mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(D_next_mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(X_next_mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
+    std::ostringstream N_name_stream;
+    N_name_stream << "IBKirchhoffRodForceGen::N_ghost_" << level_num;
+    d_N_ghost_data[level_num] = new LData(N_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
 
     // Indicate that the level data has been initialized.
     d_is_initialized[level_num] = true;
@@ -347,185 +358,152 @@ IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(Pointer<LData> F_data,
     TBOX_ASSERT(d_is_initialized[level_number]);
 #endif
 
-    const int global_offset = l_data_manager->getGlobalNodeOffset(level_number);
-
     int ierr;
 
-    // Create appropriately sized temporary vectors.
-    int i_start, i_stop;
-
-    ierr = MatGetOwnershipRange(d_D_next_mats[level_number], &i_start, &i_stop);
-    IBTK_CHKERRQ(ierr);
-
-    Vec D_vec = D_data->getVec();
-    Vec D_next_vec;
-    ierr = VecCreateMPI(PETSC_COMM_WORLD, i_stop - i_start, PETSC_DECIDE, &D_next_vec);
+    // Fill the ghosted position and director data.
+    Pointer<LData> X_ghost_data = d_X_ghost_data[level_number];
+    Pointer<LData> D_ghost_data = d_D_ghost_data[level_number];
+    ierr = VecCopy(X_data->getVec(), X_ghost_data->getVec());
     IBTK_CHKERRQ(ierr);
-
-    ierr = MatGetOwnershipRange(d_X_next_mats[level_number], &i_start, &i_stop);
-    IBTK_CHKERRQ(ierr);
-
-    Vec X_vec = X_data->getVec();
-    Vec X_next_vec;
-    ierr = VecCreateMPI(PETSC_COMM_WORLD, i_stop - i_start, PETSC_DECIDE, &X_next_vec);
+    ierr = VecCopy(D_data->getVec(), D_ghost_data->getVec());
     IBTK_CHKERRQ(ierr);
-
-    // Compute the node displacements.
-    ierr = MatMult(d_D_next_mats[level_number], D_vec, D_next_vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatMult(d_X_next_mats[level_number], X_vec, X_next_vec);
-    IBTK_CHKERRQ(ierr);
-
-    // Compute the rod forces acting on the nodes of the Lagrangian mesh.
-    double* D_vals;
-    ierr = VecGetArray(D_vec, &D_vals);
-    IBTK_CHKERRQ(ierr);
-
-    double* D_next_vals;
-    ierr = VecGetArray(D_next_vec, &D_next_vals);
-    IBTK_CHKERRQ(ierr);
-
-    double* X_vals;
-    ierr = VecGetArray(X_vec, &X_vals);
-    IBTK_CHKERRQ(ierr);
-
-    double* X_next_vals;
-    ierr = VecGetArray(X_next_vec, &X_next_vals);
-    IBTK_CHKERRQ(ierr);
-
-    std::vector<int>& petsc_curr_node_idxs = d_petsc_curr_node_idxs[level_number];
-    std::vector<int>& petsc_next_node_idxs = d_petsc_next_node_idxs[level_number];
-    const std::vector<boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> >& material_params =
-        d_material_params[level_number];
-
-    const size_t local_sz = petsc_curr_node_idxs.size();
-    std::vector<double> F_curr_node_vals(NDIM * local_sz, 0.0);
-    std::vector<double> N_curr_node_vals(NDIM * local_sz, 0.0);
-    std::vector<double> F_next_node_vals(NDIM * local_sz, 0.0);
-    std::vector<double> N_next_node_vals(NDIM * local_sz, 0.0);
-
-    for (unsigned int k = 0; k < local_sz; ++k)
+    Pointer<WorkloadCostModel> workload_cost_model = l_data_manager->getWorkloadCostModel();
+    if (workload_cost_model) workload_cost_model->startSynchronization();
+    X_ghost_data->beginGhostUpdate();
+    D_ghost_data->beginGhostUpdate();
+    X_ghost_data->endGhostUpdate();
+    D_ghost_data->endGhostUpdate();
+    if (workload_cost_model) workload_cost_model->stopSynchronization();
+
+    // Initialize the ghosted force and torque data.
+    Pointer<LData> F_ghost_data = d_F_ghost_data[level_number];
+    Pointer<LData> N_ghost_data = d_N_ghost_data[level_number];
+    boost::array<Pointer<LData>, 2> FN_ghost_data = { { F_ghost_data, N_ghost_data } };
+    for (unsigned int j = 0; j < FN_ghost_data.size(); ++j)
     {
-        // Compute the forces applied by the rod to the "current" and "next"
-        // nodes.
-        const int D1_offset = 0;
-        Eigen::Map<const Vector3d> D1(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D1_offset]);
-        Eigen::Map<const Vector3d> D1_next(&D_next_vals[k * 3 * 3 + D1_offset]);
-
-        const int D2_offset = 3;
-        Eigen::Map<const Vector3d> D2(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D2_offset]);
-        Eigen::Map<const Vector3d> D2_next(&D_next_vals[k * 3 * 3 + D2_offset]);
-
-        const int D3_offset = 6;
-        Eigen::Map<const Vector3d> D3(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D3_offset]);
-        Eigen::Map<const Vector3d> D3_next(&D_next_vals[k * 3 * 3 + D3_offset]);
-
-        Eigen::Map<const Vector3d> X(&X_vals[(petsc_curr_node_idxs[k] - global_offset) * NDIM]);
-        Eigen::Map<const Vector3d> X_next(&X_next_vals[k * NDIM]);
-
-        boost::array<Eigen::Map<const Vector3d>*, 3> D = { { &D1, &D2, &D3 } };
-        boost::array<Eigen::Map<const Vector3d>*, 3> D_next = { { &D1_next, &D2_next, &D3_next } };
-        Matrix3d A(Matrix3d::Zero());
-        for (int i = 0; i < 3; ++i)
-        {
-            A += (*D_next[i]) * (*D[i]).transpose();
-        }
-        Matrix3d sqrt_A = A.sqrt();
-        Vector3d D1_half, D2_half, D3_half;
-        boost::array<Vector3d*, 3> D_half = { { &D1_half, &D2_half, &D3_half } };
-        for (int i = 0; i < 3; ++i)
-        {
-            *D_half[i] = sqrt_A * (*D[i]);
-        }
-
-        const double ds = material_params[k][0];
-        const double a1 = material_params[k][1];
-        const double a2 = material_params[k][2];
-        const double a3 = material_params[k][3];
-        const double b1 = material_params[k][4];
-        const double b2 = material_params[k][5];
-        const double b3 = material_params[k][6];
-        const double kappa1 = material_params[k][7];
-        const double kappa2 = material_params[k][8];
-        const double tau = material_params[k][9];
-
-        const Vector3d dX_ds((X_next - X) / ds);
-        const double F1 = b1 * D1_half.dot(dX_ds);
-        const double F2 = b2 * D2_half.dot(dX_ds);
-        const double F3 = b3 * (D3_half.dot(dX_ds) - 1.0);
-        const Vector3d F_half = F1 * D1_half + F2 * D2_half + F3 * D3_half;
-
-        const Vector3d dD1_ds((D1_next - D1) / ds);
-        const Vector3d dD2_ds((D2_next - D2) / ds);
-        const Vector3d dD3_ds((D3_next - D3) / ds);
-        const double N1 = a1 * (dD2_ds.dot(D3_half) - kappa1);
-        const double N2 = a2 * (dD3_ds.dot(D1_half) - kappa2);
-        const double N3 = a3 * (dD1_ds.dot(D2_half) - tau);
-        const Vector3d N_half = N1 * D1_half + N2 * D2_half + N3 * D3_half;
-
-        Eigen::Map<Vector3d> F_curr(&F_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> F_next(&F_next_node_vals[k * NDIM]);
-        F_curr = F_half;
-        F_next = -F_half;
-
-        Eigen::Map<Vector3d> N_curr(&N_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> N_next(&N_next_node_vals[k * NDIM]);
-        N_curr = N_half + 0.5 * (X_next - X).cross(F_half);
-        N_next = -N_half + 0.5 * (X_next - X).cross(F_half);
+        Vec local_form_vec;
+        ierr = VecGhostGetLocalForm(FN_ghost_data[j]->getVec(), &local_form_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSet(local_form_vec, 0.0);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGhostRestoreLocalForm(FN_ghost_data[j]->getVec(), &local_form_vec);
+        IBTK_CHKERRQ(ierr);
     }
 
-    ierr = VecRestoreArray(D_vec, &D_vals);
-    IBTK_CHKERRQ(ierr);
+    // Compute the rod forces and torques acting on the nodes of the Lagrangian
+    // mesh.
+    const int num_rods = static_cast<int>(d_petsc_curr_node_idxs[level_number].size());
+    if (num_rods > 0)
+    {
+        const int* const petsc_curr_node_idxs = &d_petsc_curr_node_idxs[level_number][0];
+        const int* const petsc_next_node_idxs = &d_petsc_next_node_idxs[level_number][0];
+        const boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS>* const material_params =
+            &d_material_params[level_number][0];
+        const double* const X_node = X_ghost_data->getGhostedLocalFormVecArray()->data();
+        const double* const D_node = D_ghost_data->getGhostedLocalFormVecArray()->data();
+        double* const F_node = F_ghost_data->getGhostedLocalFormVecArray()->data();
+        double* const N_node = N_ghost_data->getGhostedLocalFormVecArray()->data();
+
+        // The director triad of each node is stored as a 3x3 column-major
+        // matrix whose columns are the directors D1, D2, and D3.
+        typedef Eigen::Map<const Matrix3d> ConstTriadMap;
+        typedef Eigen::Map<const Vector3d> ConstVectorMap;
+        double D_block[9][BLOCKSIZE], D_next_block[9][BLOCKSIZE], D_half_block[9][BLOCKSIZE];
+        for (int k_block = 0; k_block < num_rods; k_block += BLOCKSIZE)
+        {
+            const int block_size = std::min(BLOCKSIZE, num_rods - k_block);
+            const int* const curr_idxs = petsc_curr_node_idxs + k_block;
+            const int* const next_idxs = petsc_next_node_idxs + k_block;
+            const boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS>* const params = material_params + k_block;
+            if (k_block + BLOCKSIZE < num_rods)
+            {
+                const int next_block_size = std::min(BLOCKSIZE, num_rods - k_block - BLOCKSIZE);
+                PREFETCH_READ_NTA_BLOCK(curr_idxs + BLOCKSIZE, next_block_size);
+                PREFETCH_READ_NTA_BLOCK(next_idxs + BLOCKSIZE, next_block_size);
+            }
 
-    ierr = VecRestoreArray(D_next_vec, &D_next_vals);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecDestroy(&D_next_vec);
-    IBTK_CHKERRQ(ierr);
+            // Compute the director triads at the midpoints of the rod elements,
+            // D_half = sqrt(D_next*D^T)*D.
+            for (int k = 0; k < block_size; ++k)
+            {
+                for (int l = 0; l < 9; ++l)
+                {
+                    D_block[l][k] = D_node[curr_idxs[k] * 3 * 3 + l];
+                    D_next_block[l][k] = D_node[next_idxs[k] * 3 * 3 + l];
+                }
+            }
+            compute_half_step_triads(D_half_block, D_block, D_next_block, block_size);
 
-    ierr = VecRestoreArray(X_vec, &X_vals);
-    IBTK_CHKERRQ(ierr);
+            // Compute the stretching, bending, and twisting forces and torques
+            // and accumulate them at the "current" and "next" nodes.
+            for (int k = 0; k < block_size; ++k)
+            {
+                const ConstTriadMap D(&D_node[curr_idxs[k] * 3 * 3]);
+                const ConstTriadMap D_next(&D_node[next_idxs[k] * 3 * 3]);
+                const ConstVectorMap X(&X_node[curr_idxs[k] * NDIM]);
+                const ConstVectorMap X_next(&X_node[next_idxs[k] * NDIM]);
+                const boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS>& p = params[k];
+                const double ds = p[0];
+                const Vector3d a(p[1], p[2], p[3]);
+                const Vector3d b(p[4], p[5], p[6]);
+                const Vector3d kappa(p[7], p[8], p[9]);
+                Matrix3d D_half;
+                for (int l = 0; l < 9; ++l)
+                {
+                    D_half.data()[l] = D_half_block[l][k];
+                }
+
+                // F_i = b_i*(D_i^{n+1/2} . dX/ds - delta_{i3}).
+                const Vector3d dX_ds((X_next - X) / ds);
+                Vector3d F_coefs = D_half.transpose() * dX_ds;
+                F_coefs(2) -= 1.0;
+                const Vector3d F_half = D_half * b.cwiseProduct(F_coefs);
+
+                // N_i = a_i*(dD_{i+1}/ds . D_{i+2}^{n+1/2} - kappa_i), with
+                // kappa_3 = tau.
+                const Matrix3d dD_ds((D_next - D) / ds);
+                const Vector3d N_coefs(dD_ds.col(1).dot(D_half.col(2)),
+                                       dD_ds.col(2).dot(D_half.col(0)),
+                                       dD_ds.col(0).dot(D_half.col(1)));
+                const Vector3d N_half = D_half * a.cwiseProduct(N_coefs - kappa);
+                const Vector3d N_F = 0.5 * (X_next - X).cross(F_half);
+
+                Eigen::Map<Vector3d> F_curr(&F_node[curr_idxs[k] * NDIM]);
+                Eigen::Map<Vector3d> F_next(&F_node[next_idxs[k] * NDIM]);
+                F_curr += F_half;
+                F_next -= F_half;
+
+                Eigen::Map<Vector3d> N_curr(&N_node[curr_idxs[k] * NDIM]);
+                Eigen::Map<Vector3d> N_next(&N_node[next_idxs[k] * NDIM]);
+                N_curr += N_half + N_F;
+                N_next += -N_half + N_F;
+            }
+        }
+        X_ghost_data->restoreArrays();
+        D_ghost_data->restoreArrays();
+        F_ghost_data->restoreArrays();
+        N_ghost_data->restoreArrays();
+    }
 
-    ierr = VecRestoreArray(X_next_vec, &X_next_vals);
+    // Add the locally computed forces and torques to the Lagrangian force and
+    // torque vectors.
+    //
+    // WARNING: The following operations may yield nondeterministic results in
+    // parallel environments (i.e., the order of summation may not be
+    // consistent).
+    if (workload_cost_model) workload_cost_model->startSynchronization();
+    ierr = VecGhostUpdateBegin(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
-    ierr = VecDestroy(&X_next_vec);
+    ierr = VecGhostUpdateBegin(N_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
-
-    Vec F_vec = F_data->getVec();
-    Vec N_vec = N_data->getVec();
-    if (local_sz > 0)
-    {
-        ierr = VecSetValuesBlocked(F_vec,
-                                   static_cast<int>(petsc_curr_node_idxs.size()),
-                                   &petsc_curr_node_idxs[0],
-                                   &F_curr_node_vals[0],
-                                   ADD_VALUES);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSetValuesBlocked(F_vec,
-                                   static_cast<int>(petsc_next_node_idxs.size()),
-                                   &petsc_next_node_idxs[0],
-                                   &F_next_node_vals[0],
-                                   ADD_VALUES);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSetValuesBlocked(N_vec,
-                                   static_cast<int>(petsc_curr_node_idxs.size()),
-                                   &petsc_curr_node_idxs[0],
-                                   &N_curr_node_vals[0],
-                                   ADD_VALUES);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSetValuesBlocked(N_vec,
-                                   static_cast<int>(petsc_next_node_idxs.size()),
-                                   &petsc_next_node_idxs[0],
-                                   &N_next_node_vals[0],
-                                   ADD_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-    ierr = VecAssemblyBegin(F_vec);
+    ierr = VecGhostUpdateEnd(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyBegin(N_vec);
+    ierr = VecGhostUpdateEnd(N_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(F_vec);
+    if (workload_cost_model) workload_cost_model->stopSynchronization();
+    ierr = VecAXPY(F_data->getVec(), 1.0, F_ghost_data->getVec());
     IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(N_vec);
+    ierr = VecAXPY(N_data->getVec(), 1.0, N_ghost_data->getVec());
     IBTK_CHKERRQ(ierr);
 
     IBAMR_TIMER_STOP(t_compute_lagrangian_force_and_torque);
@@ -87,6 +87,8 @@
 #include "ibtk/LNode.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/PETScMatUtilities.h"
+#include "ibtk/PhaseProfiler.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -170,6 +172,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_force_jac_mffd = false;
     d_do_log = false;
+    d_write_redistributable_restart_data = false;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -194,6 +197,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setWriteRedistributableRestartData(d_write_redistributable_restart_data);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -566,12 +570,6 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
     IBTK_CHKERRQ(ierr);
     *X_jac_needs_ghost_fill = true;
 
-    if (d_force_jac)
-    {
-        ierr = MatDestroy(&d_force_jac);
-        IBTK_CHKERRQ(ierr);
-        d_force_jac = NULL;
-    }
     d_force_jac_data_time = data_time;
     int n_local, n_global;
     ierr = VecGetLocalSize(X_vec, &n_local);
@@ -581,6 +579,12 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
 
     if (d_force_jac_mffd)
     {
+        if (d_force_jac)
+        {
+            ierr = MatDestroy(&d_force_jac);
+            IBTK_CHKERRQ(ierr);
+            d_force_jac = NULL;
+        }
         ierr = MatCreateMFFD(PETSC_COMM_WORLD, n_local, n_local, n_global, n_global, &d_force_jac);
         IBTK_CHKERRQ(ierr);
         ierr = MatMFFDSetFunction(d_force_jac, computeForce_SAMRAI, this);
@@ -598,31 +602,42 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
     }
     else
     {
-        std::vector<int> d_nnz, o_nnz;
-        d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
-            d_nnz, o_nnz, d_hierarchy, level_num, d_l_data_manager);
-        std::vector<int> d_nnz_unblocked(NDIM * d_nnz.size()), o_nnz_unblocked(NDIM * o_nnz.size());
-        for (unsigned int k = 0; k < d_nnz.size(); ++k)
+        // The nonzero structure of the Jacobian is fixed between redistributions
+        // of the Lagrangian data, so that the matrix is only created once per
+        // redistribution and its values are refreshed in place thereafter.
+        if (d_force_jac)
         {
-            for (unsigned int d = 0; d < NDIM; ++d)
+            ierr = MatZeroEntries(d_force_jac);
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            std::vector<int> d_nnz, o_nnz;
+            d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
+                d_nnz, o_nnz, d_hierarchy, level_num, d_l_data_manager);
+            std::vector<int> d_nnz_unblocked(NDIM * d_nnz.size()), o_nnz_unblocked(NDIM * o_nnz.size());
+            for (unsigned int k = 0; k < d_nnz.size(); ++k)
             {
-                d_nnz_unblocked[NDIM * k + d] = NDIM * d_nnz[k];
-                o_nnz_unblocked[NDIM * k + d] = NDIM * o_nnz[k];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_nnz_unblocked[NDIM * k + d] = NDIM * d_nnz[k];
+                    o_nnz_unblocked[NDIM * k + d] = NDIM * o_nnz[k];
+                }
             }
+            ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                                n_local,
+                                n_local,
+                                n_global,
+                                n_global,
+                                0,
+                                n_local ? &d_nnz_unblocked[0] : NULL,
+                                0,
+                                n_local ? &o_nnz_unblocked[0] : NULL,
+                                &d_force_jac);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetBlockSize(d_force_jac, NDIM);
+            IBTK_CHKERRQ(ierr);
         }
-        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                            n_local,
-                            n_local,
-                            n_global,
-                            n_global,
-                            0,
-                            n_local ? &d_nnz_unblocked[0] : NULL,
-                            0,
-                            n_local ? &o_nnz_unblocked[0] : NULL,
-                            &d_force_jac);
-        IBTK_CHKERRQ(ierr);
-        ierr = MatSetBlockSize(d_force_jac, NDIM);
-        IBTK_CHKERRQ(ierr);
         d_ib_force_fcn->computeLagrangianForceJacobian(d_force_jac,
                                                        MAT_FINAL_ASSEMBLY,
                                                        1.0,
@@ -691,6 +706,7 @@ IBMethod::interpolateVelocity(const int u_data_idx,
                               const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                               const double data_time)
 {
+    IBTK_PROFILER_SCOPE("IBMethod::interpolateVelocity");
     std::vector<Pointer<LData> > *U_data, *X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getVelocityData(&U_data, data_time);
@@ -844,6 +860,7 @@ IBMethod::hasFluidSources() const
 void
 IBMethod::computeLagrangianForce(const double data_time)
 {
+    IBTK_PROFILER_SCOPE("IBMethod::computeLagrangianForce");
     int ierr;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -997,6 +1014,7 @@ IBMethod::spreadForce(const int f_data_idx,
                       const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                       const double data_time)
 {
+    IBTK_PROFILER_SCOPE("IBMethod::spreadForce");
     std::vector<Pointer<LData> > *F_data, *X_LE_data;
     bool *F_needs_ghost_fill, *X_LE_needs_ghost_fill;
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
@@ -1522,6 +1540,34 @@ IBMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
     return;
 } // updateWorkloadEstimates
 
+void
+IBMethod::setWorkloadWeights(const double node_weight, double /*quad_point_weight*/)
+{
+    d_l_data_manager->setNodeWorkloadWeight(node_weight);
+    return;
+} // setWorkloadWeights
+
+void
+IBMethod::getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const
+{
+    num_local_nodes = 0.0;
+    num_local_quad_points = 0.0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        num_local_nodes += static_cast<double>(d_l_data_manager->getNumberOfLocalNodes(ln));
+    }
+    return;
+} // getLocalWorkloadCounts
+
+void
+IBMethod::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    d_l_data_manager->registerWorkloadCostModel(workload_cost_model);
+    return;
+} // registerWorkloadCostModel
+
 void IBMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                        Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -1585,6 +1631,16 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
     // Indicate that the force and source strategies need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
+
+    // Deallocate any previously allocated Jacobian data structures, whose
+    // nonzero structure depends on the distribution of the Lagrangian data.
+    if (d_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_force_jac);
+        IBTK_CHKERRQ(ierr);
+        d_force_jac = NULL;
+    }
     return;
 } // endDataRedistribution
 
@@ -2070,6 +2126,8 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("write_redistributable_restart_data"))
+        d_write_redistributable_restart_data = db->getBool("write_redistributable_restart_data");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
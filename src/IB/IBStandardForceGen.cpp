@@ -58,6 +58,7 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
@@ -123,6 +124,29 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+inline void
+addJacobianBlock(std::vector<double>& vals, const int offset, const int stride, const MatrixNd& A)
+{
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            vals[offset + i * stride + j] += A(i, j);
+        }
+    }
+    return;
+} // addJacobianBlock
+
+inline void
+addJacobianBlock(std::vector<double>& vals, const int offset, const int stride, const double a)
+{
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        vals[offset + i * stride + i] += a;
+    }
+    return;
+} // addJacobianBlock
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -157,6 +181,13 @@ IBStandardForceGen::registerSpringForceFunction(const int force_fcn_index,
 {
     d_spring_force_fcn_map[force_fcn_index] = spring_force_fcn_ptr;
     d_spring_force_deriv_fcn_map[force_fcn_index] = spring_force_deriv_fcn_ptr;
+
+    // Use the analytic derivatives of the built-in force functions whenever
+    // they are available.
+    if (!spring_force_deriv_fcn_ptr && spring_force_fcn_ptr == &default_spring_force)
+    {
+        d_spring_force_deriv_fcn_map[force_fcn_index] = &default_spring_force_deriv;
+    }
     return;
 } // registerSpringForceFunction
 
@@ -181,6 +212,7 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     d_spring_data.resize(new_size);
     d_beam_data.resize(new_size);
     d_target_point_data.resize(new_size);
+    d_jacobian_data.resize(new_size);
     d_X_ghost_data.resize(new_size);
     d_F_ghost_data.resize(new_size);
     d_dX_data.resize(new_size);
@@ -296,6 +328,9 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
                    d_target_point_data[level_number].petsc_global_node_idxs.begin(),
                    std::bind2nd(std::multiplies<int>(), NDIM));
 
+    // Setup the layout of the force Jacobian.
+    initializeJacobianLevelData(level_number);
+
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
     return;
@@ -328,10 +363,13 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     Pointer<LData> dX_data = d_dX_data[level_number];
     ierr = VecAXPBYPCZ(X_ghost_data->getVec(), 1.0, 1.0, 0.0, X_data->getVec(), dX_data->getVec());
     IBTK_CHKERRQ(ierr);
+    Pointer<WorkloadCostModel> workload_cost_model = l_data_manager->getWorkloadCostModel();
+    if (workload_cost_model) workload_cost_model->startSynchronization();
     ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
+    if (workload_cost_model) workload_cost_model->stopSynchronization();
 
     // Compute the forces.
     computeLagrangianSpringForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
@@ -344,10 +382,12 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     // WARNING: The following operations may yield nondeterministic results in
     // parallel environments (i.e., the order of summation may not be
     // consistent).
+    if (workload_cost_model) workload_cost_model->startSynchronization();
     ierr = VecGhostUpdateBegin(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostUpdateEnd(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
+    if (workload_cost_model) workload_cost_model->stopSynchronization();
     ierr = VecAXPY(F_data->getVec(), 1.0, F_ghost_data->getVec());
     return;
 } // computeLagrangianForce
@@ -564,16 +604,23 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
     ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
 
+    // The Jacobian blocks are accumulated into the precomputed block sparse
+    // layout and then passed to PETSc one block row at a time.
+    JacobianData& jac_data = d_jacobian_data[level_number];
+    std::vector<double>& jac_vals = jac_data.vals;
+    const std::vector<int>& block_offsets = jac_data.block_offsets;
+    const std::vector<int>& block_strides = jac_data.block_strides;
+    std::fill(jac_vals.begin(), jac_vals.end(), 0.0);
+
     { // Spring forces.
         const std::vector<int>& lag_mastr_node_idxs = d_spring_data[level_number].lag_mastr_node_idxs;
         const std::vector<int>& lag_slave_node_idxs = d_spring_data[level_number].lag_slave_node_idxs;
         const std::vector<int>& petsc_mastr_node_idxs = d_spring_data[level_number].petsc_mastr_node_idxs;
         const std::vector<int>& petsc_slave_node_idxs = d_spring_data[level_number].petsc_slave_node_idxs;
-        const std::vector<int>& petsc_global_mastr_node_idxs = d_spring_data[level_number].petsc_global_mastr_node_idxs;
-        const std::vector<int>& petsc_global_slave_node_idxs = d_spring_data[level_number].petsc_global_slave_node_idxs;
         const std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
         const std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
         const std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
+        const std::vector<int>& slots = jac_data.spring_slots;
         const double* const X_node = X_ghost_data->getGhostedLocalFormVecArray()->data();
         MatrixNd dF_dX;
         Vector D;
@@ -584,10 +631,8 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
             // "master" node with respect to the position of the "slave" node.
             const int& lag_mastr_idx = lag_mastr_node_idxs[k];
             const int& lag_slave_idx = lag_slave_node_idxs[k];
-            int petsc_mastr_idx = petsc_mastr_node_idxs[k];
-            int petsc_slave_idx = petsc_slave_node_idxs[k];
-            int petsc_global_mastr_idx = petsc_global_mastr_node_idxs[k];
-            int petsc_global_slave_idx = petsc_global_slave_node_idxs[k];
+            const int& petsc_mastr_idx = petsc_mastr_node_idxs[k];
+            const int& petsc_slave_idx = petsc_slave_node_idxs[k];
             const SpringForceFcnPtr force_fcn = force_fcns[k];
             const SpringForceDerivFcnPtr force_deriv_fcn = force_deriv_fcns[k];
             const double* const params = parameters[k];
@@ -630,17 +675,10 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
                 }
             }
 
-            // Rows and cols for blocked matrix.
-            petsc_global_mastr_idx /= NDIM;
-            petsc_global_slave_idx /= NDIM;
-
             // Accumulate the off-diagonal parts of the matrix.
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_slave_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_slave_idx, 1, &petsc_global_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
+            const int* const spring_slots = &slots[4 * k];
+            addJacobianBlock(jac_vals, block_offsets[spring_slots[0]], block_strides[spring_slots[0]], dF_dX);
+            addJacobianBlock(jac_vals, block_offsets[spring_slots[1]], block_strides[spring_slots[1]], dF_dX);
 
             // Negate dF_dX to obtain the Jacobian of the force applied by the
             // spring to the "master" node with respect to the position of the
@@ -648,92 +686,61 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
             dF_dX *= -1.0;
 
             // Accumulate the diagonal parts of the matrix.
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_slave_idx, 1, &petsc_global_slave_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
+            addJacobianBlock(jac_vals, block_offsets[spring_slots[2]], block_strides[spring_slots[2]], dF_dX);
+            addJacobianBlock(jac_vals, block_offsets[spring_slots[3]], block_strides[spring_slots[3]], dF_dX);
         }
     }
 
     { // Beam forces.
-        const std::vector<int>& petsc_global_mastr_node_idxs = d_beam_data[level_number].petsc_global_mastr_node_idxs;
-        const std::vector<int>& petsc_global_next_node_idxs = d_beam_data[level_number].petsc_global_next_node_idxs;
-        const std::vector<int>& petsc_global_prev_node_idxs = d_beam_data[level_number].petsc_global_prev_node_idxs;
         const std::vector<const double*>& rigidities = d_beam_data[level_number].rigidities;
-        MatrixNd dF_dX(MatrixNd::Zero());
-        for (unsigned int k = 0; k < petsc_global_mastr_node_idxs.size(); ++k)
+        const std::vector<int>& slots = jac_data.beam_slots;
+        for (unsigned int k = 0; k < rigidities.size(); ++k)
         {
-            const int petsc_global_mastr_idx = petsc_global_mastr_node_idxs[k] / NDIM; // block indices
-            const int petsc_global_next_idx = petsc_global_next_node_idxs[k] / NDIM;
-            const int petsc_global_prev_idx = petsc_global_prev_node_idxs[k] / NDIM;
             const double& bend = *rigidities[k];
-
-            for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
-            {
-                dF_dX(alpha, alpha) = -1.0 * bend * X_coef;
-            }
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_prev_idx, 1, &petsc_global_prev_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_prev_idx, 1, &petsc_global_next_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_next_idx, 1, &petsc_global_prev_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_next_idx, 1, &petsc_global_next_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-
-            for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
+            const int* const beam_slots = &slots[9 * k];
+            for (unsigned int l = 0; l < 4; ++l)
             {
-                dF_dX(alpha, alpha) = +2.0 * bend * X_coef;
+                addJacobianBlock(
+                    jac_vals, block_offsets[beam_slots[l]], block_strides[beam_slots[l]], -1.0 * bend * X_coef);
             }
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_prev_idx, 1, &petsc_global_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_next_idx, 1, &petsc_global_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_prev_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_next_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-
-            for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
+            for (unsigned int l = 4; l < 8; ++l)
             {
-                dF_dX(alpha, alpha) = -4.0 * bend * X_coef;
+                addJacobianBlock(
+                    jac_vals, block_offsets[beam_slots[l]], block_strides[beam_slots[l]], +2.0 * bend * X_coef);
             }
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
+            addJacobianBlock(jac_vals, block_offsets[beam_slots[8]], block_strides[beam_slots[8]], -4.0 * bend * X_coef);
         }
     }
 
     { // Target point forces.
-        const std::vector<int>& petsc_global_node_idxs = d_target_point_data[level_number].petsc_global_node_idxs;
         const std::vector<const double*>& kappa = d_target_point_data[level_number].kappa;
         const std::vector<const double*>& eta = d_target_point_data[level_number].eta;
-        MatrixNd dF_dX(MatrixNd::Zero());
-        for (unsigned int k = 0; k < petsc_global_node_idxs.size(); ++k)
+        const std::vector<int>& slots = jac_data.target_point_slots;
+        for (unsigned int k = 0; k < kappa.size(); ++k)
         {
-            const int petsc_global_node_idx = petsc_global_node_idxs[k] / NDIM; // block index
             const double& K = *kappa[k];
             const double& E = *eta[k];
-            for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
-            {
-                dF_dX(alpha, alpha) = -X_coef * K - U_coef * E;
-            }
-            ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_node_idx, 1, &petsc_global_node_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
+            addJacobianBlock(jac_vals, block_offsets[slots[k]], block_strides[slots[k]], -X_coef * K - U_coef * E);
         }
     }
 
+    // Pass the accumulated values to PETSc.
+    const std::vector<int>& block_rows = jac_data.block_rows;
+    const std::vector<int>& block_row_ptr = jac_data.block_row_ptr;
+    const std::vector<int>& block_cols = jac_data.block_cols;
+    for (unsigned int r = 0; r < block_rows.size(); ++r)
+    {
+        const int n_cols = block_row_ptr[r + 1] - block_row_ptr[r];
+        ierr = MatSetValuesBlocked(J_mat,
+                                   1,
+                                   &block_rows[r],
+                                   n_cols,
+                                   &block_cols[block_row_ptr[r]],
+                                   &jac_vals[block_offsets[block_row_ptr[r]]],
+                                   ADD_VALUES);
+        IBTK_CHKERRQ(ierr);
+    }
+
     // Assemble the matrix.
     ierr = MatAssemblyBegin(J_mat, assembly_type);
     IBTK_CHKERRQ(ierr);
@@ -761,6 +768,106 @@ IBStandardForceGen::computeLagrangianEnergy(Pointer<LData> /*X_data*/,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+IBStandardForceGen::initializeJacobianLevelData(const int level_number)
+{
+    JacobianData& jac_data = d_jacobian_data[level_number];
+
+    // Collect the (row, column) block indices of all Jacobian blocks touched by
+    // the local force specifications, in the order in which they are
+    // accumulated by computeLagrangianForceJacobian().
+    std::vector<std::pair<int, int> > spec_blocks;
+    {
+        const std::vector<int>& petsc_global_mastr_node_idxs = d_spring_data[level_number].petsc_global_mastr_node_idxs;
+        const std::vector<int>& petsc_global_slave_node_idxs = d_spring_data[level_number].petsc_global_slave_node_idxs;
+        for (unsigned int k = 0; k < petsc_global_mastr_node_idxs.size(); ++k)
+        {
+            const int mastr_idx = petsc_global_mastr_node_idxs[k] / NDIM;
+            const int slave_idx = petsc_global_slave_node_idxs[k] / NDIM;
+            spec_blocks.push_back(std::make_pair(mastr_idx, slave_idx));
+            spec_blocks.push_back(std::make_pair(slave_idx, mastr_idx));
+            spec_blocks.push_back(std::make_pair(mastr_idx, mastr_idx));
+            spec_blocks.push_back(std::make_pair(slave_idx, slave_idx));
+        }
+    }
+    const size_t n_spring_blocks = spec_blocks.size();
+    {
+        const std::vector<int>& petsc_global_mastr_node_idxs = d_beam_data[level_number].petsc_global_mastr_node_idxs;
+        const std::vector<int>& petsc_global_next_node_idxs = d_beam_data[level_number].petsc_global_next_node_idxs;
+        const std::vector<int>& petsc_global_prev_node_idxs = d_beam_data[level_number].petsc_global_prev_node_idxs;
+        for (unsigned int k = 0; k < petsc_global_mastr_node_idxs.size(); ++k)
+        {
+            const int mastr_idx = petsc_global_mastr_node_idxs[k] / NDIM;
+            const int next_idx = petsc_global_next_node_idxs[k] / NDIM;
+            const int prev_idx = petsc_global_prev_node_idxs[k] / NDIM;
+            spec_blocks.push_back(std::make_pair(prev_idx, prev_idx));
+            spec_blocks.push_back(std::make_pair(prev_idx, next_idx));
+            spec_blocks.push_back(std::make_pair(next_idx, prev_idx));
+            spec_blocks.push_back(std::make_pair(next_idx, next_idx));
+            spec_blocks.push_back(std::make_pair(prev_idx, mastr_idx));
+            spec_blocks.push_back(std::make_pair(next_idx, mastr_idx));
+            spec_blocks.push_back(std::make_pair(mastr_idx, prev_idx));
+            spec_blocks.push_back(std::make_pair(mastr_idx, next_idx));
+            spec_blocks.push_back(std::make_pair(mastr_idx, mastr_idx));
+        }
+    }
+    const size_t n_beam_blocks = spec_blocks.size() - n_spring_blocks;
+    {
+        const std::vector<int>& petsc_global_node_idxs = d_target_point_data[level_number].petsc_global_node_idxs;
+        for (unsigned int k = 0; k < petsc_global_node_idxs.size(); ++k)
+        {
+            const int node_idx = petsc_global_node_idxs[k] / NDIM;
+            spec_blocks.push_back(std::make_pair(node_idx, node_idx));
+        }
+    }
+
+    // Determine the block sparse layout.
+    std::vector<std::pair<int, int> > blocks(spec_blocks);
+    std::sort(blocks.begin(), blocks.end());
+    blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+    const int n_blocks = static_cast<int>(blocks.size());
+    jac_data.block_rows.clear();
+    jac_data.block_row_ptr.clear();
+    jac_data.block_cols.resize(n_blocks);
+    for (int b = 0; b < n_blocks; ++b)
+    {
+        if (b == 0 || blocks[b].first != blocks[b - 1].first)
+        {
+            jac_data.block_rows.push_back(blocks[b].first);
+            jac_data.block_row_ptr.push_back(b);
+        }
+        jac_data.block_cols[b] = blocks[b].second;
+    }
+    jac_data.block_row_ptr.push_back(n_blocks);
+
+    // Determine the location of each block within the value array.
+    jac_data.block_offsets.resize(n_blocks);
+    jac_data.block_strides.resize(n_blocks);
+    int row_offset = 0;
+    for (unsigned int r = 0; r + 1 < jac_data.block_row_ptr.size(); ++r)
+    {
+        const int n_cols = jac_data.block_row_ptr[r + 1] - jac_data.block_row_ptr[r];
+        for (int b = jac_data.block_row_ptr[r]; b < jac_data.block_row_ptr[r + 1]; ++b)
+        {
+            jac_data.block_offsets[b] = row_offset + (b - jac_data.block_row_ptr[r]) * NDIM;
+            jac_data.block_strides[b] = n_cols * NDIM;
+        }
+        row_offset += NDIM * NDIM * n_cols;
+    }
+    jac_data.vals.resize(row_offset);
+
+    // Map each force specification to the blocks that it touches.
+    std::vector<int> slots(spec_blocks.size());
+    for (unsigned int l = 0; l < spec_blocks.size(); ++l)
+    {
+        slots[l] = static_cast<int>(std::lower_bound(blocks.begin(), blocks.end(), spec_blocks[l]) - blocks.begin());
+    }
+    jac_data.spring_slots.assign(slots.begin(), slots.begin() + n_spring_blocks);
+    jac_data.beam_slots.assign(slots.begin() + n_spring_blocks, slots.begin() + n_spring_blocks + n_beam_blocks);
+    jac_data.target_point_slots.assign(slots.begin() + n_spring_blocks + n_beam_blocks, slots.end());
+    return;
+} // initializeJacobianLevelData
+
 void
 IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_set,
                                               const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
@@ -53,6 +53,7 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -256,6 +257,28 @@ IBStrategy::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/
     return;
 } // updateWorkloadEstimates
 
+void
+IBStrategy::setWorkloadWeights(double /*node_weight*/, double /*quad_point_weight*/)
+{
+    // intentionally blank
+    return;
+} // setWorkloadWeights
+
+void
+IBStrategy::getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const
+{
+    num_local_nodes = 0.0;
+    num_local_quad_points = 0.0;
+    return;
+} // getLocalWorkloadCounts
+
+void
+IBStrategy::registerWorkloadCostModel(Pointer<WorkloadCostModel> /*workload_cost_model*/)
+{
+    // intentionally blank
+    return;
+} // registerWorkloadCostModel
+
 void IBStrategy::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                          Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
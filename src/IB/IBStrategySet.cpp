@@ -44,6 +44,7 @@
 #include "ibamr/IBStrategy.h"
 #include "ibamr/IBStrategySet.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/WorkloadCostModel.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -378,6 +379,44 @@ IBStrategySet::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // updateWorkloadEstimates
 
+void
+IBStrategySet::setWorkloadWeights(const double node_weight, const double quad_point_weight)
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->setWorkloadWeights(node_weight, quad_point_weight);
+    }
+    return;
+} // setWorkloadWeights
+
+void
+IBStrategySet::getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const
+{
+    num_local_nodes = 0.0;
+    num_local_quad_points = 0.0;
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        double strategy_num_local_nodes, strategy_num_local_quad_points;
+        (*cit)->getLocalWorkloadCounts(strategy_num_local_nodes, strategy_num_local_quad_points);
+        num_local_nodes += strategy_num_local_nodes;
+        num_local_quad_points += strategy_num_local_quad_points;
+    }
+    return;
+} // getLocalWorkloadCounts
+
+void
+IBStrategySet::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->registerWorkloadCostModel(workload_cost_model);
+    }
+    return;
+} // registerWorkloadCostModel
+
 void
 IBStrategySet::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                        Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
@@ -66,7 +66,6 @@
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
-#include "boost/array.hpp"
 #include "boost/math/special_functions/round.hpp"
 #include "boost/multi_array.hpp"
 #include "ibamr/IMPMethod.h"
@@ -86,6 +85,7 @@
 #include "ibtk/LSetData.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCostModel.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/tensor_value.h"
 #include "libmesh/type_tensor.h"
@@ -116,6 +116,7 @@ namespace
 {
 static const std::string KERNEL_FCN = "IB_6";
 static const int kernel_width = 3;
+static const int kernel_stencil_size = 2 * kernel_width;
 void
 kernel(const double X,
        const double patch_x_lower,
@@ -125,8 +126,8 @@ kernel(const double X,
        const int /*patch_box_upper*/,
        int& stencil_box_lower,
        int& stencil_box_upper,
-       boost::multi_array<double, 1>& phi,
-       boost::multi_array<double, 1>& dphi)
+       double* const phi,
+       double* const dphi)
 {
     const double X_o_dx = (X - patch_x_lower) / dx;
     stencil_box_lower = boost::math::round(X_o_dx) + patch_box_lower - kernel_width;
@@ -171,6 +172,134 @@ kernel(const double X,
     return;
 }
 
+// Interpolate one component of side-centered data u, which is stored on the
+// index space u_box, along with its gradient over the portion of a separable
+// kernel stencil that lies within box.  The arrays phi[d] and dphi_dx[d] store
+// the 1D kernel weights along axis d and their spatial derivatives, indexed
+// relative to stencil_lower(d).  The stencil is traversed one contiguous row at
+// a time, and the 1D weights along the remaining axes are applied to the row
+// sums.
+inline void
+interpolate_component(double& U,
+                      double* const Grad_U,
+                      const double* const u,
+                      const Box<NDIM>& u_box,
+                      const Box<NDIM>& box,
+                      const int* const stencil_lower,
+                      const double* const phi[NDIM],
+                      const double* const dphi_dx[NDIM])
+{
+    const int n = box.upper(0) - box.lower(0) + 1;
+    if (n <= 0) return;
+    const double* const phi0 = phi[0] + (box.lower(0) - stencil_lower[0]);
+    const double* const dphi0 = dphi_dx[0] + (box.lower(0) - stencil_lower[0]);
+    const int u_n0 = u_box.numberCells(0);
+#if (NDIM == 2)
+    for (int i1 = box.lower(1); i1 <= box.upper(1); ++i1)
+    {
+        const double* const u_row = u + (box.lower(0) - u_box.lower(0)) + (i1 - u_box.lower(1)) * u_n0;
+        double s = 0.0, ds0 = 0.0;
+        for (int k = 0; k < n; ++k)
+        {
+            s += u_row[k] * phi0[k];
+            ds0 += u_row[k] * dphi0[k];
+        }
+        const double phi1 = phi[1][i1 - stencil_lower[1]];
+        const double dphi1 = dphi_dx[1][i1 - stencil_lower[1]];
+        U += phi1 * s;
+        Grad_U[0] -= phi1 * ds0;
+        Grad_U[1] -= dphi1 * s;
+    }
+#endif
+#if (NDIM == 3)
+    const int u_n1 = u_box.numberCells(1);
+    for (int i2 = box.lower(2); i2 <= box.upper(2); ++i2)
+    {
+        double s = 0.0, ds0 = 0.0, ds1 = 0.0;
+        for (int i1 = box.lower(1); i1 <= box.upper(1); ++i1)
+        {
+            const double* const u_row =
+                u + (box.lower(0) - u_box.lower(0)) + ((i1 - u_box.lower(1)) + (i2 - u_box.lower(2)) * u_n1) * u_n0;
+            double s_row = 0.0, ds0_row = 0.0;
+            for (int k = 0; k < n; ++k)
+            {
+                s_row += u_row[k] * phi0[k];
+                ds0_row += u_row[k] * dphi0[k];
+            }
+            const double phi1 = phi[1][i1 - stencil_lower[1]];
+            const double dphi1 = dphi_dx[1][i1 - stencil_lower[1]];
+            s += phi1 * s_row;
+            ds0 += phi1 * ds0_row;
+            ds1 += dphi1 * s_row;
+        }
+        const double phi2 = phi[2][i2 - stencil_lower[2]];
+        const double dphi2 = dphi_dx[2][i2 - stencil_lower[2]];
+        U += phi2 * s;
+        Grad_U[0] -= phi2 * ds0;
+        Grad_U[1] -= phi2 * ds1;
+        Grad_U[2] -= dphi2 * s;
+    }
+#endif
+    return;
+} // interpolate_component
+
+// Spread the divergence of one row of the stress tau, scaled by scale, to one
+// component of side-centered data f, which is stored on the index space f_box,
+// over the portion of a separable kernel stencil that lies within box.  The
+// kernel weights are stored as in interpolate_component().
+inline void
+spread_component(double* const f,
+                 const Box<NDIM>& f_box,
+                 const Box<NDIM>& box,
+                 const int* const stencil_lower,
+                 const double* const phi[NDIM],
+                 const double* const dphi_dx[NDIM],
+                 const double* const tau,
+                 const double scale)
+{
+    const int n = box.upper(0) - box.lower(0) + 1;
+    if (n <= 0) return;
+    const double* const phi0 = phi[0] + (box.lower(0) - stencil_lower[0]);
+    const double* const dphi0 = dphi_dx[0] + (box.lower(0) - stencil_lower[0]);
+    const int f_n0 = f_box.numberCells(0);
+#if (NDIM == 2)
+    for (int i1 = box.lower(1); i1 <= box.upper(1); ++i1)
+    {
+        const double phi1 = phi[1][i1 - stencil_lower[1]];
+        const double dphi1 = dphi_dx[1][i1 - stencil_lower[1]];
+        const double a = scale * tau[0] * phi1;
+        const double b = scale * tau[1] * dphi1;
+        double* const f_row = f + (box.lower(0) - f_box.lower(0)) + (i1 - f_box.lower(1)) * f_n0;
+        for (int k = 0; k < n; ++k)
+        {
+            f_row[k] += a * dphi0[k] + b * phi0[k];
+        }
+    }
+#endif
+#if (NDIM == 3)
+    const int f_n1 = f_box.numberCells(1);
+    for (int i2 = box.lower(2); i2 <= box.upper(2); ++i2)
+    {
+        const double phi2 = phi[2][i2 - stencil_lower[2]];
+        const double dphi2 = dphi_dx[2][i2 - stencil_lower[2]];
+        for (int i1 = box.lower(1); i1 <= box.upper(1); ++i1)
+        {
+            const double phi1 = phi[1][i1 - stencil_lower[1]];
+            const double dphi1 = dphi_dx[1][i1 - stencil_lower[1]];
+            const double a = scale * tau[0] * phi1 * phi2;
+            const double b = scale * (tau[1] * dphi1 * phi2 + tau[2] * phi1 * dphi2);
+            double* const f_row =
+                f + (box.lower(0) - f_box.lower(0)) + ((i1 - f_box.lower(1)) + (i2 - f_box.lower(2)) * f_n1) * f_n0;
+            for (int k = 0; k < n; ++k)
+            {
+                f_row[k] += a * dphi0[k] + b * phi0[k];
+            }
+        }
+    }
+#endif
+    return;
+} // spread_component
+
 // Version of IMPMethod restart file data.
 static const int IMP_METHOD_VERSION = 1;
 }
@@ -446,6 +575,7 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
 
     // Interpolate data from the Eulerian grid to the Lagrangian mesh.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    d_transfer_weights.resize(finest_ln + 1);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -456,6 +586,8 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
         boost::multi_array_ref<double, 2>& U_array = *(*U_data)[ln]->getLocalFormVecArray();
         boost::multi_array_ref<double, 2>& Grad_U_array = *(*Grad_U_data)[ln]->getLocalFormVecArray();
         boost::multi_array_ref<double, 2>& X_array = *(*X_data)[ln]->getLocalFormVecArray();
+        TransferWeights& weights = d_transfer_weights[ln];
+        unsigned int entry = 0;
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
@@ -467,86 +599,52 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
             const double* const x_lower = patch_geom->getXLower();
             const double* const x_upper = patch_geom->getXUpper();
             const double* const dx = patch_geom->getDx();
-            Box<NDIM> side_boxes[NDIM];
+            Box<NDIM> side_boxes[NDIM], u_ghost_boxes[NDIM];
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(u_data->getGhostBox() * idx_data->getGhostBox(), axis);
+                u_ghost_boxes[axis] = SideGeometry<NDIM>::toSideBox(u_data->getGhostBox(), axis);
             }
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const Index<NDIM>& i = *it;
                 LNodeSet* const node_set = idx_data->getItem(i);
                 if (!node_set) continue;
-                for (LNodeSet::iterator it = node_set->begin(); it != node_set->end(); ++it)
+                for (LNodeSet::iterator it = node_set->begin(); it != node_set->end(); ++it, ++entry)
                 {
                     const LNode* const node_idx = *it;
                     const int local_idx = node_idx->getLocalPETScIndex();
                     const double* const X = &X_array[local_idx][0];
-                    VectorValue<double> U;
-                    TensorValue<double> Grad_U;
+                    double* const U = &U_array[local_idx][0];
+                    double* const Grad_U = &Grad_U_array[local_idx][0];
+                    for (int k = 0; k < NDIM; ++k) U[k] = 0.0;
+                    for (int k = 0; k < NDIM * NDIM; ++k) Grad_U[k] = 0.0;
 
                     // Interpolate U and Grad U using a smoothed kernel
                     // function evaluated about X.
-                    Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    boost::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
-                    }
+                    updateTransferWeights(weights, entry, local_idx, X, patch_box, x_lower, x_upper, dx);
                     for (unsigned int component = 0; component < NDIM; ++component)
                     {
+                        const int offset = (entry * NDIM + component) * NDIM;
+                        const int* const stencil_lower = &weights.stencil_lower[offset];
+                        const double* phi[NDIM];
+                        const double* dphi_dx[NDIM];
+                        Box<NDIM> stencil_box;
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            kernel(X[d],
-                                   x_lower[d] + (d == component ? -0.5 * dx[d] : 0.0),
-                                   x_upper[d] + (d == component ? +0.5 * dx[d] : 0.0),
-                                   dx[d],
-                                   patch_box.lower(d),
-                                   patch_box.upper(d) + (d == component ? 1 : 0),
-                                   stencil_box.lower(d),
-                                   stencil_box.upper(d),
-                                   phi[d],
-                                   dphi[d]);
-                        }
-                        for (Box<NDIM>::Iterator b(stencil_box * side_boxes[component]); b; b++)
-                        {
-                            const Index<NDIM>& i = b();
-                            const Index<NDIM> i_shift = i - stencil_box.lower();
-                            const SideIndex<NDIM> i_s(i, component, SideIndex<NDIM>::Lower);
-                            const double u = (*u_data)(i_s);
-                            double w = 1.0;
-                            for (unsigned int d = 0; d < NDIM; ++d)
-                            {
-                                w *= phi[d][i_shift(d)];
-                            }
-                            U(component) += u * w;
-                            for (unsigned int k = 0; k < NDIM; ++k)
-                            {
-                                double dw_dx_k = 1.0;
-                                for (unsigned int d = 0; d < NDIM; ++d)
-                                {
-                                    if (d == k)
-                                    {
-                                        dw_dx_k *= dphi[d][i_shift(d)] / dx[d];
-                                    }
-                                    else
-                                    {
-                                        dw_dx_k *= phi[d][i_shift(d)];
-                                    }
-                                }
-                                Grad_U(component, k) -= u * dw_dx_k;
-                            }
-                        }
-                    }
-                    for (int i = 0; i < NDIM; ++i)
-                    {
-                        U_array[local_idx][i] = U(i);
-                        for (int j = 0; j < NDIM; ++j)
-                        {
-                            Grad_U_array[local_idx][NDIM * i + j] = Grad_U(i, j);
+                            phi[d] = &weights.phi[(offset + d) * kernel_stencil_size];
+                            dphi_dx[d] = &weights.dphi_dx[(offset + d) * kernel_stencil_size];
+                            stencil_box.lower(d) = stencil_lower[d];
+                            stencil_box.upper(d) = stencil_lower[d] + kernel_stencil_size - 1;
                         }
+                        interpolate_component(U[component],
+                                              &Grad_U[NDIM * component],
+                                              u_data->getPointer(component),
+                                              u_ghost_boxes[component],
+                                              stencil_box * side_boxes[component],
+                                              stencil_lower,
+                                              phi,
+                                              dphi_dx);
                     }
                 }
             }
@@ -845,11 +943,14 @@ IMPMethod::spreadForce(const int f_data_idx,
 
     // Spread data from the Lagrangian mesh to the Eulerian grid.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    d_transfer_weights.resize(finest_ln + 1);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
         boost::multi_array_ref<double, 2>& X_array = *(*X_data)[ln]->getGhostedLocalFormVecArray();
         boost::multi_array_ref<double, 2>& tau_array = *d_tau_data[ln]->getGhostedLocalFormVecArray();
+        TransferWeights& weights = d_transfer_weights[ln];
+        unsigned int entry = 0;
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
@@ -857,8 +958,12 @@ IMPMethod::spreadForce(const int f_data_idx,
             Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_data_idx);
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_l_data_manager->getLNodePatchDescriptorIndex());
             const Box<NDIM>& patch_box = patch->getBox();
-            Box<NDIM> side_boxes[NDIM];
-            for (unsigned int d = 0; d < NDIM; ++d) side_boxes[d] = SideGeometry<NDIM>::toSideBox(patch_box, d);
+            Box<NDIM> side_boxes[NDIM], f_ghost_boxes[NDIM];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                side_boxes[d] = SideGeometry<NDIM>::toSideBox(patch_box, d);
+                f_ghost_boxes[d] = SideGeometry<NDIM>::toSideBox(f_data->getGhostBox(), d);
+            }
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const x_lower = patch_geom->getXLower();
             const double* const x_upper = patch_geom->getXUpper();
@@ -870,7 +975,7 @@ IMPMethod::spreadForce(const int f_data_idx,
                 const Index<NDIM>& i = *it;
                 LNodeSet* const node_set = idx_data->getItem(i);
                 if (!node_set) continue;
-                for (LNodeSet::iterator it = node_set->begin(); it != node_set->end(); ++it)
+                for (LNodeSet::iterator it = node_set->begin(); it != node_set->end(); ++it, ++entry)
                 {
                     const LNode* const node_idx = *it;
                     MaterialPointSpec* mp_spec = node_idx->getNodeDataItem<MaterialPointSpec>();
@@ -878,64 +983,33 @@ IMPMethod::spreadForce(const int f_data_idx,
                     const double wgt = mp_spec->getWeight();
                     const int local_idx = node_idx->getLocalPETScIndex();
                     const double* const X = &X_array[local_idx][0];
-                    TensorValue<double> tau;
-                    for (int i = 0; i < NDIM; ++i)
-                    {
-                        for (int j = 0; j < NDIM; ++j)
-                        {
-                            tau(i, j) = tau_array[local_idx][NDIM * i + j];
-                        }
-                    }
+                    const double* const tau = &tau_array[local_idx][0];
 
                     // Weight tau using a smooth kernel function evaluated about
                     // X.
-                    Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    boost::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
-                    }
+                    updateTransferWeights(weights, entry, local_idx, X, patch_box, x_lower, x_upper, dx);
                     for (unsigned int component = 0; component < NDIM; ++component)
                     {
+                        const int offset = (entry * NDIM + component) * NDIM;
+                        const int* const stencil_lower = &weights.stencil_lower[offset];
+                        const double* phi[NDIM];
+                        const double* dphi_dx[NDIM];
+                        Box<NDIM> stencil_box;
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            kernel(X[d],
-                                   x_lower[d] + (d == component ? -0.5 * dx[d] : 0.0),
-                                   x_upper[d] + (d == component ? +0.5 * dx[d] : 0.0),
-                                   dx[d],
-                                   patch_box.lower(d),
-                                   patch_box.upper(d) + (d == component ? 1 : 0),
-                                   stencil_box.lower(d),
-                                   stencil_box.upper(d),
-                                   phi[d],
-                                   dphi[d]);
-                        }
-                        for (Box<NDIM>::Iterator b(stencil_box * side_boxes[component]); b; b++)
-                        {
-                            const Index<NDIM>& i = b();
-                            const Index<NDIM> i_shift = i - stencil_box.lower();
-                            const SideIndex<NDIM> i_s(i, component, SideIndex<NDIM>::Lower);
-                            double f = 0.0;
-                            for (unsigned int k = 0; k < NDIM; ++k)
-                            {
-                                double dw_dx_k = 1.0;
-                                for (unsigned int d = 0; d < NDIM; ++d)
-                                {
-                                    if (d == k)
-                                    {
-                                        dw_dx_k *= dphi[d][i_shift(d)] / dx[d];
-                                    }
-                                    else
-                                    {
-                                        dw_dx_k *= phi[d][i_shift(d)];
-                                    }
-                                }
-                                f += tau(component, k) * dw_dx_k;
-                            }
-                            (*f_data)(i_s) += f * wgt / dV_c;
+                            phi[d] = &weights.phi[(offset + d) * kernel_stencil_size];
+                            dphi_dx[d] = &weights.dphi_dx[(offset + d) * kernel_stencil_size];
+                            stencil_box.lower(d) = stencil_lower[d];
+                            stencil_box.upper(d) = stencil_lower[d] + kernel_stencil_size - 1;
                         }
+                        spread_component(f_data->getPointer(component),
+                                         f_ghost_boxes[component],
+                                         stencil_box * side_boxes[component],
+                                         stencil_lower,
+                                         phi,
+                                         dphi_dx,
+                                         &tau[NDIM * component],
+                                         wgt / dV_c);
                     }
                 }
             }
@@ -1010,6 +1084,34 @@ IMPMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
     return;
 } // updateWorkloadEstimates
 
+void
+IMPMethod::setWorkloadWeights(const double node_weight, double /*quad_point_weight*/)
+{
+    d_l_data_manager->setNodeWorkloadWeight(node_weight);
+    return;
+} // setWorkloadWeights
+
+void
+IMPMethod::getLocalWorkloadCounts(double& num_local_nodes, double& num_local_quad_points) const
+{
+    num_local_nodes = 0.0;
+    num_local_quad_points = 0.0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        num_local_nodes += static_cast<double>(d_l_data_manager->getNumberOfLocalNodes(ln));
+    }
+    return;
+} // getLocalWorkloadCounts
+
+void
+IMPMethod::registerWorkloadCostModel(Pointer<WorkloadCostModel> workload_cost_model)
+{
+    d_l_data_manager->registerWorkloadCostModel(workload_cost_model);
+    return;
+} // registerWorkloadCostModel
+
 void IMPMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                         Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -1021,6 +1123,7 @@ void IMPMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy
                                       Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
     d_l_data_manager->endDataRedistribution();
+    d_transfer_weights.clear();
     return;
 } // endDataRedistribution
 
@@ -1097,6 +1200,7 @@ IMPMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierar
     d_l_data_manager->setPatchHierarchy(hierarchy);
     d_l_data_manager->setPatchLevels(0, finest_hier_level);
     d_l_data_manager->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    d_transfer_weights.clear();
     return;
 } // resetHierarchyConfiguration
 
@@ -1295,6 +1399,71 @@ IMPMethod::getFromRestart()
     return;
 } // getFromRestart
 
+void
+IMPMethod::updateTransferWeights(TransferWeights& weights,
+                                 const unsigned int entry,
+                                 const int local_idx,
+                                 const double* const X,
+                                 const Box<NDIM>& patch_box,
+                                 const double* const x_lower,
+                                 const double* const x_upper,
+                                 const double* const dx)
+{
+    // Reuse the cached weights if they were computed for the same point at the
+    // same position.
+    if (entry < weights.local_idx.size() && weights.local_idx[entry] == local_idx)
+    {
+        bool same_position = true;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            same_position = same_position && weights.X[entry * NDIM + d] == X[d];
+        }
+        if (same_position) return;
+    }
+    if (entry >= weights.local_idx.size())
+    {
+        const unsigned int num_entries = entry + 1;
+        weights.local_idx.resize(num_entries, -1);
+        weights.X.resize(num_entries * NDIM);
+        weights.stencil_lower.resize(num_entries * NDIM * NDIM);
+        weights.phi.resize(num_entries * NDIM * NDIM * kernel_stencil_size);
+        weights.dphi_dx.resize(num_entries * NDIM * NDIM * kernel_stencil_size);
+    }
+
+    // Evaluate the 1D kernel weights and derivatives along each axis for each
+    // component of the side-centered data.
+    weights.local_idx[entry] = local_idx;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        weights.X[entry * NDIM + d] = X[d];
+    }
+    for (unsigned int component = 0; component < NDIM; ++component)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int offset = (entry * NDIM + component) * NDIM + d;
+            double* const phi = &weights.phi[offset * kernel_stencil_size];
+            double* const dphi_dx = &weights.dphi_dx[offset * kernel_stencil_size];
+            int stencil_upper;
+            kernel(X[d],
+                   x_lower[d] + (d == component ? -0.5 * dx[d] : 0.0),
+                   x_upper[d] + (d == component ? +0.5 * dx[d] : 0.0),
+                   dx[d],
+                   patch_box.lower(d),
+                   patch_box.upper(d) + (d == component ? 1 : 0),
+                   weights.stencil_lower[offset],
+                   stencil_upper,
+                   phi,
+                   dphi_dx);
+            for (int k = 0; k < kernel_stencil_size; ++k)
+            {
+                dphi_dx[k] /= dx[d];
+            }
+        }
+    }
+    return;
+} // updateTransferWeights
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
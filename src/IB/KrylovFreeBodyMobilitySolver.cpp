@@ -43,6 +43,7 @@
 #include "ibamr/StokesSpecifications.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h"
+#include "ibtk/PETScBlockKrylovSolver.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petsc/private/petscimpl.h"
 #include "tbox/TimerManager.h"
@@ -55,6 +56,7 @@ namespace
 {
 // Timers.
 static Timer* t_solve_system;
+static Timer* t_solve_systems;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
 }
@@ -115,6 +117,7 @@ KrylovFreeBodyMobilitySolver::KrylovFreeBodyMobilitySolver(const std::string& ob
 
     IBAMR_DO_ONCE(
         t_solve_system = TimerManager::getManager()->getTimer("IBAMR::KrylovFreeBodyMobilitySolver::solveSystem()");
+        t_solve_systems = TimerManager::getManager()->getTimer("IBAMR::KrylovFreeBodyMobilitySolver::solveSystems()");
         t_initialize_solver_state =
             TimerManager::getManager()->getTimer("IBAMR::KrylovFreeBodyMobilitySolver::initializeSolverState()");
         t_deallocate_solver_state =
@@ -225,6 +228,42 @@ KrylovFreeBodyMobilitySolver::solveSystem(Vec x, Vec b)
     return converged;
 } // solveSystem
 
+bool
+KrylovFreeBodyMobilitySolver::solveSystems(const std::vector<Vec>& x, const std::vector<Vec>& b)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x.size() == b.size());
+#endif
+    if (b.empty()) return true;
+
+    IBAMR_TIMER_START(t_solve_systems);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x[0], b[0]);
+
+    // Solve the systems simultaneously using the operator, preconditioner, and
+    // convergence criteria of the PETSc KSP object.
+    IBTK::PETScBlockKrylovSolver block_solver(d_object_name + "::block_solver");
+    block_solver.setFromKSP(d_petsc_ksp);
+    block_solver.setLoggingEnabled(d_enable_logging);
+    const bool converged = block_solver.solveSystems(x, b);
+    d_current_iterations = block_solver.getNumIterations();
+    d_current_residual_norm = block_solver.getResidualNorm();
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystems(): " << (converged ? "converged" : "diverged") << " for "
+             << b.size() << " right-hand sides in " << d_current_iterations << " block iterations ("
+             << block_solver.getNumOperatorApplications() << " operator applications)\n";
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBAMR_TIMER_STOP(t_solve_systems);
+    return converged;
+} // solveSystems
+
 void
 KrylovFreeBodyMobilitySolver::initializeSolverState(Vec /*x*/, Vec b)
 {
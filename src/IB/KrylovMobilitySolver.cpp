@@ -45,6 +45,7 @@
 #include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
+#include "ibtk/PETScBlockKrylovSolver.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCPoissonSolverManager.h"
@@ -71,6 +72,7 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 
 // Timers.
 static Timer* t_solve_system;
+static Timer* t_solve_systems;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
 }
@@ -293,6 +295,7 @@ KrylovMobilitySolver::KrylovMobilitySolver(const std::string& object_name,
     }
 
     IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::KrylovMobilitySolver::solveSystem()");
+                 t_solve_systems = TimerManager::getManager()->getTimer("IBTK::KrylovMobilitySolver::solveSystems()");
                  t_initialize_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::KrylovMobilitySolver::initializeSolverState()");
                  t_deallocate_solver_state =
@@ -399,6 +402,13 @@ KrylovMobilitySolver::setPhysicalBcCoefs(const std::vector<RobinBcCoefStrategy<N
     d_LInv->setPhysicalBcCoefs(d_u_bc_coefs, p_bc_coef);
     d_velocity_solver->setPhysicalBcCoefs(d_ins_integrator->getIntermediateVelocityBoundaryConditions());
     d_pressure_solver->setPhysicalBcCoef(d_ins_integrator->getProjectionBoundaryConditions());
+
+    // Update the cached ghost cell filling transactions.
+    if (d_is_initialized)
+    {
+        d_transaction_comps[0].d_robin_bc_coefs = d_u_bc_coefs;
+        d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+    }
 } // setPhysicalBcCoefs
 
 void
@@ -442,6 +452,46 @@ KrylovMobilitySolver::solveSystem(Vec x, Vec b)
     return converged;
 } // solveSystem
 
+bool
+KrylovMobilitySolver::solveSystems(const std::vector<Vec>& x, const std::vector<Vec>& b)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x.size() == b.size());
+#endif
+    if (b.empty()) return true;
+
+    IBTK_TIMER_START(t_solve_systems);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x[0], b[0]);
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_petsc_ksp);
+#endif
+
+    // Solve the systems simultaneously using the operator, preconditioner, and
+    // convergence criteria of the PETSc KSP object.
+    IBTK::PETScBlockKrylovSolver block_solver(d_object_name + "::block_solver");
+    block_solver.setFromKSP(d_petsc_ksp);
+    block_solver.setLoggingEnabled(d_enable_logging);
+    const bool converged = block_solver.solveSystems(x, b);
+    d_current_iterations = block_solver.getNumIterations();
+    d_current_residual_norm = block_solver.getResidualNorm();
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystems(): " << (converged ? "converged" : "diverged") << " for "
+             << b.size() << " right-hand sides in " << d_current_iterations << " block iterations ("
+             << block_solver.getNumOperatorApplications() << " operator applications)\n";
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_systems);
+    return converged;
+} // solveSystems
+
 void
 KrylovMobilitySolver::initializeSolverState(Vec x, Vec b)
 {
@@ -482,16 +532,17 @@ KrylovMobilitySolver::initializeSolverState(Vec x, Vec b)
 
     // Get hierarchy information.
     d_hierarchy = vx0->getPatchHierarchy();
-    const int u_data_idx = vx0->getComponentDescriptorIndex(0);
     const int coarsest_ln = vx0->getCoarsestLevelNumber();
     const int finest_ln = vx0->getFinestLevelNumber();
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vx[0], &vx0);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vb[0], &vb0);
 
-    // Setup the interpolation transaction information.
+    // Setup the interpolation transaction information.  Ghost cells are only
+    // filled for the velocity computed by the Stokes solver in the operator
+    // application, so the transactions are set up once for that data.
     d_fill_pattern = NULL;
     typedef IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
-    InterpolationTransactionComponent component(u_data_idx,
+    InterpolationTransactionComponent component(d_samrai_temp[1]->getComponentDescriptorIndex(0),
                                                 DATA_REFINE_TYPE,
                                                 USE_CF_INTERPOLATION,
                                                 DATA_COARSEN_TYPE,
@@ -949,23 +1000,10 @@ KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
     solver->d_LInv->solveSystem(*solver->d_samrai_temp[1], *solver->d_samrai_temp[0]);
 
     // 3a) Fill velocity ghost cells.
-    int u_data_idx = solver->d_samrai_temp[1]->getComponentDescriptorIndex(0);
-    typedef IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
-    std::vector<InterpolationTransactionComponent> transaction_comps;
-    InterpolationTransactionComponent u_component(u_data_idx,
-                                                  DATA_REFINE_TYPE,
-                                                  USE_CF_INTERPOLATION,
-                                                  DATA_COARSEN_TYPE,
-                                                  BDRY_EXTRAP_TYPE,
-                                                  CONSISTENT_TYPE_2_BDRY,
-                                                  solver->d_u_bc_coefs,
-                                                  solver->d_fill_pattern);
-    transaction_comps.push_back(u_component);
-    solver->d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
+    const int u_data_idx = solver->d_samrai_temp[1]->getComponentDescriptorIndex(0);
     static const bool homogeneous_bc = true;
     solver->d_hier_bdry_fill->setHomogeneousBc(homogeneous_bc);
     solver->d_hier_bdry_fill->fillData(half_time);
-    solver->d_hier_bdry_fill->resetTransactionComponents(solver->d_transaction_comps);
 
     // 3b) Interpolate velocity
     solver->d_cib_strategy->setInterpolatedVelocityVector(y, half_time);
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -50,6 +51,7 @@ namespace
 #define KRON(i, j) ((i == j) ? 1 : 0) // Kronecker symbol
 #endif
 
+const int RPY_TILE_SIZE = 64;          // number of markers per tile for blocked assembly
 const double MOB_FIT_FG_TOL = 1.0e-5; // min distance between blobs to apply empirical fitting
 const double ZERO_TOL = 1.0e-10;      // tolerance for zero value
 double MOB_FIT_FACTOR;                // constant for normalization
@@ -570,10 +572,100 @@ getEmpiricalMobilityComponents(const char* IBKernelName,
     }
     return;
 } // getEmpiricalMobilityComponents
+
+// Fills the entries of the RPY mobility matrix that couple the markers
+// [row_begin,row_end) with the markers [col_begin,col_end), along with the
+// transposed entries.  Only pairs with col <= row are processed.
+void
+fillRPYTile(const int row_begin,
+            const int row_end,
+            const int col_begin,
+            const int col_end,
+            const double hrad,
+            const double mu_tt,
+            const double PERIODIC_CORRECTION,
+            const double* X,
+            const int size,
+            double* MM)
+{
+    double r_vec[NDIM][RPY_TILE_SIZE], rsq[RPY_TILE_SIZE], r[RPY_TILE_SIZE], cube[RPY_TILE_SIZE];
+    double m_ij[RPY_TILE_SIZE];
+    bool is_self[RPY_TILE_SIZE];
+    for (int row = row_begin; row < row_end; ++row)
+    {
+        const int col_stop = std::min(col_end, row + 1);
+        const int n_cols = col_stop - col_begin;
+        if (n_cols <= 0) continue;
+
+        // Compute the pair separations for the current row.
+        for (int cdir = 0; cdir < NDIM; ++cdir)
+        {
+            const double X_row = X[row * NDIM + cdir];
+            for (int k = 0; k < n_cols; ++k)
+            {
+                r_vec[cdir][k] = X_row - X[(col_begin + k) * NDIM + cdir]; // r(i) - r(j)
+            }
+        }
+        for (int k = 0; k < n_cols; ++k)
+        {
+#if (NDIM == 3)
+            rsq[k] = r_vec[0][k] * r_vec[0][k] + r_vec[1][k] * r_vec[1][k] + r_vec[2][k] * r_vec[2][k];
+#elif(NDIM == 2)
+            rsq[k] = r_vec[0][k] * r_vec[0][k] + r_vec[1][k] * r_vec[1][k];
+#endif
+            // The separation vanishes on the diagonal (col == row).  Use a unit
+            // separation there to avoid dividing by zero; the self term is
+            // selected below.
+            is_self[k] = col_begin + k == row;
+            rsq[k] = is_self[k] ? 1.0 : rsq[k];
+            r[k] = sqrt(rsq[k]);
+            cube[k] = hrad * hrad * hrad / r[k] / r[k] / r[k];
+        }
+
+        // Evaluate the tensor components.  The expressions are the same as in
+        // MobilityFunctions::constructRPYMobilityMatrix().
+        for (int idir = 0; idir < NDIM; ++idir)
+        {
+            for (int jdir = 0; jdir <= idir; ++jdir)
+            {
+                const int kron = KRON(idir, jdir);
+                const double self_val = (mu_tt - PERIODIC_CORRECTION) * kron;
+                for (int k = 0; k < n_cols; ++k)
+                {
+                    const double rr = r[k];
+                    const double near_val = (mu_tt * (1 - 9.0 / 32.0 * rr / hrad) - PERIODIC_CORRECTION) * kron +
+                                            mu_tt * r_vec[idir][k] * r_vec[jdir][k] / rsq[k] * 3.0 * rr / 32. / hrad;
+                    const double far_val =
+                        (mu_tt * (3.0 / 4.0 * hrad / rr + 1.0 / 2.0 * cube[k]) - PERIODIC_CORRECTION) * kron +
+                        mu_tt * r_vec[idir][k] * r_vec[jdir][k] / rsq[k] * (3.0 / 4.0 * hrad / rr - 3.0 / 2.0 * cube[k]);
+                    m_ij[k] = is_self[k] ? self_val : (rr <= 2.0 * hrad ? near_val : far_val);
+                }
+                for (int k = 0; k < n_cols; ++k)
+                {
+                    const int col = col_begin + k;
+                    MM[(col * NDIM + jdir) * size + row * NDIM + idir] = m_ij[k]; // column-major for LAPACK
+                    MM[(row * NDIM + idir) * size + col * NDIM + jdir] = m_ij[k];
+                    if (idir != jdir)
+                    {
+                        MM[(col * NDIM + idir) * size + row * NDIM + jdir] = m_ij[k];
+                        MM[(row * NDIM + jdir) * size + col * NDIM + idir] = m_ij[k];
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fillRPYTile
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+MobilityFunctions::KernelType
+MobilityFunctions::getKernelType(const char* IBKernelName)
+{
+    return static_cast<KernelType>(GetKernelType(IBKernelName));
+} // getKernelType
+
 void
 MobilityFunctions::constructEmpiricalMobilityMatrix(const char* IBKernelName,
                                                     const double MU,
@@ -697,6 +789,92 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+template <MobilityFunctions::KernelType KERNEL>
+void
+MobilityFunctions::constructRPYMobilityMatrixBlocked(const double MU,
+                                                     const double DX,
+                                                     const double* X,
+                                                     const int N,
+                                                     const double PERIODIC_CORRECTION,
+                                                     double* MM)
+{
+    const double hrad = MOB_FIT_HydroRadius[KERNEL] * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * hrad);
+    const int size = N * NDIM;
+
+    // Loop over the tiles in the lower block triangle of the matrix.  Each
+    // tile also sets the transposed entries, so that distinct tiles write to
+    // disjoint parts of the matrix.
+    const int num_tiles = (N + RPY_TILE_SIZE - 1) / RPY_TILE_SIZE;
+    const int num_tile_pairs = num_tiles * (num_tiles + 1) / 2;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int tile_pair = 0; tile_pair < num_tile_pairs; ++tile_pair)
+    {
+        // Recover the tile indices (row_tile, col_tile) with col_tile <=
+        // row_tile from the linear index of the tile pair.
+        int row_tile = static_cast<int>((sqrt(8.0 * tile_pair + 1.0) - 1.0) / 2.0);
+        while (row_tile * (row_tile + 1) / 2 > tile_pair) --row_tile;
+        while ((row_tile + 1) * (row_tile + 2) / 2 <= tile_pair) ++row_tile;
+        const int col_tile = tile_pair - row_tile * (row_tile + 1) / 2;
+        fillRPYTile(row_tile * RPY_TILE_SIZE,
+                    std::min(N, (row_tile + 1) * RPY_TILE_SIZE),
+                    col_tile * RPY_TILE_SIZE,
+                    std::min(N, (col_tile + 1) * RPY_TILE_SIZE),
+                    hrad,
+                    mu_tt,
+                    PERIODIC_CORRECTION,
+                    X,
+                    size,
+                    MM);
+    }
+    return;
+} // constructRPYMobilityMatrixBlocked
+
+void
+MobilityFunctions::constructRPYMobilityMatrixBlocked(const char* IBKernelName,
+                                                     const double MU,
+                                                     const double DX,
+                                                     const double* X,
+                                                     const int N,
+                                                     const double PERIODIC_CORRECTION,
+                                                     double* MM)
+{
+    switch (getKernelType(IBKernelName))
+    {
+    case IB_3_KERNEL:
+        constructRPYMobilityMatrixBlocked<IB_3_KERNEL>(MU, DX, X, N, PERIODIC_CORRECTION, MM);
+        break;
+    case IB_4_KERNEL:
+        constructRPYMobilityMatrixBlocked<IB_4_KERNEL>(MU, DX, X, N, PERIODIC_CORRECTION, MM);
+        break;
+    case IB_6_KERNEL:
+        constructRPYMobilityMatrixBlocked<IB_6_KERNEL>(MU, DX, X, N, PERIODIC_CORRECTION, MM);
+        break;
+    }
+    return;
+} // constructRPYMobilityMatrixBlocked
+
+template void MobilityFunctions::constructRPYMobilityMatrixBlocked<MobilityFunctions::IB_3_KERNEL>(const double,
+                                                                                                   const double,
+                                                                                                   const double*,
+                                                                                                   const int,
+                                                                                                   const double,
+                                                                                                   double*);
+template void MobilityFunctions::constructRPYMobilityMatrixBlocked<MobilityFunctions::IB_4_KERNEL>(const double,
+                                                                                                   const double,
+                                                                                                   const double*,
+                                                                                                   const int,
+                                                                                                   const double,
+                                                                                                   double*);
+template void MobilityFunctions::constructRPYMobilityMatrixBlocked<MobilityFunctions::IB_6_KERNEL>(const double,
+                                                                                                   const double,
+                                                                                                   const double*,
+                                                                                                   const int,
+                                                                                                   const double,
+                                                                                                   double*);
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // IBAMR
@@ -33,14 +33,24 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibamr/RelaxationLSMethod.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Box.h"
+#include "CellData.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IBAMR_config.h"
+#include "Patch.h"
+#include "PatchLevel.h"
 #include "VariableDatabase.h"
 #include "ibamr/namespaces.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
@@ -91,6 +101,53 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Compute the maximum change between the current and previous iterates over
+// the cells of the patch interior that are not covered by finer levels, and
+// accumulate the weighted sum of the squared changes.
+void
+compute_interior_change(double& max_change,
+                        double& diff_sq_sum,
+                        const CellData<NDIM, double>& D_data,
+                        const CellData<NDIM, double>& D_iter_data,
+                        const CellData<NDIM, double>& wgt_data,
+                        const Box<NDIM>& patch_box)
+{
+    max_change = 0.0;
+    for (Box<NDIM>::Iterator b(patch_box); b; b++)
+    {
+        const CellIndex<NDIM> i(b());
+        const double wgt = wgt_data(i);
+        if (wgt <= 0.0) continue;
+        const double diff = D_data(i) - D_iter_data(i);
+        max_change = std::max(max_change, std::abs(diff));
+        diff_sq_sum += wgt * diff * diff;
+    }
+    return;
+} // compute_interior_change
+
+// Compute the maximum change between the current and previous values in the
+// cells of a patch that are filled by its neighbors, i.e., the ghost cells and
+// the interior cells that are covered by finer levels (which have zero weight
+// and which are filled by coarsening the fine data).
+double
+compute_ghost_change(const CellData<NDIM, double>& D_data,
+                     const CellData<NDIM, double>& D_iter_data,
+                     const CellData<NDIM, double>& wgt_data,
+                     const Box<NDIM>& patch_box)
+{
+    double max_change = 0.0;
+    for (Box<NDIM>::Iterator b(D_data.getGhostBox()); b; b++)
+    {
+        const CellIndex<NDIM> i(b());
+        if (patch_box.contains(i) && wgt_data(i) > 0.0) continue;
+        max_change = std::max(max_change, std::abs(D_data(i) - D_iter_data(i)));
+    }
+    return max_change;
+} // compute_ghost_change
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 RelaxationLSMethod::RelaxationLSMethod(const std::string& object_name, Pointer<Database> db, bool register_for_restart)
@@ -101,6 +158,8 @@ RelaxationLSMethod::RelaxationLSMethod(const std::string& object_name, Pointer<D
     d_max_its = 100;
     d_abs_tol = 1e-5;
     d_enable_logging = false;
+    d_enable_active_set = false;
+    d_convergence_check_interval = 1;
 
     // Get any additional or overwrite base class options.
     if (d_registered_for_restart) getFromRestart();
@@ -155,10 +214,16 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
     Pointer<HierarchyGhostCellInterpolation> fill_op = new HierarchyGhostCellInterpolation();
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
 
-    // Carry out relaxation
+    // Carry out relaxation.  When the active set is enabled, patches that have
+    // converged are skipped until their ghost cell values change.
     double diff_L2_norm = 1.0e12;
     int outer_iter = 0;
     const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
+    std::vector<std::vector<bool> > patch_is_active(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        patch_is_active[ln].resize(hierarchy->getPatchLevel(ln)->getNumberOfPatches(), true);
+    }
 
     // Copy initial condition
     hier_cc_data_ops.copyData(D_init_idx, D_idx);
@@ -168,21 +233,38 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
     fill_op->resetTransactionComponent(D_transaction);
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_idx);
+        // Keep the previous ghost cell values so that changes in the ghost
+        // cells of inactive patches can be detected.
+        hier_cc_data_ops.copyData(D_iter_idx, D_idx, /*interior_only*/ false);
         fill_op->fillData(time);
-        relax(hier_math_ops, D_idx, D_init_idx, outer_iter);
-
-        // Compute error
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        int num_active_patches = 0;
+        const double diff_sq_sum = relax(hier_math_ops,
+                                         D_idx,
+                                         D_iter_idx,
+                                         D_init_idx,
+                                         cc_wgt_idx,
+                                         outer_iter,
+                                         patch_is_active,
+                                         num_active_patches);
 
         outer_iter += 1;
 
+        // Check for convergence.  The global reduction is only carried out
+        // every d_convergence_check_interval iterations.
+        if (outer_iter % d_convergence_check_interval != 0 && outer_iter < d_max_its) continue;
+        double sums[2] = { diff_sq_sum, static_cast<double>(num_active_patches) };
+        SAMRAI_MPI::sumReduction(sums, 2);
+        diff_L2_norm = std::sqrt(sums[0]);
+
         if (d_enable_logging)
         {
             plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
             plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm
                  << std::endl;
+            if (d_enable_active_set)
+            {
+                plog << d_object_name << "::initializeLSData(): Number of patches relaxed = " << sums[1] << std::endl;
+            }
         }
 
         if (diff_L2_norm <= d_abs_tol && d_enable_logging)
@@ -215,29 +297,54 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
-void
+double
 RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
                           int dist_idx,
+                          int dist_iter_idx,
                           int dist_init_idx,
-                          const int iter) const
+                          int wgt_idx,
+                          const int iter,
+                          std::vector<std::vector<bool> >& patch_is_active,
+                          int& num_active_patches) const
 {
     Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
     const int coarsest_ln = 0;
     const int finest_ln = hierarchy->getFinestLevelNumber();
 
+    double diff_sq_sum = 0.0;
+    num_active_patches = 0;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const int patch_num = p();
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
+            const Box<NDIM>& patch_box = patch->getBox();
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            const Pointer<CellData<NDIM, double> > dist_iter_data = patch->getPatchData(dist_iter_idx);
             const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
+            const Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+
+            // Reactivate inactive patches whose ghost cell values or covered
+            // cell values have been changed by their neighbors or by finer
+            // levels.
+            if (!patch_is_active[ln][patch_num])
+            {
+                if (compute_ghost_change(*dist_data, *dist_iter_data, *wgt_data, patch_box) <= d_abs_tol) continue;
+                patch_is_active[ln][patch_num] = true;
+            }
+
             relax(dist_data, dist_init_data, patch, iter);
+            ++num_active_patches;
+
+            // Deactivate patches that are locally converged.
+            double max_change;
+            compute_interior_change(max_change, diff_sq_sum, *dist_data, *dist_iter_data, *wgt_data, patch_box);
+            if (d_enable_active_set && max_change <= d_abs_tol) patch_is_active[ln][patch_num] = false;
         }
     }
-    return;
-
+    return diff_sq_sum;
 } // relax
 
 void
@@ -330,6 +437,16 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
 
+    d_enable_active_set = input_db->getBoolWithDefault("enable_active_set", d_enable_active_set);
+    d_convergence_check_interval =
+        input_db->getIntegerWithDefault("convergence_check_interval", d_convergence_check_interval);
+    if (d_convergence_check_interval < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  convergence_check_interval must be positive"
+                                 << std::endl);
+    }
+
     return;
 } // getFromInput
 
@@ -111,6 +111,7 @@ StaggeredStokesOperator::StaggeredStokesOperator(const std::string& object_name,
       d_transaction_comps(),
       d_hier_bdry_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)),
       d_no_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)),
+      d_use_fused_apply(true),
       d_x(NULL),
       d_b(NULL)
 {
@@ -191,6 +192,14 @@ StaggeredStokesOperator::setPhysicalBcCoefs(const std::vector<RobinBcCoefStrateg
     {
         d_P_bc_coef = d_default_P_bc_coef;
     }
+
+    // Update the cached ghost cell filling operator.
+    if (d_is_initialized)
+    {
+        d_transaction_comps[0].d_robin_bc_coefs = d_U_bc_coefs;
+        d_transaction_comps[1].d_robin_bc_coefs = std::vector<RobinBcCoefStrategy<NDIM>*>(1, d_P_bc_coef);
+        d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+    }
     return;
 } // setPhysicalBcCoefs
 
@@ -204,14 +213,18 @@ StaggeredStokesOperator::setPhysicalBoundaryHelper(Pointer<StaggeredStokesPhysic
     return;
 } // setPhysicalBoundaryHelper
 
+void
+StaggeredStokesOperator::setUseFusedApply(const bool use_fused_apply)
+{
+    d_use_fused_apply = use_fused_apply;
+    return;
+} // setUseFusedApply
+
 void
 StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& y)
 {
     IBAMR_TIMER_START(t_apply);
 
-    // Allocate scratch data.
-    d_x->allocateVectorData();
-
     // Get the vector components.
     const int U_idx = x.getComponentDescriptorIndex(0);
     const int P_idx = x.getComponentDescriptorIndex(1);
@@ -225,67 +238,58 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
     Pointer<CellVariable<NDIM, double> > A_P_cc_var = y.getComponentVariable(1);
 
     // Simultaneously fill ghost cell values for all components.
-    typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
-    std::vector<InterpolationTransactionComponent> transaction_comps(2);
-    transaction_comps[0] = InterpolationTransactionComponent(U_scratch_idx,
-                                                             U_idx,
-                                                             DATA_REFINE_TYPE,
-                                                             USE_CF_INTERPOLATION,
-                                                             DATA_COARSEN_TYPE,
-                                                             BDRY_EXTRAP_TYPE,
-                                                             CONSISTENT_TYPE_2_BDRY,
-                                                             d_U_bc_coefs,
-                                                             d_U_fill_pattern);
-    transaction_comps[1] = InterpolationTransactionComponent(P_idx,
-                                                             DATA_REFINE_TYPE,
-                                                             USE_CF_INTERPOLATION,
-                                                             DATA_COARSEN_TYPE,
-                                                             BDRY_EXTRAP_TYPE,
-                                                             CONSISTENT_TYPE_2_BDRY,
-                                                             d_P_bc_coef,
-                                                             d_P_fill_pattern);
-    d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
-    d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
-    StaggeredStokesPhysicalBoundaryHelper::setupBcCoefObjects(
-        d_U_bc_coefs, d_P_bc_coef, U_scratch_idx, P_idx, d_homogeneous_bc);
-    d_hier_bdry_fill->fillData(d_solution_time);
-    StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_U_bc_coefs, d_P_bc_coef);
-    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+    fillGhostCellValues(U_idx, P_idx);
 
     // Compute the action of the operator:
     //
     // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
-    d_hier_math_ops->laplace(A_U_idx,
-                             A_U_sc_var,
-                             d_U_problem_coefs,
+    if (d_use_fused_apply)
+    {
+        d_hier_math_ops->stokes(A_U_idx,
+                                A_U_sc_var,
+                                A_P_idx,
+                                A_P_cc_var,
+                                d_U_problem_coefs,
+                                U_scratch_idx,
+                                U_sc_var,
+                                P_idx,
+                                P_cc_var,
+                                d_no_fill,
+                                d_new_time,
+                                1.0,
+                                -1.0);
+    }
+    else
+    {
+        d_hier_math_ops->grad(A_U_idx,
+                              A_U_sc_var,
+                              /*cf_bdry_synch*/ false,
+                              1.0,
+                              P_idx,
+                              P_cc_var,
+                              d_no_fill,
+                              d_new_time);
+        d_hier_math_ops->laplace(A_U_idx,
+                                 A_U_sc_var,
+                                 d_U_problem_coefs,
+                                 U_scratch_idx,
+                                 U_sc_var,
+                                 d_no_fill,
+                                 d_new_time,
+                                 1.0,
+                                 A_U_idx,
+                                 A_U_sc_var);
+        d_hier_math_ops->div(A_P_idx,
+                             A_P_cc_var,
+                             -1.0,
                              U_scratch_idx,
                              U_sc_var,
                              d_no_fill,
                              d_new_time,
-                             1.0,
-                             A_U_idx,
-                             A_U_sc_var);
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         d_new_time,
-                         /*cf_bdry_synch*/ true);
+                             /*cf_bdry_synch*/ true);
+    }
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
-    // Deallocate scratch data.
-    d_x->deallocateVectorData();
-
     IBAMR_TIMER_STOP(t_apply);
     return;
 } // apply
@@ -299,9 +303,11 @@ StaggeredStokesOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, do
     // Deallocate the operator state if the operator is already initialized.
     if (d_is_initialized) deallocateOperatorState();
 
-    // Setup solution and rhs vectors.
+    // Setup solution and rhs vectors.  The scratch data remain allocated until
+    // the operator state is deallocated.
     d_x = in.cloneVector(in.getName());
     d_b = out.cloneVector(out.getName());
+    d_x->allocateVectorData();
 
     // Setup the interpolation transaction information.
     d_U_fill_pattern = new SideNoCornersFillPattern(SIDEG, false, false, true);
@@ -434,6 +440,41 @@ StaggeredStokesOperator::imposeSolBcs(SAMRAIVectorReal<NDIM, double>& u)
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+StaggeredStokesOperator::fillGhostCellValues(const int U_idx, const int P_idx)
+{
+    const int U_scratch_idx = d_x->getComponentDescriptorIndex(0);
+    if (d_transaction_comps[0].d_dst_data_idx != U_scratch_idx || d_transaction_comps[0].d_src_data_idx != U_idx ||
+        d_transaction_comps[1].d_dst_data_idx != P_idx)
+    {
+        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+        d_transaction_comps[0] = InterpolationTransactionComponent(U_scratch_idx,
+                                                                   U_idx,
+                                                                   DATA_REFINE_TYPE,
+                                                                   USE_CF_INTERPOLATION,
+                                                                   DATA_COARSEN_TYPE,
+                                                                   BDRY_EXTRAP_TYPE,
+                                                                   CONSISTENT_TYPE_2_BDRY,
+                                                                   d_U_bc_coefs,
+                                                                   d_U_fill_pattern);
+        d_transaction_comps[1] = InterpolationTransactionComponent(P_idx,
+                                                                   DATA_REFINE_TYPE,
+                                                                   USE_CF_INTERPOLATION,
+                                                                   DATA_COARSEN_TYPE,
+                                                                   BDRY_EXTRAP_TYPE,
+                                                                   CONSISTENT_TYPE_2_BDRY,
+                                                                   d_P_bc_coef,
+                                                                   d_P_fill_pattern);
+        d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+    }
+    d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
+    StaggeredStokesPhysicalBoundaryHelper::setupBcCoefObjects(
+        d_U_bc_coefs, d_P_bc_coef, U_scratch_idx, P_idx, d_homogeneous_bc);
+    d_hier_bdry_fill->fillData(d_solution_time);
+    StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_U_bc_coefs, d_P_bc_coef);
+    return;
+} // fillGhostCellValues
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,126 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/MobilityFunctions.h>
+
+// The cache-blocked assembly evaluates the same closed-form RPY expressions as
+// the reference assembly, but in vectorized loops over tiles of columns.  The
+// compiler may contract the products and sums in those loops into fused
+// multiply-adds differently than in the scalar loop (e.g., with -O3
+// -march=native), so that the two matrices may differ in the last bit of the
+// individual terms.  The entries of the matrix are sums of a few terms of
+// magnitude at most max |M_ij|, so the differences are bounded by a small
+// multiple of the unit roundoff relative to max |M_ij|.  Without contraction
+// the two assemblies agree exactly.
+static const double REL_TOL = 1.0e-14;
+
+namespace
+{
+// Generate num_nodes marker positions in a cube of side length width.
+void
+generate_markers(std::vector<double>& X, const int num_nodes, const double width)
+{
+    X.resize(num_nodes * NDIM);
+    for (int k = 0; k < num_nodes * NDIM; ++k)
+    {
+        X[k] = width * static_cast<double>(std::rand()) / static_cast<double>(RAND_MAX);
+    }
+    return;
+} // generate_markers
+}
+
+/*******************************************************************************
+ * Compare the cache-blocked RPY mobility matrix assembly with the reference   *
+ * assembly for the supported IB kernels.  The command line is:                *
+ *                                                                             *
+ *    executable                                                               *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int /*argc*/, char* /*argv*/ [])
+{
+    static const int NUM_KERNELS = 3;
+    static const char* const KERNEL_NAMES[NUM_KERNELS] = { "IB_3", "IB_4", "IB_6" };
+    static const int NUM_SIZES = 5;
+    static const int NUM_NODES[NUM_SIZES] = { 1, 7, 64, 65, 150 };
+    const double mu = 1.3, dx = 0.01, periodic_correction = 0.02;
+
+    bool passed = true;
+    std::srand(1);
+    for (int k = 0; k < NUM_KERNELS; ++k)
+    {
+        for (int s = 0; s < NUM_SIZES; ++s)
+        {
+            // Use both tightly clustered markers, which are separated by less
+            // than the support of the kernel, and markers that are spread
+            // over many grid cells.
+            for (int spread = 0; spread < 2; ++spread)
+            {
+                const int num_nodes = NUM_NODES[s];
+                const int size = num_nodes * NDIM;
+                std::vector<double> X;
+                generate_markers(X, num_nodes, (spread == 0 ? 2.0 : 40.0) * dx);
+                std::vector<double> mm_ref(size * size, 0.0), mm_blocked(size * size, 0.0);
+                IBAMR::MobilityFunctions::constructRPYMobilityMatrix(
+                    KERNEL_NAMES[k], mu, dx, &X[0], num_nodes, periodic_correction, &mm_ref[0]);
+                IBAMR::MobilityFunctions::constructRPYMobilityMatrixBlocked(
+                    KERNEL_NAMES[k], mu, dx, &X[0], num_nodes, periodic_correction, &mm_blocked[0]);
+                double max_entry = 0.0, max_diff = 0.0;
+                for (int i = 0; i < size * size; ++i)
+                {
+                    max_entry = std::max(max_entry, std::abs(mm_ref[i]));
+                    max_diff = std::max(max_diff, std::abs(mm_ref[i] - mm_blocked[i]));
+                }
+                const bool ok = max_diff <= REL_TOL * max_entry;
+                std::cout << KERNEL_NAMES[k] << ", " << num_nodes << " markers, "
+                          << (spread == 0 ? "clustered" : "spread")
+                          << ": max |M_ref - M_blocked| / max |M_ref| = " << max_diff / max_entry
+                          << (ok ? "" : " (FAILED)") << "\n";
+                passed = passed && ok;
+            }
+        }
+    }
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+} // main
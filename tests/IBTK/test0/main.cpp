@@ -0,0 +1,231 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <RefineAlgorithm.h>
+#include <RefineSchedule.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideIndex.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CartSideDoubleQuadraticCFInterpolation.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+namespace
+{
+// Fill the coarse-fine interface ghost cells of the specified side-centered
+// data on the finer levels of the hierarchy in the same way as
+// HierarchyGhostCellInterpolation.
+void
+fill_cf_ghost_cells(const int U_idx,
+                    Pointer<SideVariable<NDIM, double> > U_var,
+                    Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                    Pointer<CartesianGridGeometry<NDIM> > grid_geometry,
+                    const bool use_precompiled_stencils)
+{
+    CartSideDoubleQuadraticCFInterpolation cf_bdry_op;
+    cf_bdry_op.setUsePrecompiledStencils(use_precompiled_stencils);
+    cf_bdry_op.setConsistentInterpolationScheme(false);
+    cf_bdry_op.setPatchDataIndex(U_idx);
+    cf_bdry_op.setPatchHierarchy(patch_hierarchy);
+    Pointer<RefineAlgorithm<NDIM> > refine_alg = new RefineAlgorithm<NDIM>();
+    refine_alg->registerRefine(
+        U_idx, U_idx, U_idx, grid_geometry->lookupRefineOperator(U_var, "CONSERVATIVE_LINEAR_REFINE"));
+    for (int ln = 1; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        refine_alg->createSchedule(level, ln - 1, patch_hierarchy, &cf_bdry_op)->fillData(0.0);
+        const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            cf_bdry_op.computeNormalExtension(*patch, ratio, patch->getPatchData(U_idx)->getGhostCellWidth());
+        }
+    }
+    cf_bdry_op.clearPatchHierarchy();
+    return;
+} // fill_cf_ghost_cells
+}
+
+/*******************************************************************************
+ * Compare the coarse-fine interface ghost cell values computed by             *
+ * CartSideDoubleQuadraticCFInterpolation using its precompiled interpolation  *
+ * stencils with those computed by the Fortran interpolation kernels.  The     *
+ * command line is:                                                            *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+    bool passed = false;
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "cf_interpolation.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create the objects that are used to generate the patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create the variables.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("cf_interpolation");
+        Pointer<SideVariable<NDIM, double> > U_var = new SideVariable<NDIM, double>("U");
+        const int U_stencil_idx = var_db->registerVariableAndContext(U_var, ctx, IntVector<NDIM>(1));
+        const int U_kernel_idx = var_db->registerClonedPatchDataIndex(U_var, U_stencil_idx);
+
+        // Initialize the patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        if (finest_ln == 0)
+        {
+            TBOX_ERROR("the patch hierarchy must have at least two levels" << std::endl);
+        }
+
+        // Set the interior values to a smooth function and the ghost cell
+        // values to zero.
+        muParserCartGridFunction U_fcn("U_fcn", app_initializer->getComponentDatabase("U"), grid_geometry);
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(U_stencil_idx, 0.0);
+            level->allocatePatchData(U_kernel_idx, 0.0);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > U_stencil_data = patch->getPatchData(U_stencil_idx);
+                Pointer<SideData<NDIM, double> > U_kernel_data = patch->getPatchData(U_kernel_idx);
+                U_stencil_data->fillAll(0.0);
+                U_kernel_data->fillAll(0.0);
+            }
+        }
+        U_fcn.setDataOnPatchHierarchy(U_stencil_idx, U_var, patch_hierarchy, 0.0);
+        U_fcn.setDataOnPatchHierarchy(U_kernel_idx, U_var, patch_hierarchy, 0.0);
+
+        // Fill the coarse-fine interface ghost cells using the precompiled
+        // stencils and using the Fortran kernels.
+        fill_cf_ghost_cells(U_stencil_idx, U_var, patch_hierarchy, grid_geometry, true);
+        fill_cf_ghost_cells(U_kernel_idx, U_var, patch_hierarchy, grid_geometry, false);
+
+        // Compare the two results, including the ghost cell values.  In 3D,
+        // the kernels and the stencils sum the contributions to each value in
+        // different orders, so that the values agree only up to round-off
+        // errors.
+        double max_diff = 0.0, max_val = 0.0;
+        for (int ln = 1; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > U_stencil_data = patch->getPatchData(U_stencil_idx);
+                Pointer<SideData<NDIM, double> > U_kernel_data = patch->getPatchData(U_kernel_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(U_kernel_data->getGhostBox(), axis);
+                    for (Box<NDIM>::Iterator b(side_box); b; b++)
+                    {
+                        const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
+                        max_diff = std::max(max_diff, std::abs((*U_stencil_data)(i_s) - (*U_kernel_data)(i_s)));
+                        max_val = std::max(max_val, std::abs((*U_kernel_data)(i_s)));
+                    }
+                }
+            }
+        }
+        max_diff = SAMRAI_MPI::maxReduction(max_diff);
+        max_val = SAMRAI_MPI::maxReduction(max_val);
+        const double rel_tol = input_db->getDouble("rel_tol");
+        passed = max_diff <= rel_tol * max_val;
+        pout << "max |U_stencil - U_kernel| = " << max_diff << " (max |U_kernel| = " << max_val
+             << ", rel_tol = " << rel_tol << ")\n";
+        pout << (passed ? "PASSED" : "FAILED") << "\n";
+
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(U_stencil_idx);
+            level->deallocatePatchData(U_kernel_idx);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
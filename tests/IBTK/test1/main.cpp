@@ -0,0 +1,253 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Headers for basic PETSc functions
+#include <petscksp.h>
+
+// Headers for basic SAMRAI objects
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/PETScBlockKrylovSolver.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// Number of grid cells in each direction of the discretized convection-diffusion
+// operator.
+static const int N = 32;
+
+// Number of linearly independent right-hand sides.  Additional right-hand
+// sides that are linear combinations of these are appended to the block so
+// that the block Krylov basis must be deflated.
+static const int NUM_INDEPENDENT_RHS = 4;
+
+// Solver parameters.
+static const double REL_RESIDUAL_TOL = 1.0e-10;
+static const int MAX_ITERATIONS = 1000;
+static const int RESTART = 30;
+
+// The block solutions must agree with the separately computed solutions to
+// within this tolerance relative to the norms of the solutions.  Both are
+// accurate to REL_RESIDUAL_TOL times the condition number of the operator.
+static const double REL_SOLUTION_TOL = 1.0e-6;
+
+// Assemble a nonsymmetric convection-diffusion operator on an N x N grid.
+Mat
+create_operator()
+{
+    Mat A;
+    MatCreateAIJ(PETSC_COMM_WORLD, PETSC_DECIDE, PETSC_DECIDE, N * N, N * N, 5, NULL, 5, NULL, &A);
+    PetscInt ilower, iupper;
+    MatGetOwnershipRange(A, &ilower, &iupper);
+    for (PetscInt row = ilower; row < iupper; ++row)
+    {
+        const int i = row % N, j = row / N;
+        MatSetValue(A, row, row, 4.1, INSERT_VALUES);
+        if (i > 0) MatSetValue(A, row, row - 1, -1.3, INSERT_VALUES);
+        if (i < N - 1) MatSetValue(A, row, row + 1, -0.7, INSERT_VALUES);
+        if (j > 0) MatSetValue(A, row, row - N, -1.2, INSERT_VALUES);
+        if (j < N - 1) MatSetValue(A, row, row + N, -0.8, INSERT_VALUES);
+    }
+    MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
+    return A;
+} // create_operator
+
+// Set up the right-hand sides.  The last two right-hand sides are b_0 + 2 b_1
+// and a copy of b_2, so that the right-hand side block is rank deficient.
+void
+create_rhs(std::vector<Vec>& b, Mat A)
+{
+    const int num_rhs = NUM_INDEPENDENT_RHS + 2;
+    b.resize(num_rhs);
+    for (int k = 0; k < num_rhs; ++k)
+    {
+        VecCreateMPI(PETSC_COMM_WORLD, PETSC_DECIDE, N * N, &b[k]);
+    }
+    PetscInt ilower, iupper;
+    MatGetOwnershipRange(A, &ilower, &iupper);
+    for (int k = 0; k < NUM_INDEPENDENT_RHS; ++k)
+    {
+        for (PetscInt row = ilower; row < iupper; ++row)
+        {
+            const double val = std::sin(0.37 * (k + 1) * (row + 1)) + std::cos(0.11 * (k + 2) * row);
+            VecSetValue(b[k], row, val, INSERT_VALUES);
+        }
+        VecAssemblyBegin(b[k]);
+        VecAssemblyEnd(b[k]);
+    }
+    VecWAXPY(b[NUM_INDEPENDENT_RHS], 2.0, b[1], b[0]);
+    VecCopy(b[2], b[NUM_INDEPENDENT_RHS + 1]);
+    return;
+} // create_rhs
+
+// Solve the systems with the block solver and with separate calls to KSPSolve
+// using the specified preconditioner type, and compare the solutions.
+bool
+compare_block_and_separate_solves(Mat A, const std::vector<Vec>& b, PCType pc_type)
+{
+    const int num_rhs = static_cast<int>(b.size());
+    KSP ksp;
+    KSPCreate(PETSC_COMM_WORLD, &ksp);
+    KSPSetOperators(ksp, A, A);
+    KSPSetType(ksp, KSPFGMRES);
+    KSPGMRESSetRestart(ksp, RESTART);
+    KSPSetTolerances(ksp, REL_RESIDUAL_TOL, PETSC_DEFAULT, PETSC_DEFAULT, MAX_ITERATIONS);
+    PC pc;
+    KSPGetPC(ksp, &pc);
+    PCSetType(pc, pc_type);
+    KSPSetUp(ksp);
+
+    std::vector<Vec> x_block(num_rhs), x_separate(num_rhs);
+    for (int k = 0; k < num_rhs; ++k)
+    {
+        VecDuplicate(b[k], &x_block[k]);
+        VecDuplicate(b[k], &x_separate[k]);
+    }
+
+    // Solve the systems all at once.
+    PETScBlockKrylovSolver block_solver("PETScBlockKrylovSolver");
+    block_solver.setFromKSP(ksp);
+    const bool block_converged = block_solver.solveSystems(x_block, b);
+
+    // Solve the systems one at a time.
+    bool separate_converged = true;
+    int num_separate_iterations = 0;
+    for (int k = 0; k < num_rhs; ++k)
+    {
+        KSPSolve(ksp, b[k], x_separate[k]);
+        KSPConvergedReason reason;
+        KSPGetConvergedReason(ksp, &reason);
+        separate_converged = separate_converged && reason > 0;
+        PetscInt its;
+        KSPGetIterationNumber(ksp, &its);
+        num_separate_iterations += its;
+    }
+
+    // Compare the solutions, and check the true residuals of the block
+    // solutions.
+    bool passed = block_converged && separate_converged;
+    Vec r;
+    VecDuplicate(b[0], &r);
+    double max_rel_diff = 0.0, max_rel_residual = 0.0;
+    for (int k = 0; k < num_rhs; ++k)
+    {
+        PetscReal x_norm, b_norm, diff_norm, r_norm;
+        VecNorm(x_separate[k], NORM_2, &x_norm);
+        VecNorm(b[k], NORM_2, &b_norm);
+        VecAXPY(x_separate[k], -1.0, x_block[k]);
+        VecNorm(x_separate[k], NORM_2, &diff_norm);
+        MatMult(A, x_block[k], r);
+        VecAYPX(r, -1.0, b[k]);
+        VecNorm(r, NORM_2, &r_norm);
+        max_rel_diff = std::max(max_rel_diff, static_cast<double>(diff_norm / x_norm));
+        max_rel_residual = std::max(max_rel_residual, static_cast<double>(r_norm / b_norm));
+    }
+    passed = passed && max_rel_diff <= REL_SOLUTION_TOL && max_rel_residual <= REL_RESIDUAL_TOL;
+    pout << "PC type " << pc_type << ": " << num_rhs << " right-hand sides of rank " << NUM_INDEPENDENT_RHS << "\n"
+         << "  block solve:     " << (block_converged ? "converged" : "did not converge") << " in "
+         << block_solver.getNumIterations() << " block iterations, "
+         << block_solver.getNumOperatorApplications() << " operator applications\n"
+         << "  separate solves: " << (separate_converged ? "converged" : "did not converge") << " in "
+         << num_separate_iterations << " iterations\n"
+         << "  max |x_block - x_separate| / |x_separate| = " << max_rel_diff << " (tol = " << REL_SOLUTION_TOL
+         << ")\n"
+         << "  max |b - A x_block| / |b| = " << max_rel_residual << " (tol = " << REL_RESIDUAL_TOL << ")\n";
+
+    VecDestroy(&r);
+    for (int k = 0; k < num_rhs; ++k)
+    {
+        VecDestroy(&x_block[k]);
+        VecDestroy(&x_separate[k]);
+    }
+    KSPDestroy(&ksp);
+    return passed;
+} // compare_block_and_separate_solves
+}
+
+/*******************************************************************************
+ * Compare the solutions computed by PETScBlockKrylovSolver::solveSystems()    *
+ * with those computed by separate calls to KSPSolve() for a block of          *
+ * right-hand sides that includes linearly dependent right-hand sides.  The    *
+ * command line is:                                                            *
+ *                                                                             *
+ *    executable                                                               *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+    bool passed = true;
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        Mat A = create_operator();
+        std::vector<Vec> b;
+        create_rhs(b, A);
+
+        // Test both the unpreconditioned and the (right) preconditioned block
+        // solver.
+        passed = compare_block_and_separate_solves(A, b, PCNONE) && passed;
+        passed = compare_block_and_separate_solves(A, b, PCJACOBI) && passed;
+        pout << (passed ? "PASSED" : "FAILED") << "\n";
+
+        for (unsigned int k = 0; k < b.size(); ++k)
+        {
+            VecDestroy(&b[k]);
+        }
+        MatDestroy(&A);
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
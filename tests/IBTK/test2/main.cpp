@@ -0,0 +1,207 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*******************************************************************************
+ * Compare the results of HierarchyMathOps with the patch operations on each   *
+ * level distributed among OpenMP threads with those computed with serial      *
+ * patch loops.  The command line is:                                          *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+    bool passed = false;
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "threaded_patch_loops.log");
+
+        // Create the objects that are used to generate the patch hierarchy.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create the variables.  Index 0 of each pair of results is computed
+        // with serial patch loops and index 1 with threaded patch loops.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("threaded_patch_loops");
+        Pointer<CellVariable<NDIM, double> > Q_var = new CellVariable<NDIM, double>("Q");
+        const int Q_idx = var_db->registerVariableAndContext(Q_var, ctx, IntVector<NDIM>(1));
+        Pointer<SideVariable<NDIM, double> > U_var = new SideVariable<NDIM, double>("U");
+        const int U_idx = var_db->registerVariableAndContext(U_var, ctx, IntVector<NDIM>(1));
+        Pointer<SideVariable<NDIM, double> > grad_Q_var = new SideVariable<NDIM, double>("grad_Q");
+        int grad_Q_idx[2];
+        grad_Q_idx[0] = var_db->registerVariableAndContext(grad_Q_var, ctx, IntVector<NDIM>(0));
+        grad_Q_idx[1] = var_db->registerClonedPatchDataIndex(grad_Q_var, grad_Q_idx[0]);
+        Pointer<CellVariable<NDIM, double> > div_U_var = new CellVariable<NDIM, double>("div_U");
+        int div_U_idx[2];
+        div_U_idx[0] = var_db->registerVariableAndContext(div_U_var, ctx, IntVector<NDIM>(0));
+        div_U_idx[1] = var_db->registerClonedPatchDataIndex(div_U_var, div_U_idx[0]);
+
+        // Initialize the patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Set the input values, including the ghost cell values, to smooth
+        // functions.  Both computations use the same input values, so the
+        // ghost cell values need not be consistent with the interior values.
+        muParserCartGridFunction Q_fcn("Q_fcn", app_initializer->getComponentDatabase("Q"), grid_geometry);
+        muParserCartGridFunction U_fcn("U_fcn", app_initializer->getComponentDatabase("U"), grid_geometry);
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(Q_idx, 0.0);
+            level->allocatePatchData(U_idx, 0.0);
+            for (int k = 0; k < 2; ++k)
+            {
+                level->allocatePatchData(grad_Q_idx[k], 0.0);
+                level->allocatePatchData(div_U_idx[k], 0.0);
+            }
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+                Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_idx);
+                Q_data->fillAll(0.0);
+                U_data->fillAll(0.0);
+            }
+        }
+        Q_fcn.setDataOnPatchHierarchy(Q_idx, Q_var, patch_hierarchy, 0.0);
+        U_fcn.setDataOnPatchHierarchy(U_idx, U_var, patch_hierarchy, 0.0);
+
+        // Compute the gradient and the divergence with serial and with threaded
+        // patch loops.  The results are synchronized at coarse-fine interfaces,
+        // so that the coarsening operations are also compared.
+        HierarchyMathOps hier_math_ops("HierarchyMathOps", patch_hierarchy);
+        Pointer<HierarchyGhostCellInterpolation> no_fill;
+        for (int k = 0; k < 2; ++k)
+        {
+            hier_math_ops.setUseThreadedPatchLoops(k == 1);
+            hier_math_ops.grad(grad_Q_idx[k], grad_Q_var, /*cf_bdry_synch*/ true, 1.0, Q_idx, Q_var, no_fill, 0.0);
+            hier_math_ops.div(div_U_idx[k], div_U_var, 1.0, U_idx, U_var, no_fill, 0.0, /*cf_bdry_synch*/ true);
+        }
+
+        // Each patch is processed by a single thread, so the results must be
+        // identical.
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy);
+        hier_sc_data_ops.subtract(grad_Q_idx[0], grad_Q_idx[0], grad_Q_idx[1]);
+        hier_cc_data_ops.subtract(div_U_idx[0], div_U_idx[0], div_U_idx[1]);
+        const double grad_Q_diff = hier_sc_data_ops.maxNorm(grad_Q_idx[0]);
+        const double div_U_diff = hier_cc_data_ops.maxNorm(div_U_idx[0]);
+        passed = (grad_Q_diff == 0.0) && (div_U_diff == 0.0);
+#ifdef _OPENMP
+        pout << "number of OpenMP threads = " << omp_get_max_threads() << "\n";
+#else
+        pout << "IBTK was compiled without OpenMP; both computations are serial\n";
+#endif
+        pout << "max |grad Q (serial) - grad Q (threaded)| = " << grad_Q_diff << "\n";
+        pout << "max |div U (serial) - div U (threaded)|   = " << div_U_diff << "\n";
+        pout << (passed ? "PASSED" : "FAILED") << "\n";
+
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(Q_idx);
+            level->deallocatePatchData(U_idx);
+            for (int k = 0; k < 2; ++k)
+            {
+                level->deallocatePatchData(grad_Q_idx[k]);
+                level->deallocatePatchData(div_U_idx[k]);
+            }
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
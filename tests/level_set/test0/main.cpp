@@ -0,0 +1,244 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026 by agent
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HyperbolicLevelIntegrator.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <LocationIndexRobinBcCoefs.h>
+#include <TimeRefinementIntegrator.h>
+#include <ibamr/AdvectorExplicitPredictorPatchOps.h>
+#include <ibamr/AdvectorPredictorCorrectorHyperbolicPatchOps.h>
+#include <ibamr/RelaxationLSMethod.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+struct CircularInterface
+{
+    IBTK::Vector X0;
+    double R;
+};
+
+// Initialize the level set with a function that has the correct zero level set
+// but that is not a signed distance function.
+void
+circular_interface_neighborhood(int D_idx,
+                                Pointer<HierarchyMathOps> hier_math_ops,
+                                double /*time*/,
+                                bool /*initial_time*/,
+                                void* ctx)
+{
+    const CircularInterface* const circle = static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_X_lower = patch_geom->getXLower();
+            const double* const patch_dx = patch_geom->getDx();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (Box<NDIM>::Iterator it(patch_box); it; it++)
+            {
+                const CellIndex<NDIM> ci(it());
+                IBTK::Vector r = IBTK::Vector::Zero();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    r[d] = patch_X_lower[d] + patch_dx[d] * (static_cast<double>(ci(d) - patch_box.lower(d)) + 0.5) -
+                           circle->X0[d];
+                }
+                (*D_data)(ci) = (1.0 + r.squaredNorm()) * (r.norm() - circle->R);
+            }
+        }
+    }
+    return;
+} // circular_interface_neighborhood
+
+/*******************************************************************************
+ * Compare the level set computed by RelaxationLSMethod when the relaxation is  *
+ * restricted to an active set of patches with the one computed by relaxing    *
+ * all patches, on a two-level patch hierarchy.  The command line is:          *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize MPI and SAMRAI.
+    SAMRAI_MPI::init(&argc, &argv);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+    bool passed = false;
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "level_set.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create the objects that are used to generate the patch hierarchy.
+        Pointer<AdvectorExplicitPredictorPatchOps> explicit_predictor = new AdvectorExplicitPredictorPatchOps(
+            "AdvectorExplicitPredictorPatchOps",
+            app_initializer->getComponentDatabase("AdvectorExplicitPredictorPatchOps"));
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<AdvectorPredictorCorrectorHyperbolicPatchOps> hyp_patch_ops =
+            new AdvectorPredictorCorrectorHyperbolicPatchOps(
+                "AdvectorPredictorCorrectorHyperbolicPatchOps",
+                app_initializer->getComponentDatabase("AdvectorPredictorCorrectorHyperbolicPatchOps"),
+                explicit_predictor,
+                grid_geometry);
+        Pointer<HyperbolicLevelIntegrator<NDIM> > hyp_level_integrator =
+            new HyperbolicLevelIntegrator<NDIM>("HyperbolicLevelIntegrator",
+                                                app_initializer->getComponentDatabase("HyperbolicLevelIntegrator"),
+                                                hyp_patch_ops,
+                                                true,
+                                                false);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               hyp_level_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        Pointer<TimeRefinementIntegrator<NDIM> > time_integrator =
+            new TimeRefinementIntegrator<NDIM>("TimeRefinementIntegrator",
+                                               app_initializer->getComponentDatabase("TimeRefinementIntegrator"),
+                                               patch_hierarchy,
+                                               hyp_level_integrator,
+                                               gridding_algorithm);
+
+        // Register a transported quantity so that the hierarchy can be
+        // initialized.
+        Pointer<FaceVariable<NDIM, double> > u_var = new FaceVariable<NDIM, double>("u");
+        Pointer<CartGridFunction> u_fcn = new muParserCartGridFunction(
+            "u_fcn", app_initializer->getComponentDatabase("AdvectionVelocityFunction"), grid_geometry);
+        hyp_patch_ops->registerAdvectionVelocity(u_var);
+        hyp_patch_ops->setAdvectionVelocityFunction(u_var, u_fcn);
+        Pointer<CellVariable<NDIM, double> > Q_var = new CellVariable<NDIM, double>("Q");
+        LocationIndexRobinBcCoefs<NDIM> physical_bc_coef(
+            "physical_bc_coef", app_initializer->getComponentDatabase("LocationIndexRobinBcCoefs"));
+        hyp_patch_ops->registerTransportedQuantity(Q_var);
+        hyp_patch_ops->setAdvectionVelocity(Q_var, u_var);
+        hyp_patch_ops->setPhysicalBcCoefs(Q_var, &physical_bc_coef);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializeHierarchy();
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        const double time = time_integrator->getIntegratorTime();
+        if (finest_ln != 1)
+        {
+            TBOX_ERROR("the patch hierarchy must have exactly two levels" << std::endl);
+        }
+
+        // Allocate the level set data.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("level_set");
+        Pointer<CellVariable<NDIM, double> > D_var = new CellVariable<NDIM, double>("D");
+        const int D_full_idx = var_db->registerVariableAndContext(D_var, ctx, IntVector<NDIM>(3));
+        const int D_active_idx = var_db->registerClonedPatchDataIndex(D_var, D_full_idx);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(D_full_idx, time);
+            level->allocatePatchData(D_active_idx, time);
+        }
+
+        // Compute the level set by relaxing all patches and by relaxing only
+        // the active patches.
+        CircularInterface circle;
+        circle.R = input_db->getDouble("R");
+        input_db->getDoubleArray("X0", circle.X0.data(), NDIM);
+        Pointer<HierarchyMathOps> hier_math_ops =
+            new HierarchyMathOps("HierarchyMathOps", patch_hierarchy, coarsest_ln, finest_ln);
+        Pointer<Database> full_db = app_initializer->getComponentDatabase("FullSweep");
+        Pointer<Database> active_db = app_initializer->getComponentDatabase("ActiveSet");
+        Pointer<RelaxationLSMethod> full_ls_ops = new RelaxationLSMethod("FullSweep", full_db, false);
+        Pointer<RelaxationLSMethod> active_ls_ops = new RelaxationLSMethod("ActiveSet", active_db, false);
+        full_ls_ops->registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, &circle);
+        active_ls_ops->registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, &circle);
+        full_ls_ops->initializeLSData(D_full_idx, hier_math_ops, time, /*initial_time*/ true);
+        active_ls_ops->initializeLSData(D_active_idx, hier_math_ops, time, /*initial_time*/ true);
+
+        // Compare the two solutions in the cells that are not covered by finer
+        // levels.
+        HierarchyCellDataOpsReal<NDIM, double> cc_data_ops(patch_hierarchy, coarsest_ln, finest_ln);
+        const int wgt_cc_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
+        cc_data_ops.subtract(D_active_idx, D_active_idx, D_full_idx);
+        const double max_diff = cc_data_ops.maxNorm(D_active_idx, wgt_cc_idx);
+        const double abs_tol = active_db->getDouble("abs_tol");
+        passed = max_diff <= abs_tol;
+        pout << "max |D_active_set - D_full_sweep| = " << max_diff << " (abs_tol = " << abs_tol << ")\n";
+        pout << (passed ? "PASSED" : "FAILED") << "\n";
+
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(D_full_idx);
+            level->deallocatePatchData(D_active_idx);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    SAMRAI_MPI::finalize();
+    return passed ? 0 : 1;
+} // main